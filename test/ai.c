@@ -0,0 +1,360 @@
+// Computer opponent (see ai.h)
+#include "ai.h"
+#include "ttt_table.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define TT_BITS 18           // 256K entries, 4 MB per search
+#define MAX_CANDIDATES 12    // moves searched per node after ordering
+#define MAX_DEPTH 32
+#define NEAR_DISTANCE 2      // only cells this close to a stone are considered
+#define MATE_BOUND (AI_WIN_SCORE - 1000)
+
+// ---------------------------------------------------------------------------
+// 3x3 perfect play from the generated table (see ttt_table.h)
+
+static const int pow3[9] = { 1, 3, 9, 27, 81, 243, 729, 2187, 6561 };
+
+int ai_ttt_best_move(const struct mnk_board* board, int* value) {
+    if (board->state != MNK_PLAYING) return -1;
+
+    int code = 0;
+    for (int i = 0; i < 9; i++) {
+        code += mnk_cell(board, i / 3, i % 3) * pow3[i];
+    }
+    return ttt_lookup(code, value);
+}
+
+// ---------------------------------------------------------------------------
+// Alpha-beta search for larger boards
+
+enum { TT_EXACT = 1, TT_LOWER, TT_UPPER };
+
+struct tt_entry {
+    uint64_t key;
+    int32_t score;
+    int16_t best;
+    int8_t depth;
+    uint8_t flag;
+};
+
+struct search {
+    const struct mnk_rules* rules;
+    mnk_bits occupied;
+    uint8_t* count[2];               // stones of each side per line
+    int weight[MNK_MAX_SIDE + 2];    // value of a line holding n stones of one side only
+    int to_move;
+    int moves;
+    int eval;                        // static evaluation from X's point of view
+    uint64_t hash;
+    struct tt_entry* tt;
+    int root_best;
+    long long nodes;
+    long long deadline_us;
+    volatile int* cancel;
+    bool aborted;
+};
+
+static uint64_t zobrist[2][MNK_MAX_CELLS];
+static pthread_once_t zobrist_once = PTHREAD_ONCE_INIT;
+
+static void zobrist_init(void) {
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (int side = 0; side < 2; side++) {
+        for (int cell = 0; cell < MNK_MAX_CELLS; cell++) {
+            // splitmix64
+            uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            zobrist[side][cell] = z ^ (z >> 31);
+        }
+    }
+}
+
+static long long monotonic_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int line_value(const struct search* s, int line) {
+    int x = s->count[MNK_SIDE_X][line];
+    int o = s->count[MNK_SIDE_O][line];
+    if (x && o) return 0;
+    return x ? s->weight[x] : -s->weight[o];
+}
+
+// Places a stone for the side to move; returns true if it completes a line.
+// Only the lines through the cell change, so the evaluation stays incremental.
+static bool search_play(struct search* s, int cell) {
+    const struct mnk_rules* rules = s->rules;
+    int side = s->to_move;
+    bool won = false;
+
+    for (int i = rules->cell_line_start[cell]; i < rules->cell_line_start[cell + 1]; i++) {
+        int line = rules->cell_lines[i];
+        s->eval -= line_value(s, line);
+        if (++s->count[side][line] == rules->k) won = true;
+        s->eval += line_value(s, line);
+    }
+    mnk_bit_set(&s->occupied, cell);
+    s->hash ^= zobrist[side][cell];
+    s->to_move = side ^ 1;
+    s->moves++;
+    return won;
+}
+
+static void search_unplay(struct search* s, int cell) {
+    const struct mnk_rules* rules = s->rules;
+    int side = s->to_move ^ 1;
+
+    for (int i = rules->cell_line_start[cell]; i < rules->cell_line_start[cell + 1]; i++) {
+        int line = rules->cell_lines[i];
+        s->eval -= line_value(s, line);
+        s->count[side][line]--;
+        s->eval += line_value(s, line);
+    }
+    mnk_bit_clear(&s->occupied, cell);
+    s->hash ^= zobrist[side][cell];
+    s->to_move = side;
+    s->moves--;
+}
+
+// First empty cell of a line
+static int line_empty_cell(const struct search* s, int line) {
+    const mnk_bits* mask = &s->rules->lines[line];
+    for (int w = 0; w < s->rules->words; w++) {
+        uint64_t free_bits = mask->w[w] & ~s->occupied.w[w];
+        if (free_bits) return w * 64 + mnk_ctz64(free_bits);
+    }
+    return -1;
+}
+
+static bool contains(const int* moves, int count, int cell) {
+    for (int i = 0; i < count; i++) {
+        if (moves[i] == cell) return true;
+    }
+    return false;
+}
+
+// Threat-space pruning: a winning move is played at once and an opponent's
+// open k-1 line must be blocked, so only those cells are searched. Otherwise
+// the cells near existing stones are ordered by attack + defence value and
+// only the best MAX_CANDIDATES are kept.
+static int generate_moves(const struct search* s, int* moves, int tt_move) {
+    const struct mnk_rules* rules = s->rules;
+    int me = s->to_move;
+    int opp = me ^ 1;
+    int blocks = 0;
+
+    for (int line = 0; line < rules->line_count; line++) {
+        if (s->count[me][line] == rules->k - 1 && s->count[opp][line] == 0) {
+            moves[0] = line_empty_cell(s, line);
+            return 1;
+        }
+        if (s->count[opp][line] == rules->k - 1 && s->count[me][line] == 0 && blocks < MAX_CANDIDATES) {
+            int cell = line_empty_cell(s, line);
+            if (!contains(moves, blocks, cell)) moves[blocks++] = cell;
+        }
+    }
+    if (blocks) return blocks;
+
+    if (s->moves == 0) {
+        moves[0] = (rules->rows / 2) * rules->cols + rules->cols / 2;
+        return 1;
+    }
+
+    int scores[MAX_CANDIDATES + 1];
+    int count = 0;
+    for (int cell = 0; cell < rules->cells; cell++) {
+        if (mnk_bit_test(&s->occupied, cell)) continue;
+
+        int row = cell / rules->cols;
+        int col = cell % rules->cols;
+        bool near = false;
+        for (int dr = -NEAR_DISTANCE; dr <= NEAR_DISTANCE && !near; dr++) {
+            for (int dc = -NEAR_DISTANCE; dc <= NEAR_DISTANCE && !near; dc++) {
+                int r = row + dr, c = col + dc;
+                near = r >= 0 && r < rules->rows && c >= 0 && c < rules->cols
+                    && mnk_bit_test(&s->occupied, r * rules->cols + c);
+            }
+        }
+        if (!near) continue;
+
+        int score = 0;
+        for (int i = rules->cell_line_start[cell]; i < rules->cell_line_start[cell + 1]; i++) {
+            int line = rules->cell_lines[i];
+            if (s->count[opp][line] == 0) score += s->weight[s->count[me][line] + 1];
+            if (s->count[me][line] == 0) score += s->weight[s->count[opp][line] + 1];
+        }
+        if (cell == tt_move) score = 1 << 30;
+
+        // Insertion into the bounded, descending candidate list
+        int pos = count < MAX_CANDIDATES ? count++ : MAX_CANDIDATES;
+        while (pos > 0 && scores[pos - 1] < score) {
+            if (pos < MAX_CANDIDATES) {
+                scores[pos] = scores[pos - 1];
+                moves[pos] = moves[pos - 1];
+            }
+            pos--;
+        }
+        if (pos < MAX_CANDIDATES) {
+            scores[pos] = score;
+            moves[pos] = cell;
+        }
+    }
+    return count;
+}
+
+static int score_to_tt(int score, int ply) {
+    if (score >= MATE_BOUND) return score + ply;
+    if (score <= -MATE_BOUND) return score - ply;
+    return score;
+}
+
+static int score_from_tt(int score, int ply) {
+    if (score >= MATE_BOUND) return score - ply;
+    if (score <= -MATE_BOUND) return score + ply;
+    return score;
+}
+
+static int negamax(struct search* s, int depth, int alpha, int beta, int ply) {
+    if ((++s->nodes & 1023) == 0 && ((s->cancel && *s->cancel) || monotonic_us() > s->deadline_us)) {
+        s->aborted = true;
+    }
+    if (s->aborted) return 0;
+    if (s->moves == s->rules->cells) return 0;
+    if (depth == 0) return (s->to_move == MNK_SIDE_X) ? s->eval : -s->eval;
+
+    struct tt_entry* entry = &s->tt[s->hash & ((1u << TT_BITS) - 1)];
+    int tt_move = -1;
+    if (entry->key == s->hash) {
+        tt_move = entry->best;
+        if (entry->depth >= depth && ply > 0) {
+            int score = score_from_tt(entry->score, ply);
+            if (entry->flag == TT_EXACT) return score;
+            if (entry->flag == TT_LOWER && score >= beta) return score;
+            if (entry->flag == TT_UPPER && score <= alpha) return score;
+        }
+    }
+
+    int moves[MAX_CANDIDATES];
+    int count = generate_moves(s, moves, tt_move);
+    int original_alpha = alpha;
+    int best_score = -AI_WIN_SCORE - 1;
+    int best_move = moves[0];
+
+    for (int i = 0; i < count; i++) {
+        int score;
+        if (search_play(s, moves[i])) {
+            score = AI_WIN_SCORE - ply - 1;
+        }
+        else {
+            score = -negamax(s, depth - 1, -beta, -alpha, ply + 1);
+        }
+        search_unplay(s, moves[i]);
+        if (s->aborted) return 0;
+
+        if (score > best_score) {
+            best_score = score;
+            best_move = moves[i];
+        }
+        if (best_score > alpha) alpha = best_score;
+        if (alpha >= beta) break;
+    }
+
+    entry->key = s->hash;
+    entry->score = score_to_tt(best_score, ply);
+    entry->best = (int16_t)best_move;
+    entry->depth = (int8_t)depth;
+    entry->flag = best_score <= original_alpha ? TT_UPPER : best_score >= beta ? TT_LOWER : TT_EXACT;
+    if (ply == 0) s->root_best = best_move;
+    return best_score;
+}
+
+int ai_search(const struct mnk_board* board, int time_budget_ms, volatile int* cancel, struct ai_result* result) {
+    const struct mnk_rules* rules = board->rules;
+
+    memset(result, 0, sizeof(*result));
+    result->cell = -1;
+    if (board->state != MNK_PLAYING) return -1;
+
+    if (rules->rows == 3 && rules->cols == 3 && rules->k == 3) {
+        int value = 0;
+        result->cell = ai_ttt_best_move(board, &value);
+        result->score = value * AI_WIN_SCORE;
+        result->depth = 9 - board->moves;
+        return result->cell;
+    }
+
+    pthread_once(&zobrist_once, zobrist_init);
+
+    struct search s;
+    memset(&s, 0, sizeof(s));
+    s.rules = rules;
+    s.to_move = board->to_move;
+    s.moves = board->moves;
+    s.cancel = cancel;
+    s.deadline_us = monotonic_us() + (long long)time_budget_ms * 1000;
+    s.count[0] = calloc(rules->line_count, 1);
+    s.count[1] = calloc(rules->line_count, 1);
+    s.tt = calloc((size_t)1 << TT_BITS, sizeof(struct tt_entry));
+    if (!s.count[0] || !s.count[1] || !s.tt) {
+        free(s.count[0]);
+        free(s.count[1]);
+        free(s.tt);
+        return -1;
+    }
+
+    s.weight[0] = 0;
+    s.weight[1] = 1;
+    for (int n = 2; n <= rules->k + 1 && n < MNK_MAX_SIDE + 2; n++) {
+        s.weight[n] = s.weight[n - 1] < (1 << 24) ? s.weight[n - 1] * 8 : s.weight[n - 1];
+    }
+
+    for (int w = 0; w < rules->words; w++) {
+        s.occupied.w[w] = board->stones[0].w[w] | board->stones[1].w[w];
+    }
+    for (int cell = 0; cell < rules->cells; cell++) {
+        for (int side = 0; side < 2; side++) {
+            if (mnk_bit_test(&board->stones[side], cell)) s.hash ^= zobrist[side][cell];
+        }
+    }
+    for (int line = 0; line < rules->line_count; line++) {
+        for (int side = 0; side < 2; side++) {
+            int n = 0;
+            for (int w = 0; w < rules->words; w++) {
+                n += mnk_popcount64(board->stones[side].w[w] & rules->lines[line].w[w]);
+            }
+            s.count[side][line] = (uint8_t)n;
+        }
+        s.eval += line_value(&s, line);
+    }
+
+    // Iterative deepening; an aborted iteration is thrown away
+    for (int depth = 1; depth <= MAX_DEPTH && depth <= rules->cells - board->moves; depth++) {
+        s.root_best = -1;
+        int score = negamax(&s, depth, -AI_WIN_SCORE - 1, AI_WIN_SCORE + 1, 0);
+        if (s.aborted) break;
+
+        result->cell = s.root_best;
+        result->score = score;
+        result->depth = depth;
+        if (score >= MATE_BOUND || score <= -MATE_BOUND) break;
+    }
+
+    // Out of time before depth 1 finished: fall back to the best ordered move
+    if (result->cell < 0) {
+        int moves[MAX_CANDIDATES];
+        if (generate_moves(&s, moves, -1) > 0) result->cell = moves[0];
+    }
+    result->nodes = s.nodes;
+
+    free(s.count[0]);
+    free(s.count[1]);
+    free(s.tt);
+    return result->cell;
+}
@@ -0,0 +1,118 @@
+// Worker pool and clock shared by the game AIs (see ai_pool.h)
+#include "ai_pool.h"
+
+#include <time.h>
+
+// A caller's jobs, on its stack while it waits
+struct ai_batch {
+    char* jobs;
+    size_t size;
+    int count;
+    int taken;                   // jobs handed to a worker
+    int pending;                 // jobs not finished yet
+    struct ai_batch* next;
+};
+
+static void* worker_main(void* arg) {
+    struct ai_worker* worker = (struct ai_worker*)arg;
+    struct ai_pool* pool = worker->pool;
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (!pool->head && !pool->stopping) pthread_cond_wait(&pool->work, &pool->lock);
+        struct ai_batch* batch = pool->head;
+        if (!batch) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+        void* job = batch->jobs + batch->size * (size_t)batch->taken++;
+        if (batch->taken == batch->count) {
+            pool->head = batch->next;
+            if (!pool->head) pool->tail = NULL;
+        }
+        pthread_mutex_unlock(&pool->lock);
+
+        pool->run(worker->scratch, job);
+
+        pthread_mutex_lock(&pool->lock);
+        batch->pending--;
+        pthread_cond_broadcast(&pool->done);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+static void join_workers(struct ai_pool* pool, int count) {
+    for (int i = 0; i < count; i++) {
+        pthread_join(pool->workers[i].thread, NULL);
+        pool->scratch_free(pool->workers[i].scratch);
+        pool->workers[i].scratch = NULL;
+    }
+}
+
+// Called with the lock held
+static int start_pool(struct ai_pool* pool) {
+    if (pool->started) return 0;
+    pool->stopping = 0;
+    int count = pool->worker_count < AI_POOL_MAX_WORKERS ? pool->worker_count : AI_POOL_MAX_WORKERS;
+    for (int i = 0; i < count; i++) {
+        struct ai_worker* worker = &pool->workers[i];
+        worker->pool = pool;
+        worker->scratch = pool->scratch_new();
+        if (!worker->scratch || pthread_create(&worker->thread, NULL, worker_main, worker) != 0) {
+            // Threads already started exit once they see stopping
+            pool->scratch_free(worker->scratch);
+            worker->scratch = NULL;
+            pool->stopping = 1;
+            pthread_cond_broadcast(&pool->work);
+            pthread_mutex_unlock(&pool->lock);
+            join_workers(pool, i);
+            pthread_mutex_lock(&pool->lock);
+            return -1;
+        }
+    }
+    pool->started = count;
+    return 0;
+}
+
+int ai_pool_run(struct ai_pool* pool, void* jobs, size_t size, int count) {
+    if (count <= 0) return 0;
+    struct ai_batch batch = { (char*)jobs, size, count, 0, count, NULL };
+    pthread_mutex_lock(&pool->lock);
+    if (start_pool(pool) != 0) {
+        pthread_mutex_unlock(&pool->lock);
+        return -1;
+    }
+    if (pool->tail) pool->tail->next = &batch;
+    else pool->head = &batch;
+    pool->tail = &batch;
+    pthread_cond_broadcast(&pool->work);
+    while (batch.pending > 0) pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+    return 0;
+}
+
+int ai_pool_stopping(const struct ai_pool* pool) {
+    return pool->stopping;
+}
+
+void ai_pool_shutdown(struct ai_pool* pool) {
+    pthread_mutex_lock(&pool->lock);
+    int started = pool->started;
+    if (!started) {
+        pthread_mutex_unlock(&pool->lock);
+        return;
+    }
+    pool->stopping = 1;
+    pthread_cond_broadcast(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+
+    join_workers(pool, started);
+    pthread_mutex_lock(&pool->lock);
+    pool->started = 0;
+    pthread_mutex_unlock(&pool->lock);
+}
+
+long long ai_monotonic_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
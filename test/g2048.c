@@ -0,0 +1,150 @@
+// 2048 rules engine (see g2048.h)
+#include "g2048.h"
+
+#include <pthread.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+struct g2048_tables g2048_tables;
+static pthread_once_t tables_once = PTHREAD_ONCE_INIT;
+
+// Slide a row toward cell 0, merging each pair of equal tiles once
+static uint16_t slide_row(uint16_t row, uint32_t* score) {
+    int in[G2048_SIZE];
+    int out[G2048_SIZE] = { 0 };
+    for (int i = 0; i < G2048_SIZE; i++) in[i] = (row >> (4 * i)) & 0xF;
+
+    int n = 0;
+    int merged = 1; // out[n - 1] may not take part in another merge
+    *score = 0;
+    for (int i = 0; i < G2048_SIZE; i++) {
+        if (!in[i]) continue;
+        if (!merged && out[n - 1] == in[i] && in[i] < G2048_MAX_EXPONENT) {
+            out[n - 1]++;
+            *score += 1u << out[n - 1];
+            merged = 1;
+        }
+        else {
+            out[n++] = in[i];
+            merged = 0;
+        }
+    }
+
+    uint16_t result = 0;
+    for (int i = 0; i < G2048_SIZE; i++) result |= (uint16_t)(out[i] << (4 * i));
+    return result;
+}
+
+static uint16_t reverse_row(uint16_t row) {
+    return (uint16_t)((row >> 12) | ((row >> 4) & 0x00F0) | ((row << 4) & 0x0F00) | (row << 12));
+}
+
+static void build_tables(void) {
+    for (uint32_t row = 0; row < G2048_ROWS; row++) {
+        uint32_t score;
+        g2048_tables.left[row] = slide_row((uint16_t)row, &score);
+        g2048_tables.score_left[row] = score;
+    }
+    // Moving right is moving the mirrored row left
+    for (uint32_t row = 0; row < G2048_ROWS; row++) {
+        uint16_t mirrored = reverse_row((uint16_t)row);
+        g2048_tables.right[row] = reverse_row(g2048_tables.left[mirrored]);
+        g2048_tables.score_right[row] = g2048_tables.score_left[mirrored];
+    }
+}
+
+void g2048_tables_init(void) {
+    pthread_once(&tables_once, build_tables);
+}
+
+static g2048_board move_rows(g2048_board board, const uint16_t* table, const uint32_t* scores, uint32_t* score) {
+    g2048_board result = 0;
+    uint32_t points = 0;
+    for (int r = 0; r < G2048_SIZE; r++) {
+        uint16_t row = g2048_row(board, r);
+        result |= (g2048_board)table[row] << (16 * r);
+        points += scores[row];
+    }
+    if (score) *score = points;
+    return result;
+}
+
+g2048_board g2048_move(g2048_board board, enum g2048_move move, uint32_t* score) {
+    switch (move) {
+    case G2048_LEFT:
+        return move_rows(board, g2048_tables.left, g2048_tables.score_left, score);
+    case G2048_RIGHT:
+        return move_rows(board, g2048_tables.right, g2048_tables.score_right, score);
+    case G2048_UP:
+        // Columns become rows, and up becomes left
+        return g2048_transpose(move_rows(g2048_transpose(board), g2048_tables.left, g2048_tables.score_left, score));
+    case G2048_DOWN:
+        return g2048_transpose(move_rows(g2048_transpose(board), g2048_tables.right, g2048_tables.score_right, score));
+    }
+    if (score) *score = 0;
+    return board;
+}
+
+bool g2048_can_move(g2048_board board) {
+    if (g2048_empty_count(board) > 0) return true;
+    // A full board can only move by merging, and merges are symmetric
+    return g2048_move(board, G2048_LEFT, NULL) != board || g2048_move(board, G2048_UP, NULL) != board;
+}
+
+static int popcount64(uint64_t x) {
+#ifdef _MSC_VER
+    return (int)__popcnt64(x);
+#else
+    return __builtin_popcountll(x);
+#endif
+}
+
+int g2048_empty_count(g2048_board board) {
+    // Fold each nibble into its low bit, then count the nibbles that stayed 0
+    uint64_t x = board;
+    x |= (x >> 2) & 0x3333333333333333ULL;
+    x |= x >> 1;
+    return popcount64(~x & 0x1111111111111111ULL);
+}
+
+g2048_board g2048_spawn(g2048_board board, uint32_t random) {
+    int empty = g2048_empty_count(board);
+    if (empty == 0) return board;
+
+    int target = (int)(random % (uint32_t)empty);
+    int exponent = ((random >> 16) % 10 == 0) ? 2 : 1;
+    for (int cell = 0; cell < G2048_SIZE * G2048_SIZE; cell++) {
+        if ((board >> (4 * cell)) & 0xF) continue;
+        if (target-- == 0) return board | ((g2048_board)exponent << (4 * cell));
+    }
+    return board;
+}
+
+int g2048_max_exponent(g2048_board board) {
+    int best = 0;
+    for (int cell = 0; cell < G2048_SIZE * G2048_SIZE; cell++) {
+        int exponent = (int)((board >> (4 * cell)) & 0xF);
+        if (exponent > best) best = exponent;
+    }
+    return best;
+}
+
+uint32_t g2048_tile_sum(g2048_board board) {
+    uint32_t sum = 0;
+    for (int cell = 0; cell < G2048_SIZE * G2048_SIZE; cell++) {
+        int exponent = (int)((board >> (4 * cell)) & 0xF);
+        if (exponent) sum += 1u << exponent;
+    }
+    return sum;
+}
+
+const char* g2048_move_name(enum g2048_move move) {
+    switch (move) {
+    case G2048_LEFT: return "left";
+    case G2048_RIGHT: return "right";
+    case G2048_UP: return "up";
+    case G2048_DOWN: return "down";
+    }
+    return "?";
+}
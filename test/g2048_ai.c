@@ -0,0 +1,240 @@
+// Expectimax player for 2048 (see g2048_ai.h)
+#include "g2048_ai.h"
+#include "ai_pool.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Heuristic weights, tuned for a corner strategy: keep rows and columns
+// monotonic, keep cells empty and merges available, and penalize large
+// tiles away from the edges via the sum term
+#define LOST_PENALTY 200000.0
+#define MONOTONICITY_POWER 4.0
+#define MONOTONICITY_WEIGHT 47.0
+#define SUM_POWER 3.5
+#define SUM_WEIGHT 11.0
+#define MERGES_WEIGHT 700.0
+#define EMPTY_WEIGHT 270.0
+
+#define TT_SIZE (1u << G2048_AI_TT_BITS)
+#define CHECK_INTERVAL 4096          // nodes between deadline checks
+
+// Chance node values do not depend on how the position was reached, so the
+// table is kept across jobs and searches
+struct tt_entry {
+    g2048_board board;
+    float value;
+    uint8_t depth;
+};
+
+struct search {
+    long long deadline_us;       // 0 for no limit
+    volatile int* cancel;
+    volatile int stop;           // some job ran out of time
+};
+
+struct root_job {
+    g2048_board board;           // position after the root move
+    int depth;
+    struct search* search;
+    double value;
+    long long nodes;
+    int aborted;
+};
+
+// Per-job state on the worker's stack
+struct job_context {
+    struct tt_entry* tt;
+    struct search* search;
+    long long nodes;
+    int aborted;
+};
+
+static float row_heuristic[G2048_ROWS];
+static pthread_once_t heuristic_once = PTHREAD_ONCE_INIT;
+
+// Each worker's scratch is its transposition table
+static void* tt_new(void);
+static void tt_free(void* tt);
+static void run_root_job(void* tt, void* job);
+
+static struct ai_pool pool = AI_POOL_INIT(G2048_AI_WORKERS, tt_new, tt_free, run_root_job);
+
+static void build_heuristics(void) {
+    for (uint32_t row = 0; row < G2048_ROWS; row++) {
+        int line[G2048_SIZE];
+        for (int i = 0; i < G2048_SIZE; i++) line[i] = (row >> (4 * i)) & 0xF;
+
+        double sum = 0;
+        int empty = 0;
+        int merges = 0;
+        int previous = 0;
+        int run = 0;
+        for (int i = 0; i < G2048_SIZE; i++) {
+            int rank = line[i];
+            sum += pow(rank, SUM_POWER);
+            if (rank == 0) {
+                empty++;
+                continue;
+            }
+            if (previous == rank) {
+                run++;
+            }
+            else if (run > 0) {
+                merges += 1 + run;
+                run = 0;
+            }
+            previous = rank;
+        }
+        if (run > 0) merges += 1 + run;
+
+        double monotonic_left = 0;
+        double monotonic_right = 0;
+        for (int i = 1; i < G2048_SIZE; i++) {
+            double a = pow(line[i - 1], MONOTONICITY_POWER);
+            double b = pow(line[i], MONOTONICITY_POWER);
+            if (line[i - 1] > line[i]) monotonic_left += a - b;
+            else monotonic_right += b - a;
+        }
+
+        row_heuristic[row] = (float)(LOST_PENALTY + EMPTY_WEIGHT * empty + MERGES_WEIGHT * merges -
+            MONOTONICITY_WEIGHT * fmin(monotonic_left, monotonic_right) - SUM_WEIGHT * sum);
+    }
+}
+
+double g2048_ai_evaluate(g2048_board board) {
+    pthread_once(&heuristic_once, build_heuristics);
+    g2048_board columns = g2048_transpose(board);
+    double value = 0;
+    for (int r = 0; r < G2048_SIZE; r++) {
+        value += row_heuristic[g2048_row(board, r)] + row_heuristic[g2048_row(columns, r)];
+    }
+    return value;
+}
+
+static int out_of_time(struct job_context* ctx) {
+    struct search* search = ctx->search;
+    if (ai_pool_stopping(&pool) || search->stop || (search->cancel && *search->cancel)) return 1;
+    if (search->deadline_us && ai_monotonic_us() >= search->deadline_us) {
+        search->stop = 1;
+        return 1;
+    }
+    return 0;
+}
+
+static double chance_node(struct job_context* ctx, g2048_board board, int depth, double probability);
+
+static double max_node(struct job_context* ctx, g2048_board board, int depth, double probability) {
+    double best = 0; // no move left: the game is lost
+    for (int move = 0; move < 4; move++) {
+        g2048_board next = g2048_move(board, (enum g2048_move)move, NULL);
+        if (next == board) continue;
+        double value = chance_node(ctx, next, depth, probability);
+        if (value > best) best = value;
+    }
+    return best;
+}
+
+static double chance_node(struct job_context* ctx, g2048_board board, int depth, double probability) {
+    if (ctx->aborted) return 0;
+    if ((++ctx->nodes % CHECK_INTERVAL) == 0 && out_of_time(ctx)) {
+        ctx->aborted = 1;
+        return 0;
+    }
+    if (depth <= 0 || probability < G2048_AI_MIN_PROBABILITY) return g2048_ai_evaluate(board);
+
+    struct tt_entry* entry = &ctx->tt[(board * 0x9E3779B97F4A7C15ull) >> (64 - G2048_AI_TT_BITS)];
+    if (entry->board == board && entry->depth >= depth) return entry->value;
+
+    int empty = g2048_empty_count(board);
+    double each = probability / empty;
+    double sum = 0;
+    for (int cell = 0; cell < G2048_SIZE * G2048_SIZE; cell++) {
+        if ((board >> (4 * cell)) & 0xF) continue;
+        g2048_board two = board | ((g2048_board)1 << (4 * cell));
+        g2048_board four = board | ((g2048_board)2 << (4 * cell));
+        sum += 0.9 * max_node(ctx, two, depth - 1, each * 0.9);
+        sum += 0.1 * max_node(ctx, four, depth - 1, each * 0.1);
+    }
+    double value = sum / empty;
+
+    if (!ctx->aborted) {
+        entry->board = board;
+        entry->value = (float)value;
+        entry->depth = (uint8_t)depth;
+    }
+    return value;
+}
+
+static void* tt_new(void) {
+    return calloc(TT_SIZE, sizeof(struct tt_entry));
+}
+
+static void tt_free(void* tt) {
+    free(tt);
+}
+
+static void run_root_job(void* tt, void* arg) {
+    struct root_job* job = (struct root_job*)arg;
+    struct job_context ctx = { (struct tt_entry*)tt, job->search, 0, 0 };
+    job->value = chance_node(&ctx, job->board, job->depth - 1, 1.0);
+    job->nodes = ctx.nodes;
+    job->aborted = ctx.aborted;
+}
+
+int g2048_ai_search(g2048_board board, int max_depth, int time_budget_ms, volatile int* cancel, struct g2048_ai_result* result) {
+    g2048_tables_init();
+    pthread_once(&heuristic_once, build_heuristics);
+    memset(result, 0, sizeof(*result));
+    result->move = -1;
+
+    long long start = ai_monotonic_us();
+    struct search search;
+    memset(&search, 0, sizeof(search));
+    search.deadline_us = time_budget_ms > 0 ? start + (long long)time_budget_ms * 1000 : 0;
+    search.cancel = cancel;
+
+    struct root_job jobs[4];
+    int moves[4];
+    int count = 0;
+    memset(jobs, 0, sizeof(jobs));
+    for (int move = 0; move < 4; move++) {
+        g2048_board next = g2048_move(board, (enum g2048_move)move, NULL);
+        if (next == board) continue;
+        jobs[count].board = next;
+        jobs[count].search = &search;
+        moves[count++] = move;
+    }
+    if (count > 0) result->move = moves[0];
+    if (max_depth > G2048_AI_MAX_DEPTH) max_depth = G2048_AI_MAX_DEPTH;
+
+    for (int depth = 1; count > 0 && depth <= max_depth; depth++) {
+        if (depth > 1 && cancel && *cancel) break;
+        for (int i = 0; i < count; i++) jobs[i].depth = depth;
+        if (ai_pool_run(&pool, jobs, sizeof(jobs[0]), count) != 0) break;
+
+        int aborted = 0;
+        int best = 0;
+        for (int i = 0; i < count; i++) {
+            result->nodes += jobs[i].nodes;
+            aborted |= jobs[i].aborted;
+            if (jobs[i].value > jobs[best].value) best = i;
+        }
+        if (aborted) break; // keep the last complete iteration
+
+        result->move = moves[best];
+        result->value = jobs[best].value;
+        result->depth = depth;
+        if (count == 1) break; // forced move, nothing to compare
+    }
+
+    result->elapsed_us = ai_monotonic_us() - start;
+    if (result->elapsed_us > 0) result->nodes_per_second = result->nodes * 1e6 / result->elapsed_us;
+    return result->move;
+}
+
+void g2048_ai_shutdown(void) {
+    ai_pool_shutdown(&pool);
+}
@@ -0,0 +1,380 @@
+// 2048 on large boards (see g2048_big.h)
+#include "g2048_big.h"
+
+#include <pthread.h>
+#include <string.h>
+
+// The SIMD kernels are compiled for x86 whatever the compiler flags and
+// picked at run time from what the CPU supports, so a default build (no
+// -mavx2, no /arch) still gets them. gcc and clang need the target attribute
+// to emit their instructions; MSVC emits any intrinsic without /arch.
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define G2048B_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__)
+#define G2048B_TARGET(isa) __attribute__((target(isa)))
+#else
+#define G2048B_TARGET(isa)
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define G2048B_SSE2 1
+#endif
+
+// compact_shuffle[m]: pshufb control that packs the bytes selected by the
+// 8-bit mask m to the front and zeroes the rest
+static uint8_t compact_shuffle[256][16];
+// merge_starts[e]: for e = equal-neighbour mask of a packed row, the cells
+// that take part in a merge as its left tile (left to right, once per tile)
+static uint8_t merge_starts[256];
+// reverse_shuffle[n]: mirrors the first n bytes
+static uint8_t reverse_shuffle[G2048B_MAX_SIZE + 1][16];
+static pthread_once_t tables_once = PTHREAD_ONCE_INIT;
+
+static void pick_kernel(void);
+
+static void build_tables(void) {
+    for (int mask = 0; mask < 256; mask++) {
+        int n = 0;
+        for (int i = 0; i < 8; i++) {
+            if (mask & (1 << i)) compact_shuffle[mask][n++] = (uint8_t)i;
+        }
+        while (n < 16) compact_shuffle[mask][n++] = 0x80;
+
+        int starts = 0;
+        for (int i = 0; i < 8; i++) {
+            if (mask & (1 << i)) {
+                starts |= 1 << i;
+                i++; // the partner cannot start another merge
+            }
+        }
+        merge_starts[mask] = (uint8_t)starts;
+    }
+    for (int size = 0; size <= G2048B_MAX_SIZE; size++) {
+        for (int i = 0; i < 16; i++) reverse_shuffle[size][i] = i < size ? (uint8_t)(size - 1 - i) : 0x80;
+    }
+    pick_kernel();
+}
+
+void g2048b_init(struct g2048b_board* board, int size) {
+    pthread_once(&tables_once, build_tables);
+    memset(board, 0, sizeof(*board));
+    if (size < 2) size = 2;
+    if (size > G2048B_MAX_SIZE) size = G2048B_MAX_SIZE;
+    board->size = size;
+}
+
+// ---------------------------------------------------------------------------
+// Scalar reference
+
+static int slide_row_scalar(uint8_t* row, int size, int reverse, uint64_t* score) {
+    uint8_t in[G2048B_MAX_SIZE];
+    uint8_t out[G2048B_MAX_SIZE] = { 0 };
+    for (int i = 0; i < size; i++) in[i] = row[reverse ? size - 1 - i : i];
+
+    int n = 0;
+    int merged = 1;
+    for (int i = 0; i < size; i++) {
+        if (!in[i]) continue;
+        if (!merged && out[n - 1] == in[i] && in[i] < G2048B_MAX_EXPONENT) {
+            out[n - 1]++;
+            *score += 1ull << out[n - 1];
+            merged = 1;
+        }
+        else {
+            out[n++] = in[i];
+            merged = 0;
+        }
+    }
+
+    int changed = 0;
+    for (int i = 0; i < size; i++) {
+        uint8_t* cell = &row[reverse ? size - 1 - i : i];
+        changed |= *cell != out[i];
+        *cell = out[i];
+    }
+    return changed;
+}
+
+static void transpose_scalar(struct g2048b_board* board) {
+    for (int r = 0; r < board->size; r++) {
+        for (int c = r + 1; c < board->size; c++) {
+            uint8_t t = board->cells[r][c];
+            board->cells[r][c] = board->cells[c][r];
+            board->cells[c][r] = t;
+        }
+    }
+}
+
+int g2048b_move_scalar(struct g2048b_board* board, enum g2048_move move, uint64_t* score) {
+    uint64_t points = 0;
+    int changed = 0;
+    int vertical = move == G2048_UP || move == G2048_DOWN;
+    int reverse = move == G2048_RIGHT || move == G2048_DOWN;
+
+    if (vertical) transpose_scalar(board);
+    for (int r = 0; r < board->size; r++) changed |= slide_row_scalar(board->cells[r], board->size, reverse, &points);
+    if (vertical) transpose_scalar(board);
+
+    if (score) *score += points;
+    return changed;
+}
+
+// ---------------------------------------------------------------------------
+// SIMD
+
+#ifdef G2048B_SSE2
+// Bytes 0..7 of every row; the padding bytes of the rows past size are zero
+// and stay so, whatever the size
+static void transpose_sse2(struct g2048b_board* board) {
+    __m128i r[8];
+    for (int i = 0; i < 8; i++) r[i] = _mm_loadl_epi64((const __m128i*)board->cells[i]);
+
+    __m128i a0 = _mm_unpacklo_epi8(r[0], r[1]);
+    __m128i a1 = _mm_unpacklo_epi8(r[2], r[3]);
+    __m128i a2 = _mm_unpacklo_epi8(r[4], r[5]);
+    __m128i a3 = _mm_unpacklo_epi8(r[6], r[7]);
+    __m128i b0 = _mm_unpacklo_epi16(a0, a1);
+    __m128i b1 = _mm_unpackhi_epi16(a0, a1);
+    __m128i b2 = _mm_unpacklo_epi16(a2, a3);
+    __m128i b3 = _mm_unpackhi_epi16(a2, a3);
+    __m128i c[4] = {
+        _mm_unpacklo_epi32(b0, b2), _mm_unpackhi_epi32(b0, b2),
+        _mm_unpacklo_epi32(b1, b3), _mm_unpackhi_epi32(b1, b3),
+    };
+    for (int i = 0; i < 4; i++) {
+        _mm_storel_epi64((__m128i*)board->cells[2 * i], c[i]);
+        _mm_storel_epi64((__m128i*)board->cells[2 * i + 1], _mm_srli_si128(c[i], 8));
+    }
+}
+#define transpose_board transpose_sse2
+#else
+#define transpose_board transpose_scalar
+#endif
+
+#ifdef G2048B_X86
+#define G2048B_SSSE3_TARGET G2048B_TARGET("ssse3")
+#define G2048B_AVX2_TARGET G2048B_TARGET("avx2")
+
+// 0xFF in each of the first 8 bytes whose bit is set in mask
+G2048B_SSSE3_TARGET static inline __m128i mask_to_bytes(int mask) {
+    const __m128i bits = _mm_set_epi64x(0, (long long)0x8040201008040201ull);
+    __m128i spread = _mm_and_si128(_mm_set1_epi8((char)mask), bits);
+    return _mm_and_si128(_mm_cmpeq_epi8(spread, bits), _mm_set_epi64x(0, -1));
+}
+
+G2048B_SSSE3_TARGET static inline __m128i load_shuffle(const uint8_t* control) {
+    return _mm_loadu_si128((const __m128i*)control);
+}
+
+G2048B_SSSE3_TARGET static inline int nonzero_mask(__m128i v) {
+    return ~_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())) & 0xFF;
+}
+
+// Score the merges starting at the cells in starts of a packed row
+G2048B_SSSE3_TARGET static inline uint64_t merge_points(__m128i packed, int starts) {
+    uint8_t bytes[16];
+    _mm_storeu_si128((__m128i*)bytes, packed);
+    uint64_t points = 0;
+    for (int i = 0; starts; i++, starts >>= 1) {
+        if (starts & 1) points += 1ull << (bytes[i] + 1);
+    }
+    return points;
+}
+
+// Equal non-zero neighbours of a packed row that may merge
+G2048B_SSSE3_TARGET static inline int equal_mask(__m128i packed) {
+    __m128i next = _mm_srli_si128(packed, 1);
+    int equal = _mm_movemask_epi8(_mm_cmpeq_epi8(packed, next));
+    int capped = _mm_movemask_epi8(_mm_cmpeq_epi8(packed, _mm_set1_epi8(G2048B_MAX_EXPONENT)));
+    return equal & nonzero_mask(packed) & ~capped & 0x7F;
+}
+
+G2048B_SSSE3_TARGET static inline __m128i merge_packed(__m128i packed, int starts) {
+    packed = _mm_sub_epi8(packed, mask_to_bytes(starts)); // -(-1): one exponent up
+    packed = _mm_andnot_si128(mask_to_bytes(starts << 1), packed);
+    return _mm_shuffle_epi8(packed, load_shuffle(compact_shuffle[nonzero_mask(packed)]));
+}
+
+G2048B_SSSE3_TARGET static int slide_row_ssse3(uint8_t* row, __m128i reverse, int mirrored, uint64_t* score) {
+    __m128i before = _mm_loadu_si128((const __m128i*)row);
+    __m128i v = mirrored ? _mm_shuffle_epi8(before, reverse) : before;
+
+    v = _mm_shuffle_epi8(v, load_shuffle(compact_shuffle[nonzero_mask(v)]));
+    int starts = merge_starts[equal_mask(v)];
+    if (starts) {
+        *score += merge_points(v, starts);
+        v = merge_packed(v, starts);
+    }
+
+    if (mirrored) v = _mm_shuffle_epi8(v, reverse);
+    _mm_storeu_si128((__m128i*)row, v);
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(before, v)) != 0xFFFF;
+}
+
+G2048B_SSSE3_TARGET static int slide_rows_ssse3(struct g2048b_board* board, int mirrored, uint64_t* score) {
+    int changed = 0;
+    __m128i reverse = load_shuffle(reverse_shuffle[board->size]);
+    for (int r = 0; r < board->size; r++) changed |= slide_row_ssse3(board->cells[r], reverse, mirrored, score);
+    return changed;
+}
+
+G2048B_AVX2_TARGET static inline __m256i pair_of(__m128i low, __m128i high) {
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+}
+
+G2048B_AVX2_TARGET static inline int nonzero_mask2(__m256i v) {
+    return ~_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_setzero_si256()));
+}
+
+G2048B_AVX2_TARGET static inline __m256i compact2(__m256i v) {
+    int nonzero = nonzero_mask2(v);
+    return _mm256_shuffle_epi8(v, pair_of(load_shuffle(compact_shuffle[nonzero & 0xFF]),
+        load_shuffle(compact_shuffle[(nonzero >> 16) & 0xFF])));
+}
+
+// Rows r and r + 1 in one register, one per 128-bit lane
+G2048B_AVX2_TARGET static int slide_row_pair_avx2(uint8_t* rows, __m256i reverse, int mirrored, uint64_t* score) {
+    __m256i before = _mm256_loadu_si256((const __m256i*)rows);
+    __m256i v = mirrored ? _mm256_shuffle_epi8(before, reverse) : before;
+    v = compact2(v);
+
+    __m256i next = _mm256_srli_si256(v, 1);
+    int equal = _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, next)) & nonzero_mask2(v) &
+        ~_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(G2048B_MAX_EXPONENT)));
+    int starts_low = merge_starts[equal & 0x7F];
+    int starts_high = merge_starts[(equal >> 16) & 0x7F];
+    if (starts_low | starts_high) {
+        *score += merge_points(_mm256_castsi256_si128(v), starts_low) +
+            merge_points(_mm256_extracti128_si256(v, 1), starts_high);
+        v = _mm256_sub_epi8(v, pair_of(mask_to_bytes(starts_low), mask_to_bytes(starts_high)));
+        v = _mm256_andnot_si256(pair_of(mask_to_bytes(starts_low << 1), mask_to_bytes(starts_high << 1)), v);
+        v = compact2(v);
+    }
+
+    if (mirrored) v = _mm256_shuffle_epi8(v, reverse);
+    _mm256_storeu_si256((__m256i*)rows, v);
+    return (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(before, v)) != 0xFFFFFFFFu;
+}
+
+G2048B_AVX2_TARGET static int slide_rows_avx2(struct g2048b_board* board, int mirrored, uint64_t* score) {
+    int changed = 0;
+    __m128i reverse = load_shuffle(reverse_shuffle[board->size]);
+    __m256i reverse2 = pair_of(reverse, reverse);
+    // Rows past size are all zero, so an odd last row can take a partner
+    for (int r = 0; r < board->size; r += 2) changed |= slide_row_pair_avx2(board->cells[r], reverse2, mirrored, score);
+    return changed;
+}
+
+static void cpu_features(int* ssse3, int* avx2) {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int leaves = info[0];
+    __cpuid(info, 1);
+    *ssse3 = (info[2] >> 9) & 1;
+    // AVX2 also needs the OS to save the YMM registers
+    int ymm_saved = ((info[2] >> 27) & 1) && (_xgetbv(0) & 6) == 6;
+    *avx2 = 0;
+    if (leaves >= 7 && ymm_saved) {
+        __cpuidex(info, 7, 0);
+        *avx2 = (info[1] >> 5) & 1;
+    }
+#else
+    __builtin_cpu_init();
+    *ssse3 = __builtin_cpu_supports("ssse3");
+    *avx2 = __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+
+static int slide_rows_scalar(struct g2048b_board* board, int mirrored, uint64_t* score) {
+    int changed = 0;
+    for (int r = 0; r < board->size; r++) changed |= slide_row_scalar(board->cells[r], board->size, mirrored, score);
+    return changed;
+}
+
+// Chosen once by pick_kernel; scalar until then
+static int (*slide_rows)(struct g2048b_board* board, int mirrored, uint64_t* score) = slide_rows_scalar;
+static const char* kernel_name = "scalar";
+
+static void pick_kernel(void) {
+#ifdef G2048B_X86
+    int ssse3, avx2;
+    cpu_features(&ssse3, &avx2);
+    if (avx2) {
+        slide_rows = slide_rows_avx2;
+        kernel_name = "AVX2";
+    }
+    else if (ssse3) {
+        slide_rows = slide_rows_ssse3;
+        kernel_name = "SSSE3";
+    }
+#endif
+}
+
+int g2048b_move(struct g2048b_board* board, enum g2048_move move, uint64_t* score) {
+    uint64_t points = 0;
+    int vertical = move == G2048_UP || move == G2048_DOWN;
+    int mirrored = move == G2048_RIGHT || move == G2048_DOWN;
+
+    if (vertical) transpose_board(board);
+    int changed = slide_rows(board, mirrored, &points);
+    if (vertical) transpose_board(board);
+
+    if (score) *score += points;
+    return changed;
+}
+
+const char* g2048b_simd_name(void) {
+    pthread_once(&tables_once, build_tables);
+    return kernel_name;
+}
+
+// ---------------------------------------------------------------------------
+// Rules that are not on the hot path
+
+int g2048b_empty_count(const struct g2048b_board* board) {
+    int empty = 0;
+    for (int r = 0; r < board->size; r++) {
+        for (int c = 0; c < board->size; c++) empty += board->cells[r][c] == 0;
+    }
+    return empty;
+}
+
+int g2048b_can_move(const struct g2048b_board* board) {
+    for (int r = 0; r < board->size; r++) {
+        for (int c = 0; c < board->size; c++) {
+            uint8_t cell = board->cells[r][c];
+            if (!cell) return 1;
+            if (cell >= G2048B_MAX_EXPONENT) continue;
+            if (c + 1 < board->size && board->cells[r][c + 1] == cell) return 1;
+            if (r + 1 < board->size && board->cells[r + 1][c] == cell) return 1;
+        }
+    }
+    return 0;
+}
+
+int g2048b_spawn(struct g2048b_board* board, uint32_t random) {
+    int empty = g2048b_empty_count(board);
+    if (empty == 0) return 0;
+
+    int target = (int)(random % (uint32_t)empty);
+    uint8_t exponent = ((random >> 16) % 10 == 0) ? 2 : 1;
+    for (int r = 0; r < board->size; r++) {
+        for (int c = 0; c < board->size; c++) {
+            if (board->cells[r][c]) continue;
+            if (target-- == 0) {
+                board->cells[r][c] = exponent;
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,119 @@
+// 2048 game in play (see g2048_play.h)
+#include <string.h>
+
+#include "g2048_play.h"
+
+// A 4x4 record is the XOR of the boards before and after the move and the
+// points; a big-board record is the points and a history_encode_delta() of
+// the cells
+#define SMALL_RECORD (sizeof(g2048_board) + sizeof(uint32_t))
+
+int g2048_play_init(struct g2048_play* play) {
+    memset(play, 0, sizeof(*play));
+    play->size = G2048_SIZE;
+    return history_init(&play->history, G2048_PLAY_HISTORY_BYTES);
+}
+
+void g2048_play_free(struct g2048_play* play) {
+    history_free(&play->history);
+}
+
+void g2048_play_new(struct g2048_play* play, int size, uint64_t seed) {
+    rng_seed(&play->random, seed);
+    play->size = size;
+    if (size == G2048_SIZE) {
+        g2048_tables_init();
+        play->board = g2048_spawn(g2048_spawn(0, rng_u32(&play->random)), rng_u32(&play->random));
+    }
+    else {
+        g2048b_init(&play->big, size);
+        g2048b_spawn(&play->big, rng_u32(&play->random));
+        g2048b_spawn(&play->big, rng_u32(&play->random));
+    }
+    play->score = 0;
+    play->moves = 0;
+    play->over = false;
+    history_clear(&play->history);
+}
+
+static bool move_small(struct g2048_play* play, enum g2048_move move) {
+    uint32_t points;
+    g2048_board next = g2048_move(play->board, move, &points);
+    if (next == play->board) return false;
+
+    next = g2048_spawn(next, rng_u32(&play->random));
+    g2048_board change = play->board ^ next;
+    uint8_t record[SMALL_RECORD];
+    memcpy(record, &change, sizeof(change));
+    memcpy(record + sizeof(change), &points, sizeof(points));
+    history_push(&play->history, record, sizeof(record));
+    play->board = next;
+    play->score += points;
+    return true;
+}
+
+static bool move_big(struct g2048_play* play, enum g2048_move move) {
+    struct g2048b_board before = play->big;
+    uint64_t points = 0;
+    if (!g2048b_move(&play->big, move, &points)) return false;
+    g2048b_spawn(&play->big, rng_u32(&play->random));
+    play->score += points;
+
+    uint8_t record[sizeof(points) + 3 * sizeof(play->big.cells)];
+    memcpy(record, &points, sizeof(points));
+    int delta = history_encode_delta(&before.cells[0][0], &play->big.cells[0][0], sizeof(play->big.cells),
+        record + sizeof(points), sizeof(record) - sizeof(points));
+    if (delta >= 0) history_push(&play->history, record, sizeof(points) + (size_t)delta);
+    return true;
+}
+
+bool g2048_play_move(struct g2048_play* play, enum g2048_move move) {
+    if (play->over) return false;
+    if (!(play->size == G2048_SIZE ? move_small(play, move) : move_big(play, move))) return false;
+    play->moves++;
+    play->over = play->size == G2048_SIZE ? !g2048_can_move(play->board) : !g2048b_can_move(&play->big);
+    return true;
+}
+
+// Apply a history record; direction is -1 to take the move back, 1 to play it again
+static void apply_record(struct g2048_play* play, const uint8_t* record, size_t size, int direction) {
+    if (play->size == G2048_SIZE) {
+        g2048_board change;
+        uint32_t points;
+        if (size != SMALL_RECORD) return;
+        memcpy(&change, record, sizeof(change));
+        memcpy(&points, record + sizeof(change), sizeof(points));
+        play->board ^= change;
+        play->score += direction > 0 ? points : -(uint64_t)points;
+    }
+    else {
+        uint64_t points;
+        if (size < sizeof(points)) return;
+        memcpy(&points, record, sizeof(points));
+        history_apply_delta(record + sizeof(points), size - sizeof(points), &play->big.cells[0][0], sizeof(play->big.cells));
+        play->score += direction > 0 ? points : -points;
+    }
+    play->moves += direction;
+}
+
+static bool step_history(struct g2048_play* play, bool redo) {
+    if (play->over) return false;
+    uint8_t record[HISTORY_MAX_RECORD];
+    size_t size = redo ? history_redo(&play->history, record, sizeof(record)) : history_undo(&play->history, record, sizeof(record));
+    if (!size) return false;
+    apply_record(play, record, size, redo ? 1 : -1);
+    return true;
+}
+
+bool g2048_play_undo(struct g2048_play* play) {
+    return step_history(play, false);
+}
+
+bool g2048_play_redo(struct g2048_play* play) {
+    return step_history(play, true);
+}
+
+int g2048_play_cell(const struct g2048_play* play, int row, int col) {
+    if (play->size == G2048_SIZE) return g2048_cell(play->board, row, col);
+    return play->big.cells[row][col];
+}
@@ -0,0 +1,324 @@
+#define _CRT_SECURE_NO_WARNINGS
+// 2048 screen. The rules live in g2048.c (4x4) and g2048_big.c (6x6 and
+// 8x8); this file only draws the board, maps keys to moves and submits the
+// final score. Hints and autoplay run the expectimax search (g2048_ai.h) on a
+// background thread and hand the move back with g_idle_add; a result for a
+// board that has changed meanwhile is dropped. The search only knows 4x4.
+// The game itself, undo and redo included, is a g2048_play. Its seed and
+// every move are recorded as a replay (replay.h).
+#include <gtk/gtk.h>
+#include <pthread.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "g2048.h"
+#include "g2048_ai.h"
+#include "g2048_play.h"
+#include "games.h"
+#include "replay.h"
+
+#define TILE_PIXELS 96
+#define TILE_GAP 10
+#define BOARD_PIXELS (G2048_SIZE * TILE_PIXELS + (G2048_SIZE + 1) * TILE_GAP)
+#define HINT_DEPTH 8
+#define HINT_TIME_MS 300
+#define AUTOPLAY_TIME_MS 100
+
+static struct {
+    GtkWidget* area;
+    GtkWidget* score_label;
+    GtkWidget* status_label;
+    GtkWidget* hint_label;
+    GtkWidget* hint;
+    GtkWidget* autoplay;
+    GtkWidget* undo;
+    GtkWidget* redo;
+    GtkWidget* size_combo;
+    struct g2048_play play;
+    struct replay replay;
+    gint64 started;              // monotonic time the game started
+    gboolean thinking;           // a search is running
+} game;
+
+static volatile int hint_cancel = 0; // stops the running search
+
+struct hint_job {
+    g2048_board board;
+    gboolean autoplay;
+    struct g2048_ai_result result;
+};
+
+// Background colors by exponent, the usual beige-to-orange ramp
+static const double tile_colors[][3] = {
+    { 0.80, 0.76, 0.71 }, { 0.93, 0.89, 0.85 }, { 0.93, 0.88, 0.78 }, { 0.95, 0.69, 0.47 },
+    { 0.96, 0.58, 0.39 }, { 0.96, 0.49, 0.37 }, { 0.96, 0.37, 0.23 }, { 0.93, 0.81, 0.45 },
+    { 0.93, 0.80, 0.38 }, { 0.93, 0.78, 0.31 }, { 0.93, 0.77, 0.25 }, { 0.93, 0.76, 0.18 },
+};
+
+static void update_labels(void) {
+    char text[64];
+    snprintf(text, sizeof(text), "Score: %llu", (unsigned long long)game.play.score);
+    gtk_label_set_text(GTK_LABEL(game.score_label), text);
+    gtk_label_set_text(GTK_LABEL(game.status_label), game.play.over ? "Game over!" : "");
+    // Once over, the score is submitted and the moves are final
+    gtk_widget_set_sensitive(game.undo, !game.play.over && game.play.history.undo_count > 0);
+    gtk_widget_set_sensitive(game.redo, !game.play.over && game.play.history.redo_count > 0);
+}
+
+static gboolean autoplaying(void) {
+    return gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(game.autoplay));
+}
+
+static void request_hint(gboolean autoplay);
+
+// Milliseconds since the game started, for the replay
+static int64_t game_time(void) {
+    return (g_get_monotonic_time() - game.started) / 1000;
+}
+
+static void new_game(void) {
+    hint_cancel = 1;
+    gtk_label_set_text(GTK_LABEL(game.hint_label), "");
+    int size = atoi(gtk_combo_box_get_active_id(GTK_COMBO_BOX(game.size_combo)));
+    guint64 seed = ((guint64)g_random_int() << 32) | g_random_int();
+    g2048_play_new(&game.play, size, seed);
+    replay_start(&game.replay, REPLAY_2048, size, seed);
+    game.started = g_get_monotonic_time();
+    gtk_widget_set_sensitive(game.hint, size == G2048_SIZE);
+    gtk_widget_set_sensitive(game.autoplay, size == G2048_SIZE);
+    if (size != G2048_SIZE) gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(game.autoplay), FALSE);
+    update_labels();
+    gtk_widget_queue_draw(game.area);
+}
+
+static void finish_game(void) {
+    replay_end(&game.replay, game_time());
+    if (!is_guest_mode && username[0]) {
+        char name[16];
+        if (game.play.size == G2048_SIZE) snprintf(name, sizeof(name), "2048");
+        else snprintf(name, sizeof(name), "2048-%dx%d", game.play.size, game.play.size);
+        gboolean recorded = replay_complete(&game.replay);
+        send_game_score(username, name, game.play.score > INT_MAX ? INT_MAX : (int)game.play.score,
+            recorded ? game.replay.data : NULL, recorded ? game.replay.size : 0);
+    }
+}
+
+static void play(enum g2048_move move) {
+    // Moves that change nothing do not spawn a tile and are not recorded
+    if (!g2048_play_move(&game.play, move)) return;
+    replay_add(&game.replay, game_time(), move);
+    if (game.play.over) finish_game();
+    update_labels();
+    gtk_label_set_text(GTK_LABEL(game.hint_label), "");
+    gtk_widget_queue_draw(game.area);
+    if (autoplaying()) request_hint(TRUE);
+}
+
+// Runs on the GTK thread
+static gboolean deliver_hint(gpointer data) {
+    struct hint_job* job = (struct hint_job*)data;
+    game.thinking = FALSE;
+
+    if (job->board != game.play.board || game.play.over) {
+        // Stale: the board changed while the search ran
+        if (autoplaying()) request_hint(TRUE);
+    }
+    else if (job->result.move >= 0) {
+        char text[96];
+        snprintf(text, sizeof(text), "Hint: %s (depth %d, %.1fM nodes/s)", g2048_move_name((enum g2048_move)job->result.move),
+            job->result.depth, job->result.nodes_per_second / 1e6);
+        if (job->autoplay && autoplaying()) play((enum g2048_move)job->result.move);
+        gtk_label_set_text(GTK_LABEL(game.hint_label), text);
+    }
+    g_free(job);
+    return FALSE;
+}
+
+static void* hint_thread(void* arg) {
+    struct hint_job* job = (struct hint_job*)arg;
+    g2048_ai_search(job->board, HINT_DEPTH, job->autoplay ? AUTOPLAY_TIME_MS : HINT_TIME_MS, &hint_cancel, &job->result);
+    g_idle_add(deliver_hint, job);
+    return NULL;
+}
+
+// One search at a time; its result asks for the next one when needed
+static void request_hint(gboolean autoplay) {
+    if (game.thinking || game.play.over || game.play.size != G2048_SIZE) return;
+
+    struct hint_job* job = g_new0(struct hint_job, 1);
+    job->board = game.play.board;
+    job->autoplay = autoplay;
+    hint_cancel = 0;
+    game.thinking = TRUE;
+
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, hint_thread, job) != 0) {
+        fprintf(stderr, "Failed to start 2048 hint thread\n");
+        game.thinking = FALSE;
+        g_free(job);
+        return;
+    }
+    pthread_detach(thread);
+}
+
+static void step_history(gboolean redo) {
+    if (!(redo ? g2048_play_redo(&game.play) : g2048_play_undo(&game.play))) return;
+    replay_add(&game.replay, game_time(), redo ? REPLAY_REDO : REPLAY_UNDO);
+
+    // Stepping through history is the player's call, not the search's
+    gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(game.autoplay), FALSE);
+    update_labels();
+    gtk_label_set_text(GTK_LABEL(game.hint_label), "");
+    gtk_widget_queue_draw(game.area);
+}
+
+static void on_undo(GtkWidget* widget, gpointer data) {
+    (void)widget;
+    (void)data;
+    step_history(FALSE);
+    gtk_widget_grab_focus(game.area);
+}
+
+static void on_redo(GtkWidget* widget, gpointer data) {
+    (void)widget;
+    (void)data;
+    step_history(TRUE);
+    gtk_widget_grab_focus(game.area);
+}
+
+static void on_hint(GtkWidget* widget, gpointer data) {
+    (void)widget;
+    (void)data;
+    request_hint(FALSE);
+    gtk_widget_grab_focus(game.area);
+}
+
+static void on_autoplay_toggled(GtkWidget* widget, gpointer data) {
+    (void)data;
+    if (gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(widget))) request_hint(TRUE);
+    else hint_cancel = 1;
+    gtk_widget_grab_focus(game.area);
+}
+
+static gboolean on_2048_key(GtkWidget* widget, GdkEventKey* event, gpointer data) {
+    (void)widget;
+    (void)data;
+    if (event->state & GDK_CONTROL_MASK) {
+        switch (event->keyval) {
+        case GDK_KEY_z: step_history(FALSE); return TRUE;
+        case GDK_KEY_y: case GDK_KEY_Z: step_history(TRUE); return TRUE;
+        default: return FALSE;
+        }
+    }
+    switch (event->keyval) {
+    case GDK_KEY_Left: case GDK_KEY_a: play(G2048_LEFT); return TRUE;
+    case GDK_KEY_Right: case GDK_KEY_d: play(G2048_RIGHT); return TRUE;
+    case GDK_KEY_Up: case GDK_KEY_w: play(G2048_UP); return TRUE;
+    case GDK_KEY_Down: case GDK_KEY_s: play(G2048_DOWN); return TRUE;
+    default: return FALSE;
+    }
+}
+
+static gboolean on_2048_draw(GtkWidget* widget, cairo_t* cr, gpointer data) {
+    (void)widget;
+    (void)data;
+    cairo_set_source_rgb(cr, 0.73, 0.68, 0.63);
+    cairo_paint(cr);
+
+    // The board keeps its size on screen; more cells means smaller tiles
+    int size = game.play.size;
+    double tile = (double)(BOARD_PIXELS - (size + 1) * TILE_GAP) / size;
+    double scale = tile / TILE_PIXELS;
+
+    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
+    for (int row = 0; row < size; row++) {
+        for (int col = 0; col < size; col++) {
+            int exponent = g2048_play_cell(&game.play, row, col);
+            double x = TILE_GAP + col * (tile + TILE_GAP);
+            double y = TILE_GAP + row * (tile + TILE_GAP);
+
+            int shade = exponent < (int)G_N_ELEMENTS(tile_colors) ? exponent : (int)G_N_ELEMENTS(tile_colors) - 1;
+            cairo_set_source_rgb(cr, tile_colors[shade][0], tile_colors[shade][1], tile_colors[shade][2]);
+            cairo_rectangle(cr, x, y, tile, tile);
+            cairo_fill(cr);
+            if (!exponent) continue;
+
+            char text[24];
+            snprintf(text, sizeof(text), "%llu", 1ull << exponent);
+            cairo_set_font_size(cr, scale * (exponent < 7 ? 40 : exponent < 10 ? 32 : exponent < 14 ? 24 : 16));
+            cairo_text_extents_t extents;
+            cairo_text_extents(cr, text, &extents);
+            if (exponent < 3) cairo_set_source_rgb(cr, 0.47, 0.43, 0.40);
+            else cairo_set_source_rgb(cr, 0.98, 0.97, 0.95);
+            cairo_move_to(cr, x + (tile - extents.width) / 2 - extents.x_bearing,
+                y + (tile - extents.height) / 2 - extents.y_bearing);
+            cairo_show_text(cr, text);
+        }
+    }
+    return FALSE;
+}
+
+static void on_new_game(GtkWidget* widget, gpointer data) {
+    (void)widget;
+    (void)data;
+    new_game();
+    if (autoplaying()) request_hint(TRUE);
+    gtk_widget_grab_focus(game.area);
+}
+
+void start_2048_game(GtkWidget* widget, gpointer data) {
+    (void)widget;
+    new_game();
+    gtk_stack_set_visible_child_name(GTK_STACK(data), "2048");
+    gtk_widget_grab_focus(game.area);
+}
+
+GtkWidget* create_2048_screen(GtkStack* stack) {
+    GtkWidget* box = gtk_box_new(GTK_ORIENTATION_VERTICAL, 6);
+    gtk_container_set_border_width(GTK_CONTAINER(box), 10);
+
+    GtkWidget* toolbar = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 6);
+    game.score_label = gtk_label_new("");
+    gtk_box_pack_start(GTK_BOX(toolbar), game.score_label, FALSE, FALSE, 0);
+    GtkWidget* restart = gtk_button_new_with_label("New game");
+    g_signal_connect(restart, "clicked", G_CALLBACK(on_new_game), NULL);
+    gtk_box_pack_end(GTK_BOX(toolbar), restart, FALSE, FALSE, 0);
+    game.autoplay = gtk_toggle_button_new_with_label("Autoplay");
+    g_signal_connect(game.autoplay, "toggled", G_CALLBACK(on_autoplay_toggled), NULL);
+    gtk_box_pack_end(GTK_BOX(toolbar), game.autoplay, FALSE, FALSE, 0);
+    game.redo = gtk_button_new_with_label("Redo");
+    g_signal_connect(game.redo, "clicked", G_CALLBACK(on_redo), NULL);
+    gtk_box_pack_end(GTK_BOX(toolbar), game.redo, FALSE, FALSE, 0);
+    game.undo = gtk_button_new_with_label("Undo");
+    g_signal_connect(game.undo, "clicked", G_CALLBACK(on_undo), NULL);
+    gtk_box_pack_end(GTK_BOX(toolbar), game.undo, FALSE, FALSE, 0);
+    game.hint = gtk_button_new_with_label("Hint");
+    g_signal_connect(game.hint, "clicked", G_CALLBACK(on_hint), NULL);
+    gtk_box_pack_end(GTK_BOX(toolbar), game.hint, FALSE, FALSE, 0);
+    game.size_combo = gtk_combo_box_text_new();
+    gtk_combo_box_text_append(GTK_COMBO_BOX_TEXT(game.size_combo), "4", "4x4");
+    gtk_combo_box_text_append(GTK_COMBO_BOX_TEXT(game.size_combo), "6", "6x6");
+    gtk_combo_box_text_append(GTK_COMBO_BOX_TEXT(game.size_combo), "8", "8x8");
+    gtk_combo_box_set_active_id(GTK_COMBO_BOX(game.size_combo), "4");
+    g_signal_connect(game.size_combo, "changed", G_CALLBACK(on_new_game), NULL);
+    gtk_box_pack_end(GTK_BOX(toolbar), game.size_combo, FALSE, FALSE, 0);
+    game.status_label = gtk_label_new("");
+    gtk_box_pack_end(GTK_BOX(toolbar), game.status_label, FALSE, FALSE, 0);
+    gtk_box_pack_start(GTK_BOX(box), toolbar, FALSE, FALSE, 0);
+
+    game.area = gtk_drawing_area_new();
+    gtk_widget_set_size_request(game.area, BOARD_PIXELS, BOARD_PIXELS);
+    gtk_widget_set_can_focus(game.area, TRUE);
+    gtk_widget_add_events(game.area, GDK_KEY_PRESS_MASK);
+    g_signal_connect(game.area, "draw", G_CALLBACK(on_2048_draw), NULL);
+    g_signal_connect(game.area, "key-press-event", G_CALLBACK(on_2048_key), NULL);
+    gtk_box_pack_start(GTK_BOX(box), game.area, FALSE, FALSE, 0);
+    game.hint_label = gtk_label_new("");
+    gtk_box_pack_start(GTK_BOX(box), game.hint_label, FALSE, FALSE, 0);
+
+    gtk_stack_add_named(stack, box, "2048");
+    if (g2048_play_init(&game.play) != 0) fprintf(stderr, "Failed to allocate 2048 undo history\n");
+    new_game();
+    return box;
+}
@@ -0,0 +1,815 @@
+#define _CRT_SECURE_NO_WARNINGS
+// Tetris screen. The rules live in tetris.c; this file draws the well, the
+// hold piece and the preview, maps keys to inputs and submits the final
+// score.
+//
+// Timing lives in the fixed-step simulation (tetris_sim.h). Key presses and
+// releases are stamped with the GDK event time, which the window system
+// sets when the key goes down, converted to the game clock. Gravity, lock
+// delay, auto-shift and soft drop all run on the game clock too. A frame
+// callback advances the simulation to INPUT_SLACK_US behind the present,
+// so an event that reaches us a few milliseconds after it happened still
+// takes effect at its own time. A slow frame delays only the picture; how
+// far and when the piece moves does not change.
+//
+// The hint overlay and the CPU player run the placement search
+// (tetris_ai.h) on a background thread once per piece and get the result
+// back with g_idle_add; a result for an earlier piece is dropped. The CPU
+// plays the key sequence of the best placement at a fixed pace, as inputs
+// to the same simulation but without gravity, and a game it played in is
+// not submitted.
+//
+// The seed and every input the simulation accepted are recorded as a
+// replay (replay.h), which plays the game again exactly.
+//
+// Versus plays against another player in the same game room over the game
+// WebSocket (tetris_versus.h). Both games start from one seed, made from a
+// nonce of each side that is committed to before either is revealed. Each
+// side sends its accepted inputs and attacks, and runs a copy of the
+// opponent's game from theirs, drawn at half size beside our own. Hints, the CPU and
+// score submission are off during a match.
+#include <gtk/gtk.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "games.h"
+#include "replay.h"
+#include "tetris.h"
+#include "tetris_ai.h"
+#include "tetris_sim.h"
+#include "tetris_versus.h"
+
+#define CELL_PIXELS 28
+#define MARGIN 10
+#define PANEL_PIXELS (5 * CELL_PIXELS)
+#define WELL_PIXELS_W (TETRIS_WIDTH * CELL_PIXELS)
+#define WELL_PIXELS_H (TETRIS_VISIBLE * CELL_PIXELS)
+#define CPU_STEP_MS 40
+#define INPUT_SLACK_US 8000          // how far the simulation stays behind the present
+#define MAX_CATCHUP_US 1000000       // a longer gap (screen hidden, stalled loop) pauses the game instead
+#define EVENT_RESYNC_US 250000       // event clock drift that resets the conversion
+#define OPPONENT_CELL (CELL_PIXELS / 2)
+#define OPPONENT_PIXELS (TETRIS_WIDTH * OPPONENT_CELL + MARGIN)
+
+static struct {
+    GtkWidget* area;
+    GtkWidget* score_label;
+    GtkWidget* status_label;
+    struct tetris_sim sim;
+    struct replay replay;
+    guint tick;                  // frame clock callback, 0 when the game is not running
+    gint64 start;                // monotonic time of game clock zero
+    gint64 event_offset;         // monotonic minus event time, smallest seen
+    gboolean event_offset_valid;
+    gboolean keys_down[TETRIS_KEYS];
+    uint32_t locks;              // sim.locks and sim.holds when the piece last changed
+    uint32_t holds;
+    uint32_t shown_score;
+    int shown_lines;
+    GtkWidget* hint_toggle;
+    GtkWidget* cpu_toggle;
+    guint generation;            // bumped for every new piece
+    gboolean searching;
+    gboolean has_hint;
+    struct tetris_placement hint;
+    int cpu_step;                // next action of hint.path the CPU plays, -1 when idle
+    gint64 cpu_next_at;
+    gboolean cpu_played;
+    GtkWidget* restart_button;
+    GtkWidget* versus_toggle;
+    scoreboard_send_fn sender;   // game socket, NULL while disconnected
+    char self[50];
+    gboolean waiting;            // READY sent, the match has not started
+    gboolean versus;             // a match is running
+    gboolean show_opponent;
+    guint64 nonce;
+    gboolean revealed;           // our NONCE is out
+    guint64 opponent_nonce;
+    gboolean opponent_ready;
+    gboolean opponent_revealed;
+    char opponent[50];
+    struct tetris_sim opponent_sim;  // copy of the opponent's game from their inputs
+    struct tetris_versus_stream sent;
+    struct tetris_versus_stream received;
+    struct tetris_input outbox[TETRIS_SIM_QUEUE];  // accepted inputs not sent yet
+    int outbox_count;
+    gint64 last_sent;            // game clock of the last inputs message
+} game;
+
+static volatile int search_cancel = 0;
+
+struct search_job {
+    struct tetris tetris;
+    guint generation;
+    struct tetris_ai_result result;
+};
+
+// Guideline colors, in enum tetris_type order
+static const double piece_colors[TETRIS_TYPES][3] = {
+    { 0.00, 0.80, 0.90 }, { 0.95, 0.85, 0.10 }, { 0.65, 0.25, 0.80 }, { 0.30, 0.80, 0.25 },
+    { 0.90, 0.20, 0.20 }, { 0.15, 0.35, 0.90 }, { 0.95, 0.55, 0.10 },
+};
+
+static void update_labels(void) {
+    char text[96];
+    snprintf(text, sizeof(text), "Score: %u   Lines: %d   Level: %d", game.sim.game.score, game.sim.game.lines, game.sim.game.level);
+    gtk_label_set_text(GTK_LABEL(game.score_label), text);
+    gtk_label_set_text(GTK_LABEL(game.status_label), game.sim.game.over ? "Game over!" : "");
+    game.shown_score = game.sim.game.score;
+    game.shown_lines = game.sim.game.lines;
+}
+
+static void stop_ticking(void) {
+    if (game.tick) {
+        gtk_widget_remove_tick_callback(game.area, game.tick);
+        game.tick = 0;
+    }
+}
+
+static void finish_game(void) {
+    stop_ticking();
+    replay_end(&game.replay, (game.sim.now_us + 999) / 1000);
+    if (!is_guest_mode && username[0] && !game.cpu_played && !game.versus) {
+        gboolean recorded = replay_complete(&game.replay);
+        send_game_score(username, "tetris", (int)game.sim.game.score, recorded ? game.replay.data : NULL,
+            recorded ? game.replay.size : 0);
+    }
+}
+
+static gboolean toggled_on(GtkWidget* toggle) {
+    return gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(toggle));
+}
+
+static gint64 game_clock(void) {
+    return g_get_monotonic_time() - game.start;
+}
+
+// GDK event times are milliseconds on the window system's clock. The
+// smallest difference to our monotonic clock seen so far is taken as the
+// offset between the two, so an event is placed when it happened rather
+// than when it was dispatched. A large jump (clock change, 32-bit
+// wraparound) starts the estimate over.
+static gint64 event_clock(guint32 time) {
+    gint64 now = g_get_monotonic_time();
+    if (time == GDK_CURRENT_TIME) return now - game.start;
+
+    gint64 offset = now - (gint64)time * 1000;
+    if (!game.event_offset_valid || offset < game.event_offset || offset - game.event_offset > EVENT_RESYNC_US) {
+        game.event_offset = offset;
+        game.event_offset_valid = TRUE;
+    }
+    return (gint64)time * 1000 + game.event_offset - game.start;
+}
+
+static void end_versus(const char* status);
+
+static gboolean versus_send(const char* text) {
+    if (!game.sender || game.sender(text) < 0) {
+        end_versus("Connection lost, match over");
+        return FALSE;
+    }
+    return TRUE;
+}
+
+// Send the inputs so far and how far our game has run
+static void versus_flush(void) {
+    char text[TETRIS_VERSUS_MESSAGE];
+    int length = tetris_versus_encode(&game.sent, game.outbox, game.outbox_count, game.sim.now_us / 1000, text, sizeof(text));
+    game.outbox_count = 0;
+    game.last_sent = game_clock();
+    if (length < 0) {
+        fprintf(stderr, "Tetris inputs do not fit a versus message\n");
+        end_versus("Match over, inputs could not be sent");
+        return;
+    }
+    versus_send(text);
+}
+
+// Into the simulation, the replay and, during a match, the outbox. The
+// simulation may move the time; the others get the input as it was applied.
+static void queue_input(struct tetris_input input) {
+    if (!tetris_sim_input(&game.sim, &input)) {
+        fprintf(stderr, "Tetris input queue is full, key %d dropped\n", input.key);
+        return;
+    }
+    // Replays are for games on our own; garbage only comes in a match
+    if (input.key != TETRIS_INPUT_GARBAGE) replay_add(&game.replay, (input.time_us + 999) / 1000, input.key * 2 + input.pressed);
+    if (!game.versus) return;
+    if (game.outbox_count == TETRIS_SIM_QUEUE) versus_flush();
+    if (game.versus) game.outbox[game.outbox_count++] = input;
+}
+
+static void send_input(int key, gboolean pressed, gint64 time) {
+    queue_input((struct tetris_input){ time, (uint8_t)key, pressed != FALSE, 0, 0 });
+}
+
+// Let go of every key the player holds, e.g. when the window loses focus
+static void release_keys(void) {
+    gint64 now = game_clock();
+    for (int key = 0; key < TETRIS_KEYS; key++) {
+        if (game.keys_down[key]) send_input(key, FALSE, now);
+        game.keys_down[key] = FALSE;
+    }
+}
+
+static void request_search(void);
+
+// Runs on the GTK thread
+static gboolean deliver_search(gpointer data) {
+    struct search_job* job = (struct search_job*)data;
+    game.searching = FALSE;
+
+    if (job->generation != game.generation) {
+        // Stale: the piece locked or was held while the search ran
+        request_search();
+    }
+    else if (job->result.found) {
+        game.hint = job->result.best;
+        game.has_hint = TRUE;
+        if (toggled_on(game.cpu_toggle)) {
+            game.cpu_step = 0;
+            game.cpu_next_at = g_get_monotonic_time() + CPU_STEP_MS * 1000;
+        }
+        gtk_widget_queue_draw(game.area);
+    }
+    g_free(job);
+    return FALSE;
+}
+
+static void* search_thread(void* arg) {
+    struct search_job* job = (struct search_job*)arg;
+    tetris_ai_search(&job->tetris, NULL, TRUE, &search_cancel, &job->result);
+    g_idle_add(deliver_search, job);
+    return NULL;
+}
+
+// One search at a time; a stale result asks for the next one
+static void request_search(void) {
+    if (game.searching || game.sim.game.over || game.has_hint) return;
+    if (!toggled_on(game.hint_toggle) && !toggled_on(game.cpu_toggle)) return;
+
+    struct search_job* job = g_new0(struct search_job, 1);
+    job->tetris = game.sim.game;
+    job->generation = game.generation;
+    search_cancel = 0;
+    game.searching = TRUE;
+
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, search_thread, job) != 0) {
+        fprintf(stderr, "Failed to start Tetris search thread\n");
+        game.searching = FALSE;
+        g_free(job);
+        return;
+    }
+    pthread_detach(thread);
+}
+
+// A new piece is in play: earlier hints no longer apply
+static void piece_changed(void) {
+    game.locks = game.sim.locks;
+    game.holds = game.sim.holds;
+    game.generation++;
+    game.has_hint = FALSE;
+    game.cpu_step = -1;
+    if (game.searching) search_cancel = 1;
+    request_search();
+}
+
+// Send the CPU's next action as a key tap. The hard drop is only sent if
+// the piece ended where the search said; otherwise the piece is planned
+// again.
+static void cpu_play_step(void) {
+    static const int keys[] = {
+        [TETRIS_ACTION_LEFT] = TETRIS_KEY_LEFT, [TETRIS_ACTION_RIGHT] = TETRIS_KEY_RIGHT,
+        [TETRIS_ACTION_CW] = TETRIS_KEY_CW, [TETRIS_ACTION_CCW] = TETRIS_KEY_CCW,
+        [TETRIS_ACTION_DOWN] = TETRIS_KEY_SOFT_DROP, [TETRIS_ACTION_DROP] = TETRIS_KEY_HARD_DROP,
+        [TETRIS_ACTION_HOLD] = TETRIS_KEY_HOLD,
+    };
+    int action = game.hint.path[game.cpu_step++];
+    const struct tetris_piece* piece = &game.sim.game.piece;
+    if (action == TETRIS_ACTION_DROP &&
+        (piece->x != game.hint.piece.x || piece->y != game.hint.piece.y || piece->rotation != game.hint.piece.rotation)) {
+        piece_changed();
+        return;
+    }
+
+    gint64 now = game_clock();
+    send_input(keys[action], TRUE, now);
+    send_input(keys[action], FALSE, now);
+    // A hold or the drop changes the piece; the CPU waits for that
+    if (action == TETRIS_ACTION_DROP) game.cpu_step = -1;
+    else if (game.cpu_step >= game.hint.path_length) piece_changed();
+    else game.cpu_next_at += CPU_STEP_MS * 1000;
+}
+
+// Inputs go out in batches, at once when an attack follows them, and at
+// least every heartbeat so the opponent's copy keeps falling
+static void versus_frame(void) {
+    gint64 since = (game_clock() - game.last_sent) / 1000;
+    if ((game.outbox_count && since >= TETRIS_VERSUS_BATCH_MS) || game.sim.attack_count || since >= TETRIS_VERSUS_HEARTBEAT_MS) {
+        versus_flush();
+    }
+    struct tetris_attack attack;
+    while (tetris_sim_take_attack(&game.sim, &attack)) {
+        char text[32];
+        snprintf(text, sizeof(text), "VS A %d %d", attack.lines, attack.hole);
+        if (game.versus && !versus_send(text)) break;
+    }
+}
+
+static gboolean on_frame(GtkWidget* widget, GdkFrameClock* clock, gpointer data) {
+    (void)widget;
+    (void)clock;
+    (void)data;
+    gint64 until = game_clock() - INPUT_SLACK_US;
+    if (until - game.sim.now_us > MAX_CATCHUP_US) {
+        // Frames stopped for a while: carry on from where the game was
+        game.start += until - game.sim.now_us;
+        until = game.sim.now_us;
+    }
+    tetris_sim_advance(&game.sim, until);
+
+    // The CPU's own holds do not change its plan
+    gboolean cpu = toggled_on(game.cpu_toggle);
+    if (game.sim.locks != game.locks || (game.sim.holds != game.holds && !cpu)) piece_changed();
+    game.holds = game.sim.holds;
+
+    if (game.versus) versus_frame();
+    if (game.sim.game.over) {
+        game.tick = 0;
+        update_labels();
+        finish_game();
+        if (game.versus) {
+            versus_flush();
+            if (game.versus && versus_send("VS OVER")) end_versus("You lose!");
+        }
+        gtk_widget_queue_draw(game.area);
+        return FALSE;
+    }
+    if (game.sim.game.score != game.shown_score || game.sim.game.lines != game.shown_lines) update_labels();
+
+    if (cpu && game.has_hint && game.cpu_step >= 0 && game.sim.queue_count == 0 &&
+        g_get_monotonic_time() >= game.cpu_next_at) {
+        cpu_play_step();
+    }
+    gtk_widget_queue_draw(game.area);
+    return TRUE;
+}
+
+static guint64 random_seed(void) {
+    return ((guint64)g_random_int() << 32) | g_random_int();
+}
+
+static void new_game(guint64 seed) {
+    tetris_sim_init(&game.sim, seed);
+    replay_start(&game.replay, REPLAY_TETRIS, 0, seed);
+    game.start = g_get_monotonic_time();
+    for (int key = 0; key < TETRIS_KEYS; key++) game.keys_down[key] = FALSE;
+    game.cpu_played = toggled_on(game.cpu_toggle);
+    tetris_sim_set_gravity(&game.sim, !game.cpu_played);
+    if (!game.tick) game.tick = gtk_widget_add_tick_callback(game.area, on_frame, NULL, NULL);
+    update_labels();
+    piece_changed();
+    gtk_widget_queue_draw(game.area);
+}
+
+// Wider while the opponent's well is shown
+static void set_opponent_shown(gboolean shown) {
+    game.show_opponent = shown;
+    int width = 3 * MARGIN + WELL_PIXELS_W + PANEL_PIXELS + (shown ? OPPONENT_PIXELS : 0);
+    gtk_widget_set_size_request(game.area, width, 2 * MARGIN + WELL_PIXELS_H);
+}
+
+// Both players are ready: the same seed starts both games
+static void start_versus(void) {
+    guint64 seed = game.nonce ^ game.opponent_nonce;
+    gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(game.cpu_toggle), FALSE);
+    gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(game.hint_toggle), FALSE);
+    gtk_widget_set_sensitive(game.cpu_toggle, FALSE);
+    gtk_widget_set_sensitive(game.hint_toggle, FALSE);
+    gtk_widget_set_sensitive(game.restart_button, FALSE);
+
+    game.waiting = FALSE;
+    game.revealed = FALSE;
+    game.opponent_ready = FALSE;
+    game.opponent_revealed = FALSE;
+    game.versus = TRUE;
+    game.sent.last_ms = 0;
+    game.received.last_ms = 0;
+    game.outbox_count = 0;
+    game.last_sent = 0;
+    tetris_sim_init(&game.opponent_sim, seed);
+    set_opponent_shown(TRUE);
+    new_game(seed);
+    gtk_widget_grab_focus(game.area);
+}
+
+// The match ended or was called off; the games stay on screen
+static void end_versus(const char* status) {
+    gboolean was_on = game.versus || game.waiting;
+    game.versus = FALSE;
+    game.waiting = FALSE;
+    game.outbox_count = 0;
+    if (!was_on) return;
+
+    stop_ticking();
+    gtk_widget_set_sensitive(game.cpu_toggle, TRUE);
+    gtk_widget_set_sensitive(game.hint_toggle, TRUE);
+    gtk_widget_set_sensitive(game.restart_button, TRUE);
+    // Not a user action, so the handler has nothing to send
+    gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(game.versus_toggle), FALSE);
+    gtk_label_set_text(GTK_LABEL(game.status_label), status);
+    gtk_widget_queue_draw(game.area);
+}
+
+// Both players are READY, so our nonce can come out; the match starts once
+// the opponent's is out too
+static void reveal_nonce(void) {
+    char text[32];
+    snprintf(text, sizeof(text), "VS NONCE %016llx", (unsigned long long)game.nonce);
+    if (!versus_send(text)) return;
+    game.revealed = TRUE;
+    if (game.opponent_revealed) start_versus();
+}
+
+static void on_versus_toggled(GtkWidget* widget, gpointer data) {
+    (void)data;
+    if (!toggled_on(widget)) {
+        if ((game.versus || game.waiting) && game.sender) game.sender("VS LEAVE");
+        end_versus("Left the match");
+        return;
+    }
+    if (!game.sender) {
+        gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(widget), FALSE);
+        gtk_label_set_text(GTK_LABEL(game.status_label), "Join a game room to play versus");
+        return;
+    }
+
+    char text[16 + TETRIS_VERSUS_COMMITMENT];
+    char commitment[TETRIS_VERSUS_COMMITMENT];
+    game.nonce = random_seed();
+    game.revealed = FALSE;
+    tetris_versus_commitment(game.nonce, commitment);
+    snprintf(text, sizeof(text), "VS READY %s", commitment);
+    if (game.sender(text) < 0) {
+        gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(widget), FALSE);
+        gtk_label_set_text(GTK_LABEL(game.status_label), "Not connected");
+        return;
+    }
+    stop_ticking();
+    game.waiting = TRUE;
+    gtk_label_set_text(GTK_LABEL(game.status_label), "Waiting for an opponent...");
+    if (game.opponent_ready) reveal_nonce();
+}
+
+static void on_hint_toggled(GtkWidget* widget, gpointer data) {
+    (void)widget;
+    (void)data;
+    request_search();
+    gtk_widget_queue_draw(game.area);
+    gtk_widget_grab_focus(game.area);
+}
+
+static void on_cpu_toggled(GtkWidget* widget, gpointer data) {
+    (void)data;
+    if (toggled_on(widget)) {
+        game.cpu_played = TRUE;
+        release_keys();
+        tetris_sim_set_gravity(&game.sim, FALSE);
+        // The player may have moved the piece since the hint was found
+        piece_changed();
+    }
+    else {
+        game.cpu_step = -1;
+        tetris_sim_set_gravity(&game.sim, TRUE);
+    }
+    gtk_widget_grab_focus(game.area);
+}
+
+static int key_for(guint keyval) {
+    switch (keyval) {
+    case GDK_KEY_Left: return TETRIS_KEY_LEFT;
+    case GDK_KEY_Right: return TETRIS_KEY_RIGHT;
+    case GDK_KEY_Up: case GDK_KEY_x: return TETRIS_KEY_CW;
+    case GDK_KEY_z: case GDK_KEY_Control_L: return TETRIS_KEY_CCW;
+    case GDK_KEY_Down: return TETRIS_KEY_SOFT_DROP;
+    case GDK_KEY_space: return TETRIS_KEY_HARD_DROP;
+    case GDK_KEY_c: case GDK_KEY_Shift_L: return TETRIS_KEY_HOLD;
+    default: return -1;
+    }
+}
+
+// Presses and releases; the simulation does the rest at the event's time
+static gboolean on_tetris_key(GtkWidget* widget, GdkEventKey* event, gpointer data) {
+    (void)widget;
+    (void)data;
+    int key = key_for(event->keyval);
+    if (key < 0 || game.sim.game.over || toggled_on(game.cpu_toggle)) return FALSE;
+
+    // Key repeat from the window system sends more presses; DAS replaces it
+    gboolean pressed = event->type == GDK_KEY_PRESS;
+    if (pressed == game.keys_down[key]) return TRUE;
+    game.keys_down[key] = pressed;
+    send_input(key, pressed, event_clock(event->time));
+    return TRUE;
+}
+
+static gboolean on_tetris_focus_out(GtkWidget* widget, GdkEventFocus* event, gpointer data) {
+    (void)widget;
+    (void)event;
+    (void)data;
+    release_keys();
+    return FALSE;
+}
+
+static void draw_cell(cairo_t* cr, double x, double y, double size, const double* color, double alpha) {
+    cairo_set_source_rgba(cr, color[0], color[1], color[2], alpha);
+    cairo_rectangle(cr, x + 1, y + 1, size - 2, size - 2);
+    cairo_fill(cr);
+}
+
+// A piece in its spawn rotation, for the hold and preview boxes
+static void draw_small_piece(cairo_t* cr, int type, double x, double y, double cell) {
+    const uint16_t* shape = tetris_shapes[type][0];
+    for (int r = 0; r < 4; r++) {
+        for (int c = 0; c < 4; c++) {
+            if ((shape[r] >> c) & 1) draw_cell(cr, x + c * cell, y + (3 - r) * cell, cell, piece_colors[type], 1.0);
+        }
+    }
+}
+
+static void draw_piece(cairo_t* cr, struct tetris_piece piece, double alpha) {
+    const uint16_t* shape = tetris_shapes[piece.type][piece.rotation];
+    for (int r = 0; r < 4; r++) {
+        int y = piece.y + r;
+        if (y >= TETRIS_VISIBLE) continue;
+        for (int c = 0; c < 4; c++) {
+            if (!((shape[r] >> c) & 1)) continue;
+            draw_cell(cr, MARGIN + (piece.x + c) * CELL_PIXELS, MARGIN + (TETRIS_VISIBLE - 1 - y) * CELL_PIXELS,
+                CELL_PIXELS, piece_colors[piece.type], alpha);
+        }
+    }
+}
+
+// Where the search would put a piece, as outlines
+static void draw_hint(cairo_t* cr) {
+    struct tetris_piece piece = game.hint.piece;
+    const uint16_t* shape = tetris_shapes[piece.type][piece.rotation];
+    const double* color = piece_colors[piece.type];
+    cairo_set_source_rgb(cr, color[0], color[1], color[2]);
+    cairo_set_line_width(cr, 2);
+    for (int r = 0; r < 4; r++) {
+        int y = piece.y + r;
+        if (y >= TETRIS_VISIBLE) continue;
+        for (int c = 0; c < 4; c++) {
+            if (!((shape[r] >> c) & 1)) continue;
+            cairo_rectangle(cr, MARGIN + (piece.x + c) * CELL_PIXELS + 3, MARGIN + (TETRIS_VISIBLE - 1 - y) * CELL_PIXELS + 3,
+                CELL_PIXELS - 6, CELL_PIXELS - 6);
+        }
+    }
+    cairo_stroke(cr);
+}
+
+// Garbage on its way in, as a bar in the left margin
+static void draw_pending(cairo_t* cr, const struct tetris_sim* sim, double x, double bottom, double cell, double width) {
+    int lines = sim->pending_total < TETRIS_VISIBLE ? sim->pending_total : TETRIS_VISIBLE;
+    if (!lines) return;
+    cairo_set_source_rgb(cr, 0.90, 0.20, 0.20);
+    cairo_rectangle(cr, x, bottom - lines * cell, width, lines * cell);
+    cairo_fill(cr);
+}
+
+// The opponent's game as our copy has it, at half size
+static void draw_opponent(cairo_t* cr, const double* locked_color) {
+    const struct tetris* opponent = &game.opponent_sim.game;
+    double left = 3 * MARGIN + WELL_PIXELS_W + PANEL_PIXELS;
+    double height = TETRIS_VISIBLE * OPPONENT_CELL;
+    cairo_set_source_rgb(cr, 0.05, 0.05, 0.06);
+    cairo_rectangle(cr, left, MARGIN, TETRIS_WIDTH * OPPONENT_CELL, height);
+    cairo_fill(cr);
+
+    for (int y = 0; y < TETRIS_VISIBLE; y++) {
+        for (int x = 0; x < TETRIS_WIDTH; x++) {
+            if (tetris_cell(&opponent->well, x, y)) {
+                draw_cell(cr, left + x * OPPONENT_CELL, MARGIN + (TETRIS_VISIBLE - 1 - y) * OPPONENT_CELL, OPPONENT_CELL, locked_color, 1.0);
+            }
+        }
+    }
+    if (!opponent->over) {
+        struct tetris_piece piece = opponent->piece;
+        const uint16_t* shape = tetris_shapes[piece.type][piece.rotation];
+        for (int r = 0; r < 4; r++) {
+            int y = piece.y + r;
+            if (y >= TETRIS_VISIBLE) continue;
+            for (int c = 0; c < 4; c++) {
+                if (!((shape[r] >> c) & 1)) continue;
+                draw_cell(cr, left + (piece.x + c) * OPPONENT_CELL, MARGIN + (TETRIS_VISIBLE - 1 - y) * OPPONENT_CELL,
+                    OPPONENT_CELL, piece_colors[piece.type], 1.0);
+            }
+        }
+    }
+    draw_pending(cr, &game.opponent_sim, left - 5, MARGIN + height, OPPONENT_CELL, 3);
+
+    char text[96];
+    cairo_set_source_rgb(cr, 0.85, 0.85, 0.85);
+    cairo_set_font_size(cr, 14);
+    cairo_move_to(cr, left, MARGIN + height + 20);
+    cairo_show_text(cr, game.opponent);
+    snprintf(text, sizeof(text), "Score: %u  Lines: %d", opponent->score, opponent->lines);
+    cairo_set_font_size(cr, 12);
+    cairo_move_to(cr, left, MARGIN + height + 38);
+    cairo_show_text(cr, text);
+}
+
+static gboolean on_tetris_draw(GtkWidget* widget, cairo_t* cr, gpointer data) {
+    (void)widget;
+    (void)data;
+    static const double locked_color[3] = { 0.55, 0.55, 0.60 };
+
+    cairo_set_source_rgb(cr, 0.12, 0.12, 0.14);
+    cairo_paint(cr);
+    cairo_set_source_rgb(cr, 0.05, 0.05, 0.06);
+    cairo_rectangle(cr, MARGIN, MARGIN, WELL_PIXELS_W, WELL_PIXELS_H);
+    cairo_fill(cr);
+
+    // The well keeps no piece types, so locked cells share one color
+    for (int y = 0; y < TETRIS_VISIBLE; y++) {
+        for (int x = 0; x < TETRIS_WIDTH; x++) {
+            if (tetris_cell(&game.sim.game.well, x, y)) {
+                draw_cell(cr, MARGIN + x * CELL_PIXELS, MARGIN + (TETRIS_VISIBLE - 1 - y) * CELL_PIXELS, CELL_PIXELS, locked_color, 1.0);
+            }
+        }
+    }
+
+    draw_pending(cr, &game.sim, 2, MARGIN + WELL_PIXELS_H, CELL_PIXELS, MARGIN - 4);
+
+    if (!game.sim.game.over) {
+        struct tetris_piece ghost = game.sim.game.piece;
+        ghost.y = (int8_t)tetris_ghost_y(&game.sim.game);
+        draw_piece(cr, ghost, 0.25);
+        if (game.has_hint && toggled_on(game.hint_toggle)) draw_hint(cr);
+        draw_piece(cr, game.sim.game.piece, 1.0);
+    }
+
+    double panel_x = 2 * MARGIN + WELL_PIXELS_W;
+    double small = CELL_PIXELS * 0.6;
+    cairo_set_source_rgb(cr, 0.85, 0.85, 0.85);
+    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
+    cairo_set_font_size(cr, 14);
+    cairo_move_to(cr, panel_x, MARGIN + 14);
+    cairo_show_text(cr, "Hold");
+    if (game.sim.game.hold >= 0) draw_small_piece(cr, game.sim.game.hold, panel_x, MARGIN + 20, small);
+
+    cairo_set_source_rgb(cr, 0.85, 0.85, 0.85);
+    cairo_move_to(cr, panel_x, MARGIN + 20 + 5 * small);
+    cairo_show_text(cr, "Next");
+    for (int i = 0; i < TETRIS_PREVIEW; i++) {
+        draw_small_piece(cr, game.sim.game.queue[i], panel_x, MARGIN + 26 + (5 + 3 * i) * small, small);
+    }
+    if (game.show_opponent) draw_opponent(cr, locked_color);
+    return FALSE;
+}
+
+static void on_new_game(GtkWidget* widget, gpointer data) {
+    (void)widget;
+    (void)data;
+    set_opponent_shown(FALSE);
+    new_game(random_seed());
+    gtk_widget_grab_focus(game.area);
+}
+
+void start_tetris_game(GtkWidget* widget, gpointer data) {
+    (void)widget;
+    // A match keeps running while other screens are shown
+    if (!game.versus && !game.waiting) {
+        set_opponent_shown(FALSE);
+        new_game(random_seed());
+    }
+    gtk_stack_set_visible_child_name(GTK_STACK(data), "tetris");
+    gtk_widget_grab_focus(game.area);
+}
+
+GtkWidget* create_tetris_screen(GtkStack* stack) {
+    GtkWidget* box = gtk_box_new(GTK_ORIENTATION_VERTICAL, 6);
+    gtk_container_set_border_width(GTK_CONTAINER(box), 10);
+
+    GtkWidget* toolbar = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 6);
+    game.score_label = gtk_label_new("");
+    gtk_box_pack_start(GTK_BOX(toolbar), game.score_label, FALSE, FALSE, 0);
+    game.restart_button = gtk_button_new_with_label("New game");
+    g_signal_connect(game.restart_button, "clicked", G_CALLBACK(on_new_game), NULL);
+    gtk_box_pack_end(GTK_BOX(toolbar), game.restart_button, FALSE, FALSE, 0);
+    game.versus_toggle = gtk_toggle_button_new_with_label("Versus");
+    g_signal_connect(game.versus_toggle, "toggled", G_CALLBACK(on_versus_toggled), NULL);
+    gtk_box_pack_end(GTK_BOX(toolbar), game.versus_toggle, FALSE, FALSE, 0);
+    game.cpu_toggle = gtk_toggle_button_new_with_label("CPU");
+    g_signal_connect(game.cpu_toggle, "toggled", G_CALLBACK(on_cpu_toggled), NULL);
+    gtk_box_pack_end(GTK_BOX(toolbar), game.cpu_toggle, FALSE, FALSE, 0);
+    game.hint_toggle = gtk_toggle_button_new_with_label("Hint");
+    g_signal_connect(game.hint_toggle, "toggled", G_CALLBACK(on_hint_toggled), NULL);
+    gtk_box_pack_end(GTK_BOX(toolbar), game.hint_toggle, FALSE, FALSE, 0);
+    game.status_label = gtk_label_new("");
+    gtk_box_pack_end(GTK_BOX(toolbar), game.status_label, FALSE, FALSE, 0);
+    gtk_box_pack_start(GTK_BOX(box), toolbar, FALSE, FALSE, 0);
+
+    game.area = gtk_drawing_area_new();
+    gtk_widget_set_size_request(game.area, 3 * MARGIN + WELL_PIXELS_W + PANEL_PIXELS, 2 * MARGIN + WELL_PIXELS_H);
+    gtk_widget_set_can_focus(game.area, TRUE);
+    gtk_widget_add_events(game.area, GDK_KEY_PRESS_MASK | GDK_KEY_RELEASE_MASK | GDK_FOCUS_CHANGE_MASK);
+    g_signal_connect(game.area, "draw", G_CALLBACK(on_tetris_draw), NULL);
+    g_signal_connect(game.area, "key-press-event", G_CALLBACK(on_tetris_key), NULL);
+    g_signal_connect(game.area, "key-release-event", G_CALLBACK(on_tetris_key), NULL);
+    g_signal_connect(game.area, "focus-out-event", G_CALLBACK(on_tetris_focus_out), NULL);
+    gtk_box_pack_start(GTK_BOX(box), game.area, FALSE, FALSE, 0);
+
+    gtk_stack_add_named(stack, box, "tetris");
+    tetris_sim_init(&game.sim, random_seed());
+    game.cpu_step = -1;
+    update_labels();
+    return box;
+}
+
+void tetris_set_versus_sender(scoreboard_send_fn send, const char* self) {
+    game.sender = send;
+    g_strlcpy(game.self, self ? self : "", sizeof(game.self));
+    game.opponent_ready = FALSE;
+    game.opponent_revealed = FALSE;
+    if (!send) end_versus("Disconnected, match over");
+}
+
+static void versus_inputs(const char* text) {
+    static struct tetris_input inputs[TETRIS_VERSUS_MESSAGE / 2];
+    int64_t upto;
+    int count = tetris_versus_decode(&game.received, text, &upto, inputs, TETRIS_VERSUS_MESSAGE / 2);
+    if (count < 0 || !tetris_versus_feed(&game.opponent_sim, inputs, count, upto)) {
+        fprintf(stderr, "Bad versus inputs from %s: %s\n", game.opponent, text);
+        return;
+    }
+    gtk_widget_queue_draw(game.area);
+}
+
+void tetris_versus_message(const char* message) {
+    char room[64], user[50];
+    const char* text;
+    if (!tetris_versus_split(message, room, sizeof(room), user, sizeof(user), &text) || strncmp(text, "VS ", 3) != 0) return;
+    text += 3;
+
+    // Verdicts come from the server
+    if (strncmp(text, "REJECT ", 7) == 0) {
+        char status[96];
+        snprintf(status, sizeof(status), "Match stopped: %s", text + 7);
+        end_versus(status);
+        return;
+    }
+    if (strncmp(text, "RESULT ", 7) == 0) {
+        if (game.versus) end_versus(strcmp(text + 7, game.self) == 0 ? "You win!" : "You lose!");
+        return;
+    }
+    // The server may echo our own messages
+    if (strcmp(user, game.self) == 0) return;
+
+    gboolean from_opponent = strcmp(user, game.opponent) == 0;
+    if (strncmp(text, "READY ", 6) == 0) {
+        if (game.versus && !from_opponent) return;
+        g_strlcpy(game.opponent, user, sizeof(game.opponent));
+        game.opponent_ready = TRUE;
+        game.opponent_revealed = FALSE;
+        if (game.waiting && !game.revealed) reveal_nonce();
+        return;
+    }
+    // The server relays a nonce only once both players are READY, and only
+    // if it matches its READY
+    if (strncmp(text, "NONCE ", 6) == 0) {
+        unsigned long long nonce;
+        if (!game.waiting || sscanf(text + 6, "%16llx", &nonce) != 1) return;
+        g_strlcpy(game.opponent, user, sizeof(game.opponent));
+        game.opponent_ready = TRUE;
+        game.opponent_nonce = nonce;
+        game.opponent_revealed = TRUE;
+        if (game.revealed) start_versus();
+        else reveal_nonce();
+        return;
+    }
+    if (!from_opponent) return;
+    if (strcmp(text, "LEAVE") == 0) {
+        game.opponent_ready = FALSE;
+        game.opponent_revealed = FALSE;
+        end_versus("Your opponent left");
+        return;
+    }
+    if (!game.versus) return;
+
+    if (strncmp(text, "I ", 2) == 0) {
+        versus_inputs(text + 2);
+    }
+    else if (strncmp(text, "A ", 2) == 0) {
+        // Garbage lands where our game is now and goes back as an input
+        int lines, hole;
+        if (sscanf(text + 2, "%d %d", &lines, &hole) != 2 || lines <= 0 || lines > TETRIS_HEIGHT || hole < 0 || hole >= TETRIS_WIDTH) return;
+        queue_input((struct tetris_input){ game_clock(), TETRIS_INPUT_GARBAGE, false, (uint8_t)lines, (uint8_t)hole });
+    }
+    else if (strcmp(text, "OVER") == 0) {
+        end_versus("You win!");
+    }
+}
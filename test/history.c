@@ -0,0 +1,141 @@
+// Undo/redo history (see history.h).
+//
+// A record is framed as [u16 size][payload][u16 size] so the ring can be
+// walked from either end: undo reads the size just before the cursor, redo
+// the size at it. Frames may wrap around the end of the buffer.
+#include <stdlib.h>
+#include <string.h>
+
+#include "history.h"
+
+#define FRAME_OVERHEAD 4
+#define DELTA_PAIR 3                 // u16 cell index, u8 XOR
+
+static void ring_write(struct history* history, size_t offset, const void* data, size_t size) {
+    size_t first = history->capacity - offset;
+    if (first > size) first = size;
+    memcpy(history->buffer + offset, data, first);
+    memcpy(history->buffer, (const uint8_t*)data + first, size - first);
+}
+
+static void ring_read(const struct history* history, size_t offset, void* data, size_t size) {
+    size_t first = history->capacity - offset;
+    if (first > size) first = size;
+    memcpy(data, history->buffer + offset, first);
+    memcpy((uint8_t*)data + first, history->buffer, size - first);
+}
+
+static size_t ring_offset(const struct history* history, size_t offset, size_t add) {
+    offset += add;
+    return offset >= history->capacity ? offset - history->capacity : offset;
+}
+
+static size_t ring_back(const struct history* history, size_t offset, size_t sub) {
+    return offset >= sub ? offset - sub : offset + history->capacity - sub;
+}
+
+static size_t read_size(const struct history* history, size_t offset) {
+    uint8_t bytes[2];
+    ring_read(history, offset, bytes, 2);
+    return bytes[0] | ((size_t)bytes[1] << 8);
+}
+
+int history_init(struct history* history, size_t capacity) {
+    memset(history, 0, sizeof(*history));
+    history->buffer = (uint8_t*)malloc(capacity);
+    if (!history->buffer) return -1;
+    history->capacity = capacity;
+    return 0;
+}
+
+void history_free(struct history* history) {
+    free(history->buffer);
+    memset(history, 0, sizeof(*history));
+}
+
+void history_clear(struct history* history) {
+    history->head = history->cursor = history->tail = 0;
+    history->used = 0;
+    history->undo_count = history->redo_count = 0;
+}
+
+// Drop the records past the cursor
+static void drop_redo(struct history* history) {
+    if (history->redo_count == 0) return;
+    // cursor == tail with records to redo means they fill the whole ring
+    size_t redo_bytes = history->tail > history->cursor ? history->tail - history->cursor
+        : history->tail + history->capacity - history->cursor;
+    history->used -= redo_bytes;
+    history->tail = history->cursor;
+    history->redo_count = 0;
+}
+
+static void drop_oldest(struct history* history) {
+    size_t frame = read_size(history, history->head) + FRAME_OVERHEAD;
+    history->head = ring_offset(history, history->head, frame);
+    history->used -= frame;
+    history->undo_count--;
+}
+
+int history_push(struct history* history, const void* record, size_t size) {
+    size_t frame = size + FRAME_OVERHEAD;
+    if (size == 0 || size > HISTORY_MAX_RECORD || frame > history->capacity) return -1;
+
+    drop_redo(history);
+    while (history->used + frame > history->capacity) drop_oldest(history);
+
+    uint8_t header[2] = { (uint8_t)size, (uint8_t)(size >> 8) };
+    ring_write(history, history->tail, header, 2);
+    ring_write(history, ring_offset(history, history->tail, 2), record, size);
+    ring_write(history, ring_offset(history, history->tail, 2 + size), header, 2);
+    history->tail = ring_offset(history, history->tail, frame);
+    history->cursor = history->tail;
+    history->used += frame;
+    history->undo_count++;
+    return 0;
+}
+
+size_t history_undo(struct history* history, void* out, size_t out_size) {
+    if (history->undo_count == 0) return 0;
+    size_t size = read_size(history, ring_back(history, history->cursor, 2));
+    if (size > out_size) return 0;
+
+    size_t start = ring_back(history, history->cursor, size + FRAME_OVERHEAD);
+    ring_read(history, ring_offset(history, start, 2), out, size);
+    history->cursor = start;
+    history->undo_count--;
+    history->redo_count++;
+    return size;
+}
+
+size_t history_redo(struct history* history, void* out, size_t out_size) {
+    if (history->redo_count == 0) return 0;
+    size_t size = read_size(history, history->cursor);
+    if (size > out_size) return 0;
+
+    ring_read(history, ring_offset(history, history->cursor, 2), out, size);
+    history->cursor = ring_offset(history, history->cursor, size + FRAME_OVERHEAD);
+    history->undo_count++;
+    history->redo_count--;
+    return size;
+}
+
+int history_encode_delta(const uint8_t* before, const uint8_t* after, size_t cells, uint8_t* out, size_t out_size) {
+    size_t size = 0;
+    for (size_t i = 0; i < cells && i <= 0xFFFF; i++) {
+        uint8_t change = before[i] ^ after[i];
+        if (!change) continue;
+        if (size + DELTA_PAIR > out_size) return -1;
+        out[size++] = (uint8_t)i;
+        out[size++] = (uint8_t)(i >> 8);
+        out[size++] = change;
+    }
+    return (int)size;
+}
+
+void history_apply_delta(const uint8_t* delta, size_t size, uint8_t* cells, size_t cells_count) {
+    for (size_t i = 0; i + DELTA_PAIR <= size; i += DELTA_PAIR) {
+        size_t cell = delta[i] | ((size_t)delta[i + 1] << 8);
+        if (cell < cells_count) cells[cell] ^= delta[i + 2];
+    }
+}
@@ -0,0 +1,188 @@
+// Shared HTTP client (see http_client.h)
+#include <glib.h>
+#include <pthread.h>
+#include <stdio.h>
+
+#include "http_client.h"
+
+#define HTTP_CONNECT_TIMEOUT_SECONDS 5L
+#define HTTP_DNS_CACHE_SECONDS 300L
+#define HTTP_MAX_HOST_CONNECTIONS 4L
+
+struct http_job {
+    CURL* easy;
+    http_done_fn done;
+    void* user_data;
+};
+
+static CURLSH* share_handle = NULL;
+static CURLM* multi_handle = NULL;
+static GAsyncQueue* submitted = NULL;
+static pthread_t io_thread;
+static pthread_once_t init_once = PTHREAD_ONCE_INIT;
+static int io_started = 0;
+static volatile int io_stop = 0;
+
+static pthread_mutex_t share_locks[CURL_LOCK_DATA_LAST];
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct http_client_stats stats;
+
+static void share_lock(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr) {
+    (void)handle;
+    (void)access;
+    (void)userptr;
+    pthread_mutex_lock(&share_locks[data]);
+}
+
+static void share_unlock(CURL* handle, curl_lock_data data, void* userptr) {
+    (void)handle;
+    (void)userptr;
+    pthread_mutex_unlock(&share_locks[data]);
+}
+
+// A transfer that opened no connection of its own was served by the cache
+static void account(CURL* easy, CURLcode result) {
+    long connects = 0;
+    long version = 0;
+    curl_easy_getinfo(easy, CURLINFO_NUM_CONNECTS, &connects);
+    curl_easy_getinfo(easy, CURLINFO_HTTP_VERSION, &version);
+
+    pthread_mutex_lock(&stats_lock);
+    stats.requests++;
+    if (result != CURLE_OK) stats.failures++;
+    if (connects > 0) stats.connections_opened++;
+    else if (result == CURLE_OK) stats.connections_reused++;
+    if (version == CURL_HTTP_VERSION_2_0) stats.http2_requests++;
+    pthread_mutex_unlock(&stats_lock);
+}
+
+static void* http_io_thread(void* arg) {
+    (void)arg;
+    while (!io_stop) {
+        struct http_job* job;
+        while ((job = (struct http_job*)g_async_queue_try_pop(submitted))) {
+            curl_easy_setopt(job->easy, CURLOPT_PRIVATE, (void*)job);
+            curl_multi_add_handle(multi_handle, job->easy);
+        }
+
+        int running = 0;
+        curl_multi_perform(multi_handle, &running);
+
+        CURLMsg* msg;
+        int left;
+        while ((msg = curl_multi_info_read(multi_handle, &left))) {
+            if (msg->msg != CURLMSG_DONE) continue;
+
+            CURL* easy = msg->easy_handle;
+            CURLcode result = msg->data.result;
+            long status = 0;
+            job = NULL;
+            curl_easy_getinfo(easy, CURLINFO_PRIVATE, (char**)&job);
+            curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &status);
+            account(easy, result);
+
+            curl_multi_remove_handle(multi_handle, easy);
+            if (job->done) job->done(easy, result, status, job->user_data);
+            curl_easy_cleanup(easy);
+            g_free(job);
+        }
+
+        // Sleeps until a socket is ready or http_client_submit() wakes us
+        curl_multi_poll(multi_handle, NULL, 0, 1000, NULL);
+    }
+    return NULL;
+}
+
+static void http_client_init(void) {
+    curl_global_init(CURL_GLOBAL_DEFAULT);
+    submitted = g_async_queue_new();
+
+    for (int i = 0; i < CURL_LOCK_DATA_LAST; i++) {
+        pthread_mutex_init(&share_locks[i], NULL);
+    }
+    share_handle = curl_share_init();
+    curl_share_setopt(share_handle, CURLSHOPT_LOCKFUNC, share_lock);
+    curl_share_setopt(share_handle, CURLSHOPT_UNLOCKFUNC, share_unlock);
+    curl_share_setopt(share_handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(share_handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    // Safe because every transfer is performed on the one I/O thread
+    curl_share_setopt(share_handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+
+    multi_handle = curl_multi_init();
+    if (!multi_handle) {
+        fprintf(stderr, "Failed to create HTTP client\n");
+        return;
+    }
+    curl_multi_setopt(multi_handle, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+    curl_multi_setopt(multi_handle, CURLMOPT_MAX_HOST_CONNECTIONS, HTTP_MAX_HOST_CONNECTIONS);
+
+    if (pthread_create(&io_thread, NULL, http_io_thread, NULL) != 0) {
+        fprintf(stderr, "Failed to start HTTP client thread\n");
+        return;
+    }
+    io_started = 1;
+}
+
+CURL* http_client_easy_new(const char* url) {
+    pthread_once(&init_once, http_client_init);
+
+    CURL* easy = curl_easy_init();
+    if (!easy) return NULL;
+
+    curl_easy_setopt(easy, CURLOPT_URL, url);
+    curl_easy_setopt(easy, CURLOPT_SHARE, share_handle);
+    curl_easy_setopt(easy, CURLOPT_DNS_CACHE_TIMEOUT, HTTP_DNS_CACHE_SECONDS);
+    curl_easy_setopt(easy, CURLOPT_CONNECTTIMEOUT, HTTP_CONNECT_TIMEOUT_SECONDS);
+    curl_easy_setopt(easy, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(easy, CURLOPT_NOSIGNAL, 1L);
+    // HTTP/2 over TLS when offered, HTTP/1.1 keep-alive otherwise; PIPEWAIT
+    // prefers waiting for a multiplexed stream over opening a new connection
+    curl_easy_setopt(easy, CURLOPT_HTTP_VERSION, (long)CURL_HTTP_VERSION_2TLS);
+    curl_easy_setopt(easy, CURLOPT_PIPEWAIT, 1L);
+    // Offer every encoding curl was built with; bodies are inflated as they
+    // stream in, so write callbacks still see plain data
+    curl_easy_setopt(easy, CURLOPT_ACCEPT_ENCODING, "");
+    return easy;
+}
+
+int http_client_submit(CURL* easy, http_done_fn done, void* user_data) {
+    pthread_once(&init_once, http_client_init);
+    if (!io_started) return -1;
+
+    struct http_job* job = g_new0(struct http_job, 1);
+    job->easy = easy;
+    job->done = done;
+    job->user_data = user_data;
+    g_async_queue_push(submitted, job);
+    curl_multi_wakeup(multi_handle);
+    return 0;
+}
+
+void http_client_get_stats(struct http_client_stats* out) {
+    pthread_mutex_lock(&stats_lock);
+    *out = stats;
+    pthread_mutex_unlock(&stats_lock);
+}
+
+void http_client_log_stats(void) {
+    struct http_client_stats s;
+    http_client_get_stats(&s);
+    printf("HTTP client: %ld requests, %ld reused connections, %ld new connections, %ld over HTTP/2, %ld failed\n",
+        s.requests, s.connections_reused, s.connections_opened, s.http2_requests, s.failures);
+}
+
+// Stop the I/O thread; transfers still in flight are dropped
+void http_client_shutdown(void) {
+    if (!io_started) return;
+
+    io_stop = 1;
+    curl_multi_wakeup(multi_handle);
+    pthread_join(io_thread, NULL);
+    io_started = 0;
+    http_client_log_stats();
+
+    curl_multi_cleanup(multi_handle);
+    curl_share_cleanup(share_handle);
+    multi_handle = NULL;
+    share_handle = NULL;
+}
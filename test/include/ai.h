@@ -0,0 +1,28 @@
+#ifndef AI_H
+#define AI_H
+
+// Computer opponent for the m,n,k games in mnk.h. 3x3 Tic-Tac-Toe is answered
+// from a perfect-play table; larger boards use an iterative-deepening
+// alpha-beta search with a Zobrist-hashed transposition table.
+
+#include "mnk.h"
+
+struct ai_result {
+    int cell;          // chosen cell (row * cols + col), -1 if there is no legal move
+    int score;         // score for the side to move, AI_WIN_SCORE range means a forced win
+    int depth;         // deepest fully searched iteration
+    long long nodes;
+};
+
+#define AI_WIN_SCORE 1000000
+
+// Best move and game value for a 3x3 position (value: 1 win, 0 draw, -1 loss
+// for the side to move). Returns -1 when the game is already over.
+int ai_ttt_best_move(const struct mnk_board* board, int* value);
+
+// Blocking search, meant to run on a worker thread. It stops once
+// time_budget_ms has elapsed or *cancel becomes non-zero, and reports the best
+// move of the last completed iteration.
+int ai_search(const struct mnk_board* board, int time_budget_ms, volatile int* cancel, struct ai_result* result);
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef AI_POOL_H
+#define AI_POOL_H
+
+// Worker pool and clock shared by the game AIs (g2048_ai.h, tetris_ai.h).
+//
+// Each AI keeps one static pool. Its threads start with the first batch and
+// live until ai_pool_shutdown; each has scratch space of its own (a
+// transposition table, BFS buffers) that is made before the thread starts
+// and freed after it is joined. A batch is an array of jobs of one size;
+// ai_pool_run queues it and waits until every job has run. Searches on
+// several threads may run batches at once, they are served in order.
+
+#include <pthread.h>
+#include <stddef.h>
+
+#define AI_POOL_MAX_WORKERS 8
+
+struct ai_batch;
+struct ai_pool;
+
+struct ai_worker {
+    struct ai_pool* pool;
+    pthread_t thread;
+    void* scratch;
+};
+
+struct ai_pool {
+    int worker_count;
+    void* (*scratch_new)(void);              // NULL when out of memory
+    void (*scratch_free)(void* scratch);     // also given NULL
+    void (*run)(void* scratch, void* job);
+
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t done;
+    struct ai_batch* head;
+    struct ai_batch* tail;
+    struct ai_worker workers[AI_POOL_MAX_WORKERS];
+    int started;                             // threads running
+    volatile int stopping;
+};
+
+#define AI_POOL_INIT(count, make, release, job_fn) { \
+    .worker_count = (count), .scratch_new = (make), .scratch_free = (release), .run = (job_fn), \
+    .lock = PTHREAD_MUTEX_INITIALIZER, .work = PTHREAD_COND_INITIALIZER, .done = PTHREAD_COND_INITIALIZER, \
+}
+
+// Run count jobs of size bytes each and wait for all of them. Returns -1,
+// without running any, if the pool could not start.
+int ai_pool_run(struct ai_pool* pool, void* jobs, size_t size, int count);
+
+// True while the pool shuts down; jobs should give up early
+int ai_pool_stopping(const struct ai_pool* pool);
+
+// Join the threads and free their scratch; jobs already queued still run
+void ai_pool_shutdown(struct ai_pool* pool);
+
+long long ai_monotonic_us(void);
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef AUTH_H
+#define AUTH_H
+
+// Login session of the client (login.c).
+//
+// Logging in or signing up returns a signed JWT from the auth service. The
+// client keeps it in memory and in the user config directory, and sends it
+// as a bearer token with score uploads and the game WebSocket handshake;
+// the game server verifies it locally (jwt.h), so neither waits on the auth
+// service. The token is renewed in the background AUTH_REFRESH_MARGIN_SECONDS
+// before it expires.
+
+#include <glib.h>
+
+#define AUTH_URL "http://192.168.55.239:8080/auth"
+#define AUTH_TIMEOUT_SECONDS 10L
+#define AUTH_REFRESH_MARGIN_SECONDS 300
+#define AUTH_RETRY_SECONDS 30
+
+// Restore the cached session and schedule its refresh; GTK thread
+void auth_init(void);
+
+// Current token, g_free() it; NULL for guests or once it has expired. Any thread.
+char* auth_token_dup(void);
+
+// A server refused the token; refresh it now. Any thread.
+void auth_token_rejected(void);
+
+// Forget the session and switch to guest mode; GTK thread
+void auth_logout(void);
+
+#endif
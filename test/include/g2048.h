@@ -0,0 +1,80 @@
+#ifndef G2048_H
+#define G2048_H
+
+// 2048 rules engine shared by the client, the hint AI, bots and replay
+// verification.
+//
+// The whole 4x4 board is one 64-bit word with a 4-bit tile exponent per
+// cell: cell (row, col) is the nibble at bit 16 * row + 4 * col, 0 is an
+// empty cell and e is the tile 2^e. Every possible 16-bit row has its
+// left and right move precomputed in 65,536-entry tables. A horizontal move
+// is then four lookups, and a vertical one is the same after transposing
+// the board, so a move costs a handful of shifts and table reads.
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define G2048_SIZE 4
+#define G2048_ROWS 65536
+#define G2048_MAX_EXPONENT 15        // 32768; two of them do not merge
+
+typedef uint64_t g2048_board;
+
+enum g2048_move { G2048_LEFT = 0, G2048_RIGHT, G2048_UP, G2048_DOWN };
+
+// Row move tables, filled by g2048_tables_init(). Scores are the points a
+// move of that row earns (the sum of the merged tiles).
+struct g2048_tables {
+    uint16_t left[G2048_ROWS];
+    uint16_t right[G2048_ROWS];
+    uint32_t score_left[G2048_ROWS];
+    uint32_t score_right[G2048_ROWS];
+};
+
+extern struct g2048_tables g2048_tables;
+
+// Build the tables; safe to call from any thread, any number of times
+void g2048_tables_init(void);
+
+// The board after a move; equal to board when the move changes nothing.
+// The points earned go to *score when it is not NULL.
+g2048_board g2048_move(g2048_board board, enum g2048_move move, uint32_t* score);
+
+bool g2048_can_move(g2048_board board);
+
+// Put a new tile on an empty cell picked by random: a 2 nine times in ten,
+// otherwise a 4. Returns board unchanged when it is full.
+g2048_board g2048_spawn(g2048_board board, uint32_t random);
+
+int g2048_empty_count(g2048_board board);
+int g2048_max_exponent(g2048_board board);
+uint32_t g2048_tile_sum(g2048_board board);
+
+const char* g2048_move_name(enum g2048_move move);
+
+static inline int g2048_cell(g2048_board board, int row, int col) {
+    return (int)((board >> (16 * row + 4 * col)) & 0xF);
+}
+
+static inline g2048_board g2048_set_cell(g2048_board board, int row, int col, int exponent) {
+    int shift = 16 * row + 4 * col;
+    return (board & ~((g2048_board)0xF << shift)) | ((g2048_board)(exponent & 0xF) << shift);
+}
+
+static inline uint16_t g2048_row(g2048_board board, int row) {
+    return (uint16_t)(board >> (16 * row));
+}
+
+// Swap rows and columns: nibble (r, c) moves to (c, r)
+static inline g2048_board g2048_transpose(g2048_board x) {
+    g2048_board a1 = x & 0xF0F00F0FF0F00F0FULL;
+    g2048_board a2 = x & 0x0000F0F00000F0F0ULL;
+    g2048_board a3 = x & 0x0F0F00000F0F0000ULL;
+    g2048_board a = a1 | (a2 << 12) | (a3 >> 12);
+    g2048_board b1 = a & 0xFF00FF0000FF00FFULL;
+    g2048_board b2 = a & 0x00FF00FF00000000ULL;
+    g2048_board b3 = a & 0x00000000FF00FF00ULL;
+    return b1 | (b2 >> 24) | (b3 << 24);
+}
+
+#endif
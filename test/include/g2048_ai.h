@@ -0,0 +1,44 @@
+#ifndef G2048_AI_H
+#define G2048_AI_H
+
+// Expectimax player for 2048 (g2048.h), used for hints, autoplay and bots.
+//
+// Max nodes try the four moves, chance nodes average over every empty cell
+// getting a 2 (p = 0.9) or a 4 (p = 0.1). Leaves are scored from a
+// precomputed heuristic for each of the 65,536 rows, summed over the rows
+// and columns. Chance nodes are cached per worker in a transposition table,
+// and branches less likely than G2048_AI_MIN_PROBABILITY are cut off.
+//
+// The search deepens iteratively. In each iteration the subtrees of the
+// root moves run in parallel on a pool of G2048_AI_WORKERS threads that is
+// shared by all searches.
+
+#include "g2048.h"
+
+#define G2048_AI_WORKERS 4           // one per root move
+#define G2048_AI_MAX_DEPTH 12
+#define G2048_AI_MIN_PROBABILITY 0.0001
+#define G2048_AI_TT_BITS 18          // 256K entries, 4 MB per worker
+
+struct g2048_ai_result {
+    int move;                  // enum g2048_move, -1 when no move is possible
+    double value;              // expected heuristic value of that move
+    int depth;                 // deepest fully searched iteration
+    long long nodes;
+    long long elapsed_us;
+    double nodes_per_second;
+};
+
+// Blocking search, meant to run on a worker thread. It deepens up to
+// max_depth and stops early once time_budget_ms (0 for no limit) has elapsed
+// or *cancel becomes non-zero; the move of the last completed iteration is
+// reported. Returns result->move.
+int g2048_ai_search(g2048_board board, int max_depth, int time_budget_ms, volatile int* cancel, struct g2048_ai_result* result);
+
+// Static evaluation of a position, the value of a search leaf
+double g2048_ai_evaluate(g2048_board board);
+
+// Stop the worker pool; searches still running are aborted
+void g2048_ai_shutdown(void);
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef G2048_BIG_H
+#define G2048_BIG_H
+
+// 2048 on boards larger than 4x4 (up to 8x8), which do not fit the 64-bit
+// board and row tables of g2048.h.
+//
+// A board is a 16-byte vector per row holding one tile exponent per byte;
+// bytes past the board size stay zero. A row slides left in four steps:
+//
+//   1. Pack its tiles to the front with a byte shuffle chosen by the mask
+//      of non-zero bytes.
+//   2. Compare it with itself shifted by one byte to find equal neighbours.
+//   3. Look up which of them start a merge.
+//   4. Bump those tiles, clear their partners and pack again.
+//
+// With AVX2 two rows share a 256-bit register. SSSE3 (pshufb) does one row
+// at a time, and plain SSE2 has no variable byte shuffle, so it uses the
+// scalar code. The kernel is picked at run time from the CPU's features, so
+// builds without -mavx2 or /arch get it too. Vertical moves slide the
+// transposed board.
+
+#include <stdint.h>
+
+#include "g2048.h"
+
+#define G2048B_MAX_SIZE 8
+#define G2048B_ROW_BYTES 16
+#define G2048B_MAX_EXPONENT 60       // keeps scores within 64 bits
+
+struct g2048b_board {
+    int size;
+    uint8_t cells[G2048B_MAX_SIZE][G2048B_ROW_BYTES];
+};
+
+void g2048b_init(struct g2048b_board* board, int size);
+
+// Move in place. Returns 1 if the board changed; the points earned are
+// added to *score when it is not NULL.
+int g2048b_move(struct g2048b_board* board, enum g2048_move move, uint64_t* score);
+
+// Plain C reference of g2048b_move, for testing and benchmarks
+int g2048b_move_scalar(struct g2048b_board* board, enum g2048_move move, uint64_t* score);
+
+int g2048b_can_move(const struct g2048b_board* board);
+int g2048b_empty_count(const struct g2048b_board* board);
+
+// New 2 or 4 (one in ten) on an empty cell picked by random; returns 0 when
+// the board is full
+int g2048b_spawn(struct g2048b_board* board, uint32_t random);
+
+// "AVX2", "SSSE3" or "scalar", whichever g2048b_move uses on this CPU
+const char* g2048b_simd_name(void);
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef G2048_PLAY_H
+#define G2048_PLAY_H
+
+// A 2048 game in play, without a screen: the board of either size, the
+// score, seeded tile spawns (rng.h) and undo/redo (history.h). The 2048
+// screen drives one and replay verification (replay.h) another, so a game
+// and its replay cannot drift apart.
+//
+// Undo does not rewind the generator: a move played again after an undo
+// spawns a fresh tile.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "g2048.h"
+#include "g2048_big.h"
+#include "history.h"
+#include "rng.h"
+
+#define G2048_PLAY_HISTORY_BYTES (64 * 1024)     // about 4000 moves on 4x4
+
+struct g2048_play {
+    int size;                    // G2048_SIZE uses board, larger sizes big
+    g2048_board board;
+    struct g2048b_board big;
+    uint64_t score;
+    int moves;
+    bool over;
+    struct rng random;
+    struct history history;
+};
+
+// 0 on success, -1 if the history cannot be allocated
+int g2048_play_init(struct g2048_play* play);
+void g2048_play_free(struct g2048_play* play);
+
+// Start over on a size x size board (4, or up to G2048B_MAX_SIZE) with two tiles
+void g2048_play_new(struct g2048_play* play, int size, uint64_t seed);
+
+// Returns false if the game is over or the move changes nothing (and so
+// spawns nothing)
+bool g2048_play_move(struct g2048_play* play, enum g2048_move move);
+
+// Step through the history; false when there is nothing to undo or redo or
+// the game is over
+bool g2048_play_undo(struct g2048_play* play);
+bool g2048_play_redo(struct g2048_play* play);
+
+int g2048_play_cell(const struct g2048_play* play, int row, int col);
+
+#endif
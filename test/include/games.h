@@ -30,6 +30,25 @@ struct Memory {
 };
 
 size_t write_callback(void* data, size_t size, size_t nmemb, void* userp);
-void send_game_score(const char* username, const char* game, int score);
+// replay is the game's replay.h recording, NULL if there is none
+void send_game_score(const char* username, const char* game, int score, const void* replay, size_t replay_size);
+
+// Asynchronous scoreboard upload (score.c); the callback runs on the GTK thread
+typedef void (*score_callback)(const char* game, int score, gboolean ok, long http_status, gpointer user_data);
+void send_game_score_async(const char* username, const char* game, int score, const void* replay, size_t replay_size,
+    score_callback callback, gpointer user_data);
+void score_client_shutdown(void);
+
+// Live scoreboard over the game WebSocket (scoreboard.c). The sender writes
+// one text message to the socket, NULL while disconnected; setting it
+// resubscribes the viewed range. RANKS payloads go to scoreboard_live_update.
+typedef int (*scoreboard_send_fn)(const char* message);
+void scoreboard_set_live_sender(scoreboard_send_fn send);
+void scoreboard_live_update(const char* json);
+
+// Tetris versus over the same socket (game_tetris.c). self is our user name
+// in the room; "VS " messages from the room go to tetris_versus_message.
+void tetris_set_versus_sender(scoreboard_send_fn send, const char* self);
+void tetris_versus_message(const char* message);
 
 #endif
@@ -0,0 +1,56 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+// Undo/redo history for the grid games (history.c).
+//
+// Each move is one small record holding the change it made, not a copy of
+// the board. Records are reversible: applying one a second time turns the
+// board back. So undo and redo hand out the same record and just move a
+// cursor. A 4x4 2048 move is the XOR of the boards before and after it (one
+// u64) plus its points. Larger grids (big 2048 boards, Tetris, Minesweeper)
+// store the cells that changed as history_encode_delta() pairs.
+//
+// Records live back to back in a ring buffer with a fixed byte budget. When
+// a new record does not fit, the oldest ones are dropped. Pushing a record
+// also drops everything that could have been redone.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define HISTORY_MAX_RECORD 4096
+
+struct history {
+    uint8_t* buffer;
+    size_t capacity;             // bytes
+    size_t head;                 // oldest record
+    size_t cursor;               // end of the last record that undo returns
+    size_t tail;                 // end of the newest record
+    size_t used;                 // bytes from head to tail
+    int undo_count;
+    int redo_count;
+};
+
+// 0 on success, -1 if the buffer cannot be allocated
+int history_init(struct history* history, size_t capacity);
+void history_free(struct history* history);
+void history_clear(struct history* history);
+
+// Record a move. Returns -1 if the record is empty, larger than
+// HISTORY_MAX_RECORD or larger than the whole budget.
+int history_push(struct history* history, const void* record, size_t size);
+
+// Copy the record to take back (undo) or to apply again (redo) into out
+// and move the cursor. Returns the record size, or 0 when there is nothing
+// to undo or redo or out is too small.
+size_t history_undo(struct history* history, void* out, size_t out_size);
+size_t history_redo(struct history* history, void* out, size_t out_size);
+
+// Encode the differences between two grids of one byte per cell as
+// (cell index, XOR) pairs. Returns the encoded size (0 for equal grids),
+// or -1 if it does not fit in out_size.
+int history_encode_delta(const uint8_t* before, const uint8_t* after, size_t cells, uint8_t* out, size_t out_size);
+
+// Apply an encoded delta to a grid; the same call serves undo and redo
+void history_apply_delta(const uint8_t* delta, size_t size, uint8_t* cells, size_t cells_count);
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef HTTP_CLIENT_H
+#define HTTP_CLIENT_H
+
+// Long-lived HTTP client for the scoreboard server (http_client.c).
+//
+// All transfers run on one curl multi handle serviced by a single I/O thread,
+// with a CURLSH share object holding the DNS cache, TLS sessions and the
+// connection cache. Keep-alive connections are reused between requests and
+// multiplexed over HTTP/2 when the server offers it.
+
+#include <curl/curl.h>
+
+struct http_client_stats {
+    long requests;
+    long failures;             // transport errors, HTTP errors are not counted
+    long connections_reused;   // transfers served on an existing connection (hits)
+    long connections_opened;   // transfers that had to connect first (misses)
+    long http2_requests;
+};
+
+// Called on the HTTP I/O thread when a transfer ends. The easy handle is
+// cleaned up by the client after this returns.
+typedef void (*http_done_fn)(CURL* easy, CURLcode result, long http_status, void* user_data);
+
+// New easy handle with the shared caches and connection options applied
+CURL* http_client_easy_new(const char* url);
+
+// Hand a configured easy handle to the I/O thread; callable from any thread
+int http_client_submit(CURL* easy, http_done_fn done, void* user_data);
+
+void http_client_get_stats(struct http_client_stats* stats);
+void http_client_log_stats(void);
+void http_client_shutdown(void);
+
+#endif
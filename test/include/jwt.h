@@ -0,0 +1,47 @@
+#ifndef JWT_H
+#define JWT_H
+
+// Local verification of login tokens on the game server (server/jwt.c).
+//
+// The auth service signs RS256 JWTs and publishes its public keys as a JWK
+// set. The server loads that set once and checks each token's signature and
+// expiry itself, so joining a game or submitting a score never waits on the
+// auth service. A token seen before is answered from a small cache until it
+// expires. When a token names an unknown key id the JWK set file is re-read
+// (at most every JWT_RELOAD_SECONDS), which picks up rotated keys.
+//
+// Not thread-safe; call it from the lws service thread only.
+
+#define JWT_LEEWAY_SECONDS 30        // clock skew allowed on exp and nbf
+#define JWT_RELOAD_SECONDS 60
+#define JWT_CACHE_MAX 4096
+
+enum jwt_status {
+    JWT_OK,
+    JWT_MALFORMED,
+    JWT_UNSUPPORTED_ALG,
+    JWT_UNKNOWN_KEY,
+    JWT_BAD_SIGNATURE,
+    JWT_EXPIRED,
+    JWT_NOT_YET_VALID,
+};
+
+struct jwt_claims {
+    char subject[50];            // "sub", the username
+    long long issued_at;         // "iat", 0 if absent
+    long long expires_at;        // "exp"
+};
+
+// Load the JWK set file (RSA keys only); returns the number of keys, -1 on error
+int jwt_keys_load(const char* path);
+
+// Whether a JWK set is loaded; without one tokens cannot be checked
+int jwt_keys_loaded(void);
+
+enum jwt_status jwt_verify(const char* token, struct jwt_claims* claims);
+
+const char* jwt_status_string(enum jwt_status status);
+
+void jwt_shutdown(void);
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef LBCACHE_H
+#define LBCACHE_H
+
+// Two-level cache for leaderboard responses (lbcache.c): an in-memory LRU
+// with TTL in front of an on-disk copy that survives restarts. Entries keep
+// the server's ETag so stale data can be revalidated with If-None-Match
+// while it is already on screen.
+
+#include <glib.h>
+
+#define LBCACHE_FRESH_SECONDS 30     // younger entries are shown without revalidating
+
+enum lbcache_level { LBCACHE_MISS = 0, LBCACHE_L1, LBCACHE_L2 };
+
+struct lbcache_item {
+    char* body;                  // g_free() when done
+    gsize size;
+    char etag[128];
+    gint64 stored_at;            // wall clock, microseconds
+};
+
+struct lbcache_stats {
+    long l1_hits;
+    long l2_hits;
+    long misses;
+    long revalidated;            // 304 Not Modified answers
+    guint64 l1_footprint;        // payload bytes held in memory
+    guint l1_items;
+};
+
+enum lbcache_level lbcache_get(const char* key, struct lbcache_item* item);
+void lbcache_put(const char* key, const char* body, gsize size, const char* etag);
+void lbcache_touch(const char* key);
+gboolean lbcache_is_fresh(const struct lbcache_item* item);
+void lbcache_get_stats(struct lbcache_stats* stats);
+void lbcache_log_stats(void);
+
+#endif
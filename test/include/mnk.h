@@ -0,0 +1,122 @@
+#ifndef MNK_H
+#define MNK_H
+
+// m,n,k-game rules engine (tic-tac-toe, gomoku, ...) shared by the client,
+// the game server and the bots. Each side's stones are kept as a bitmask and
+// a win is found by testing the precomputed k-in-a-row line masks that pass
+// through the last placed cell.
+
+#include <stdint.h>
+#include <stdbool.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#define MNK_MAX_SIDE 19
+#define MNK_MAX_CELLS (MNK_MAX_SIDE * MNK_MAX_SIDE)
+#define MNK_WORDS ((MNK_MAX_CELLS + 63) / 64)
+
+typedef struct {
+    uint64_t w[MNK_WORDS];
+} mnk_bits;
+
+// Cell values use the same encoding as the old int board[3][3]
+enum mnk_cell { MNK_EMPTY = 0, MNK_X = 1, MNK_O = 2 };
+
+// Sides are indexed 0 (X, moves first) and 1 (O)
+enum mnk_side { MNK_SIDE_X = 0, MNK_SIDE_O = 1 };
+
+enum mnk_result {
+    MNK_OK = 0,
+    MNK_ERR_RANGE,     // row/col outside the board
+    MNK_ERR_OCCUPIED,  // cell already taken
+    MNK_ERR_TURN,      // not this side's turn
+    MNK_ERR_OVER       // game already finished
+};
+
+enum mnk_state { MNK_PLAYING = 0, MNK_WIN_X, MNK_WIN_O, MNK_DRAW };
+
+// Incremental k-in-a-row tracking: len[d][cell] is the length of the
+// same-side run through cell along direction d. Only run end cells are kept
+// up to date, which is all a placement next to them needs, so each move is
+// O(1) regardless of board size.
+struct mnk_runs {
+    uint16_t len[4][MNK_MAX_CELLS];
+};
+
+// Immutable per-geometry tables, build once and share between boards
+struct mnk_rules {
+    int rows, cols, k;
+    int cells;
+    int words;              // number of used words in mnk_bits
+    int line_count;
+    mnk_bits* lines;        // every k-in-a-row line as a mask
+    int* cell_line_start;   // lines through cell c: cell_lines[start[c] .. start[c + 1])
+    uint16_t* cell_lines;
+};
+
+struct mnk_board {
+    const struct mnk_rules* rules;
+    mnk_bits stones[2];
+    int moves;
+    int to_move;            // enum mnk_side
+    int last_cell;          // -1 before the first move
+    enum mnk_state state;
+    struct mnk_runs* runs;  // optional, see mnk_board_track_runs()
+};
+
+int mnk_rules_init(struct mnk_rules* rules, int rows, int cols, int k);
+void mnk_rules_free(struct mnk_rules* rules);
+
+void mnk_board_init(struct mnk_board* board, const struct mnk_rules* rules);
+void mnk_board_track_runs(struct mnk_board* board, struct mnk_runs* runs);
+int mnk_runs_place(struct mnk_runs* runs, const struct mnk_board* board, int side, int cell);
+
+enum mnk_result mnk_check(const struct mnk_board* board, int side, int row, int col);
+enum mnk_result mnk_play(struct mnk_board* board, int side, int row, int col);
+void mnk_undo(struct mnk_board* board, int row, int col);
+
+int mnk_cell(const struct mnk_board* board, int row, int col);
+bool mnk_wins_at(const struct mnk_board* board, int side, int cell);
+const char* mnk_result_text(enum mnk_result result);
+
+static inline int mnk_side_of(char symbol) {
+    return symbol == 'X' ? MNK_SIDE_X : MNK_SIDE_O;
+}
+
+static inline char mnk_symbol_of(int side) {
+    return side == MNK_SIDE_X ? 'X' : 'O';
+}
+
+static inline bool mnk_bit_test(const mnk_bits* bits, int cell) {
+    return (bits->w[cell >> 6] >> (cell & 63)) & 1;
+}
+
+static inline void mnk_bit_set(mnk_bits* bits, int cell) {
+    bits->w[cell >> 6] |= (uint64_t)1 << (cell & 63);
+}
+
+static inline void mnk_bit_clear(mnk_bits* bits, int cell) {
+    bits->w[cell >> 6] &= ~((uint64_t)1 << (cell & 63));
+}
+
+// Index of the lowest set bit, x must not be zero
+static inline int mnk_ctz64(uint64_t x) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return (int)index;
+#else
+    return __builtin_ctzll(x);
+#endif
+}
+
+static inline int mnk_popcount64(uint64_t x) {
+#ifdef _MSC_VER
+    return (int)__popcnt64(x);
+#else
+    return __builtin_popcountll(x);
+#endif
+}
+
+#endif
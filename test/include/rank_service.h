@@ -0,0 +1,71 @@
+#ifndef RANK_SERVICE_H
+#define RANK_SERVICE_H
+
+// Leaderboard ranking service (server/rank_service.c), an lws HTTP protocol
+// meant to be added to the game server's vhost next to its WebSocket
+// protocol. Each game keeps one order-statistic tree of every player's best
+// score, so all requests are O(log n) (plus the rows returned):
+//
+//   POST /scores/batch                          score.c outbox batches
+//   GET  /scores?game=G&offset=N&limit=M        {"total", "rows": [...]}
+//   GET  /scores/rank?game=G&score=S            {"rank", "total"}
+//   GET  /scores/rank?game=G&username=U         {"rank", "score", "total"}
+//
+// The GET requests take window=day or window=week for the rolling daily and
+// weekly boards (rank_window.h); without it they use the all-time board.
+//
+// Once a JWK set is loaded (jwt_keys_load), POST /scores/batch needs an
+// "Authorization: Bearer <token>" header and only accepts the token owner's
+// scores. The game server checks its WebSocket joins the same way by calling
+// rank_service_authorize from LWS_CALLBACK_FILTER_PROTOCOL_CONNECTION.
+//
+// Batch scores carry the base64 replay of their game and are only filed
+// after the replay plays back to the same score (replay_verify.h). The
+// batch is answered {"queued": n} before that happens, or 503 when the
+// verification queue is full. Each score needs the client's "id": a score
+// whose id was queued in the last eight days is dropped. Day and week boards
+// file a score under the hour of its "time" (seconds since the epoch).
+//
+// Leaderboard pages carry an ETag that changes with the game's board, so the
+// client's cache can revalidate with If-None-Match. Bodies of WSZ_THRESHOLD
+// bytes or more are gzipped for clients that accept it; the gzipped page
+// has its own ETag ("...-gz") and responses carry Vary: Accept-Encoding.
+//
+// Live updates travel over WebSocket messages. A client sends
+// "SUBSCRIBE <game> <all|day|week> <first rank> <rows>" (at most 100 rows) or
+// "UNSUBSCRIBE"; the server pushes "RANKS {json}" with only the rows of that
+// range that changed since its last push, as a compressed wsz.h binary frame
+// when it is large (typically the first push). The game server forwards its
+// WebSocket traffic through the rank_service_live_* hooks; rank_live_protocol
+// does the same for a standalone server.
+
+#include <libwebsockets.h>
+
+#include "jwt.h"
+
+#define RANK_SERVICE_PROTOCOL "rank-http"
+#define RANK_LIVE_PROTOCOL "rank-live"
+
+// Protocol entry for the vhost's protocol list
+extern const struct lws_protocols rank_service_protocol;
+
+// Mounts the protocol on /scores
+extern const struct lws_http_mount rank_service_mount;
+
+extern const struct lws_protocols rank_live_protocol;
+
+// Handle a client message; returns 1 if it was a subscription message
+int rank_service_live_message(struct lws* wsi, const char* message);
+
+// Push pending changes from the connection's writable callback
+int rank_service_live_writeable(struct lws* wsi);
+
+void rank_service_live_closed(struct lws* wsi);
+
+// Check the bearer token of an HTTP request or WebSocket handshake. Returns 1
+// if it is valid, or if no JWK set is loaded (claims->subject is then empty).
+int rank_service_authorize(struct lws* wsi, struct jwt_claims* claims);
+
+void rank_service_shutdown(void);
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef RANK_TREE_H
+#define RANK_TREE_H
+
+// Order-statistic treap for leaderboards (rank_tree.c).
+//
+// Entries are ordered by score, highest first, with ties going to the entry
+// inserted earlier. Every node keeps the size of its subtree, so inserting,
+// removing, the rank of a score and the entry at a rank are all O(log n)
+// expected, and a range of k ranks is O(log n + k). Nodes live in one array
+// and refer to each other by index, which keeps a 10M entry tree compact.
+
+#include <stdint.h>
+
+#define RANK_NIL UINT32_MAX
+
+struct rank_node {
+    int32_t score;
+    uint32_t seq;                // insertion order, breaks score ties
+    uint32_t player;             // caller's id for the entry
+    uint32_t size;               // nodes in this subtree
+    uint32_t left;
+    uint32_t right;
+};
+
+struct rank_tree {
+    struct rank_node* nodes;
+    uint32_t capacity;
+    uint32_t used;               // slots handed out, including freed ones
+    uint32_t free_list;          // chained through left
+    uint32_t root;
+    uint32_t next_seq;
+};
+
+struct rank_entry {
+    uint32_t rank;               // 1-based
+    int32_t score;
+    uint32_t player;
+};
+
+int rank_tree_init(struct rank_tree* tree, uint32_t capacity_hint);
+void rank_tree_free(struct rank_tree* tree);
+
+// Handle of the new entry, RANK_NIL when out of memory
+uint32_t rank_tree_insert(struct rank_tree* tree, int32_t score, uint32_t player);
+void rank_tree_remove(struct rank_tree* tree, uint32_t handle);
+
+uint32_t rank_tree_size(const struct rank_tree* tree);
+
+// Rank a new entry with this score would get: 1 + entries scoring higher
+uint32_t rank_tree_rank_of_score(const struct rank_tree* tree, int32_t score);
+uint32_t rank_tree_rank_of(const struct rank_tree* tree, uint32_t handle);
+
+// Up to count entries starting at first_rank (1-based); returns how many
+int rank_tree_range(const struct rank_tree* tree, uint32_t first_rank, int count, struct rank_entry* out);
+
+static inline const struct rank_node* rank_tree_node(const struct rank_tree* tree, uint32_t handle) {
+    return &tree->nodes[handle];
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef RANK_WINDOW_H
+#define RANK_WINDOW_H
+
+// Time-windowed leaderboards (rank_window.c).
+//
+// Scores also go into the bucket for the hour they were played, a ring of one
+// week of hourly buckets. Each bucket keeps only its top RANK_WINDOW_TOP players in a
+// min-heap. A bucket that falls out of the week is dropped in O(1) by
+// reusing its slot. A daily or weekly board is merged from the buckets in the
+// window when first asked for in an hour; after that each new score is
+// folded into it in O(RANK_WINDOW_TOP), so window queries are answered from a
+// sorted array like all-time ones, whatever the write load.
+
+#include <stdint.h>
+
+#include "rank_tree.h"
+
+#define RANK_WINDOW_BUCKETS 168      // hours in a week
+#define RANK_WINDOW_TOP 1000
+
+enum rank_window { RANK_WINDOW_ALL = 0, RANK_WINDOW_DAY, RANK_WINDOW_WEEK, RANK_WINDOW_COUNT };
+
+struct rank_bucket {
+    int64_t hour;                // hours since the epoch, -1 when unused
+    int count;
+    struct rank_node* heap;      // min-heap, worst of the top entries first
+};
+
+struct rank_merged {
+    int64_t hour;
+    uint64_t version;
+    int count;
+    struct rank_entry* entries;  // best first
+};
+
+struct rank_windows {
+    struct rank_bucket buckets[RANK_WINDOW_BUCKETS];
+    struct rank_merged merged[RANK_WINDOW_COUNT];
+    uint64_t version;
+    uint32_t next_seq;
+    int64_t latest_hour;         // newest bucket, -1 before the first score
+
+    // Per player: heap position in the latest hour's bucket
+    int64_t* player_hour;
+    int* player_pos;
+    uint32_t* player_seen;       // scratch for merging
+    uint32_t players;
+    uint32_t merge_stamp;
+};
+
+void rank_windows_init(struct rank_windows* windows);
+void rank_windows_free(struct rank_windows* windows);
+
+// Record a score at the hour it was played; returns nonzero if a bucket
+// changed. Hours a week or more before the latest one are ignored.
+int rank_windows_submit(struct rank_windows* windows, int64_t hour, uint32_t player, int32_t score);
+
+// Best-first board for a day or week window ending at hour
+const struct rank_entry* rank_windows_top(struct rank_windows* windows, enum rank_window window, int64_t hour, int* count);
+
+// Rank a score would get within a merged board: 1 + entries scoring higher
+uint32_t rank_windows_rank_of_score(const struct rank_entry* entries, int count, int32_t score);
+
+enum rank_window rank_window_from_name(const char* name);
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+// Compact replays of a single-player game: the seed and every input with
+// its time, enough to play the game again headlessly (replay_run) and get
+// the same board and score.
+//
+// Layout, integers little-endian:
+//
+//   "RP" 1          magic and format version
+//   game            enum replay_game
+//   param           board size for 2048, 0 for Tetris
+//   seed            8 bytes
+//   events          one varint each: (ms since the previous event << 4) | code
+//
+// Codes 0 to 14 are inputs of the game; REPLAY_END (15) closes the replay at
+// the game's final time. A varint is 7 bits per byte, low bits first, high
+// bit set on all but the last byte, so an event up to 7 ms after the last
+// is 1 byte and one within a second is 2. An input costs about 2 bytes:
+// 10 minutes of Tetris at 9 presses and releases a second is 11 KB, and 10
+// minutes of 2048 about 5 KB.
+//
+// Tetris codes are key * 2 + pressed (tetris_sim.h). Times are game-clock
+// milliseconds: an input at t us is applied in the simulation step ending
+// at the next whole millisecond, so rounding up replays it exactly. 2048
+// codes are enum g2048_move, REPLAY_UNDO and REPLAY_REDO, timed from the
+// start of the game.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define REPLAY_HEADER 13
+#define REPLAY_END 15
+#define REPLAY_UNDO 4
+#define REPLAY_REDO 5
+#define REPLAY_MAX_BYTES (1 << 20)   // 10x a long game; larger files are refused
+
+enum replay_game {
+    REPLAY_2048 = 1,
+    REPLAY_TETRIS,
+};
+
+// A replay being recorded. Recording errors (out of memory, a closed
+// replay) mark it failed; the game goes on without one.
+struct replay {
+    uint8_t* data;
+    size_t size;
+    size_t capacity;
+    int64_t last_ms;
+    bool ended;
+    bool failed;
+};
+
+// What replay_run found
+struct replay_result {
+    enum replay_game game;
+    int param;
+    uint64_t seed;
+    uint64_t score;
+    int64_t duration_ms;
+    uint32_t inputs;
+    bool over;                   // the game ended by its own rules
+};
+
+// Start recording; any earlier recording in the struct is dropped
+void replay_start(struct replay* replay, enum replay_game game, int param, uint64_t seed);
+
+// Times before the previous event are taken as the previous event's time
+void replay_add(struct replay* replay, int64_t time_ms, int code);
+void replay_end(struct replay* replay, int64_t time_ms);
+
+// True if the replay has been ended without errors
+bool replay_complete(const struct replay* replay);
+void replay_free(struct replay* replay);
+
+// 0 on success, -1 on I/O errors; replay_load returns a malloc'd buffer
+// (NULL on errors or a file over REPLAY_MAX_BYTES)
+int replay_save(const struct replay* replay, const char* path);
+uint8_t* replay_load(const char* path, size_t* size);
+
+// Reading events back; time_ms is the time of the last event read
+struct replay_reader {
+    const uint8_t* p;
+    const uint8_t* end;
+    enum replay_game game;
+    int param;
+    uint64_t seed;
+    int64_t time_ms;
+};
+
+// False if the data does not start with a valid header
+bool replay_open(struct replay_reader* reader, const uint8_t* data, size_t size);
+
+// 1 for an input (its code in *code), 0 at REPLAY_END, -1 if the data is
+// malformed or ends without REPLAY_END
+int replay_next(struct replay_reader* reader, int* code);
+
+// Play the game again. Returns false if the replay is malformed or one of
+// its inputs could not have happened in the game (a Tetris input that
+// would overflow the input queue, for one). Stops early and returns false
+// once more than max_ms of game time would be played; 0 means no limit.
+bool replay_run(const uint8_t* data, size_t size, int64_t max_ms, struct replay_result* result);
+
+#endif
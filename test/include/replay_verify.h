@@ -0,0 +1,88 @@
+#ifndef REPLAY_VERIFY_H
+#define REPLAY_VERIFY_H
+
+// Checks submitted scores by playing their replays (replay.h) again, on a
+// pool of worker threads (server/replay_verify.c). The ranking service
+// queues a check per score and files the score once its check passes.
+//
+// A check passes when the replay is for the game the score names (and its
+// board size), plays through without a forged input, ends with the game
+// over by its own rules and scores exactly what was claimed. Each game has
+// a budget of game time a replay may cover; a longer one is rejected
+// without finishing it, which bounds the CPU time of a check (Tetris runs
+// at about 30000x real time, so its 3-hour budget is under half a second).
+//
+// Checks queue up to REPLAY_VERIFY_QUEUE deep; past that replay_verify_submit
+// refuses them so the caller can push back on the client. Finished checks
+// wait for replay_verify_collect on the caller's thread; the pool calls the
+// wake function after each one so that thread knows to look.
+//
+// A replay proves the score can be played from its seed, not who played
+// it; the seed is the client's.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "replay.h"
+
+#define REPLAY_VERIFY_WORKERS 4
+#define REPLAY_VERIFY_QUEUE 256
+
+enum replay_verdict {
+    REPLAY_VERIFY_PENDING = 0,
+    REPLAY_VERIFY_OK,
+    REPLAY_VERIFY_NO_REPLAY,
+    REPLAY_VERIFY_UNKNOWN_GAME,      // no verifier for the game
+    REPLAY_VERIFY_WRONG_GAME,        // the replay is of another game or board size
+    REPLAY_VERIFY_INVALID,           // malformed, or an input that could not have happened
+    REPLAY_VERIFY_OVER_BUDGET,
+    REPLAY_VERIFY_NOT_OVER,          // the replay stops before the game ends
+    REPLAY_VERIFY_SCORE,             // plays to a different score
+};
+
+struct replay_check {
+    char game[32];
+    char username[50];
+    int score;
+    uint8_t* replay;                 // malloc'd, freed with the check
+    size_t size;
+    int64_t played_at;               // seconds since the epoch, for the caller
+    void* user;
+
+    // Filled by the pool
+    enum replay_verdict verdict;
+    struct replay_result result;
+    long long elapsed_us;
+    struct replay_check* next;
+};
+
+// Called from a worker thread after a check finishes
+typedef void (*replay_verify_wake_fn)(void* arg);
+
+// Start workers (REPLAY_VERIFY_WORKERS when 0). Returns -1 if no thread
+// could be started. Calling it again while running changes nothing.
+int replay_verify_start(int workers, replay_verify_wake_fn wake, void* wake_arg);
+
+// Queue a check; the pool owns it from here. Returns false, and leaves it
+// with the caller, when the queue is full or the pool is not running.
+bool replay_verify_submit(struct replay_check* check);
+
+// Finished checks in the order they finished, linked by next; NULL if none
+struct replay_check* replay_verify_collect(void);
+
+// Checks queued and not collected yet
+int replay_verify_backlog(void);
+
+// Run a check on the calling thread
+enum replay_verdict replay_verify_run(struct replay_check* check);
+
+const char* replay_verdict_string(enum replay_verdict verdict);
+
+void replay_check_free(struct replay_check* check);
+
+// Stop the workers; checks not started are dropped, finished ones not
+// collected are freed
+void replay_verify_shutdown(void);
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef RNG_H
+#define RNG_H
+
+// Seeded random numbers shared by the games (2048 spawns, the Tetris bag
+// and garbage holes). A game owns its generator, so its random choices
+// follow from the seed and the player's inputs alone and a replay
+// (replay.h) plays out the same.
+//
+// xoshiro256** (Blackman and Vigna): 32 bytes of state, a handful of
+// shifts and one multiply per 64 bits, and it passes BigCrush. The state is
+// filled from the 64-bit seed with splitmix64, so any seed, 0 included,
+// gives a good start.
+
+#include <stdint.h>
+
+struct rng {
+    uint64_t s[4];
+};
+
+static inline uint64_t rng_rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+static inline void rng_seed(struct rng* rng, uint64_t seed) {
+    for (int i = 0; i < 4; i++) {
+        uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        rng->s[i] = z ^ (z >> 31);
+    }
+}
+
+static inline uint64_t rng_next(struct rng* rng) {
+    uint64_t* s = rng->s;
+    uint64_t result = rng_rotl(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rng_rotl(s[3], 45);
+    return result;
+}
+
+// The high bits are the strongest
+static inline uint32_t rng_u32(struct rng* rng) {
+    return (uint32_t)(rng_next(rng) >> 32);
+}
+
+// 0 to n - 1 by multiply and shift instead of a division; the bias is
+// below n / 2^32
+static inline uint32_t rng_below(struct rng* rng, uint32_t n) {
+    return (uint32_t)(((uint64_t)rng_u32(rng) * n) >> 32);
+}
+
+#endif
@@ -0,0 +1,144 @@
+#ifndef TETRIS_H
+#define TETRIS_H
+
+// Tetris rules engine shared by the client, the AI and replay verification.
+//
+// The well is one 16-bit mask per row, row 0 at the bottom. Column c of the
+// well is bit c + TETRIS_WALL; the bits on either side are always set and
+// act as walls. A piece is four row masks, so a collision test is four ANDs,
+// a full row is a row equal to TETRIS_FULL_ROW, and clearing a row is a
+// memmove of the masks above it.
+//
+// Rotation follows SRS: the guideline shapes, rotation states 0, R, 2, L
+// and the JLSTZ and I wall-kick tables. Pieces come from a seeded 7-bag, so
+// a game is reproducible from its seed and inputs.
+
+#include <stdbool.h>
+#include <stdint.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include "rng.h"
+
+#define TETRIS_WIDTH 10
+#define TETRIS_HEIGHT 40             // rows above TETRIS_VISIBLE are the spawn buffer
+#define TETRIS_VISIBLE 20
+#define TETRIS_WALL 3
+#define TETRIS_EMPTY_ROW ((uint16_t)~(((1u << TETRIS_WIDTH) - 1) << TETRIS_WALL))
+#define TETRIS_FULL_ROW ((uint16_t)0xFFFF)
+#define TETRIS_PREVIEW 5
+#define TETRIS_LOCK_DELAY_MS 500
+#define TETRIS_LOCK_RESETS 15        // moves that restart the lock delay, per piece
+
+enum tetris_type { TETRIS_I = 0, TETRIS_O, TETRIS_T, TETRIS_S, TETRIS_Z, TETRIS_J, TETRIS_L, TETRIS_TYPES };
+
+struct tetris_well {
+    uint16_t rows[TETRIS_HEIGHT];
+};
+
+// (x, y) is the bottom-left corner of the piece's SRS bounding box in well
+// columns and rows; x may be negative for boxes that overhang the left wall
+struct tetris_piece {
+    int8_t type;
+    int8_t rotation;             // 0, 1 (R), 2, 3 (L)
+    int8_t x;
+    int8_t y;
+};
+
+struct tetris {
+    struct tetris_well well;
+    struct tetris_piece piece;
+    int8_t hold;                 // -1 when empty
+    bool hold_used;              // hold is allowed once per piece
+    bool last_rotated;           // the last successful action was a rotation (T-spin check)
+    bool over;
+    uint8_t queue[TETRIS_PREVIEW];
+    uint8_t bag[TETRIS_TYPES];
+    int bag_left;
+    struct rng random;
+    uint32_t score;
+    int lines;
+    int level;
+    int pieces;
+};
+
+// Result of locking a piece
+struct tetris_lock {
+    int lines;
+    bool tspin;
+    uint32_t points;
+};
+
+// Row masks of a piece in its box, bottom row first, before shifting to x
+extern const uint16_t tetris_shapes[TETRIS_TYPES][4][4];
+
+void tetris_well_clear(struct tetris_well* well);
+bool tetris_fits(const struct tetris_well* well, struct tetris_piece piece);
+
+// Rows the piece can fall before landing
+int tetris_drop_distance(const struct tetris_well* well, struct tetris_piece piece);
+
+// Write the piece into the well and clear full rows; returns the rows cleared
+int tetris_place(struct tetris_well* well, struct tetris_piece piece);
+
+// Piece of a type in its spawn position
+struct tetris_piece tetris_spawn_piece(int type);
+
+// SRS rotation with wall kicks; direction is 1 clockwise, -1 counter-
+// clockwise. Returns false and leaves *piece alone if no kick fits.
+bool tetris_rotate_piece(const struct tetris_well* well, struct tetris_piece* piece, int direction);
+
+void tetris_init(struct tetris* game, uint64_t seed);
+
+// Player actions on the falling piece; each returns whether it did anything
+bool tetris_shift(struct tetris* game, int dx);
+bool tetris_rotate(struct tetris* game, int direction);
+bool tetris_soft_drop(struct tetris* game);       // one row, scores a point
+bool tetris_hold(struct tetris* game);
+
+// Lock the piece where it is (or after a hard drop), score it, clear rows
+// and spawn the next one. Sets over when the next piece cannot spawn or the
+// locked piece is entirely above the visible rows.
+struct tetris_lock tetris_lock_piece(struct tetris* game);
+struct tetris_lock tetris_hard_drop(struct tetris* game);
+
+// Garbage lines a lock sends to the opponent in versus play: 0, 1, 2, 4
+// for one to four lines, 2, 4, 6 for a T-spin single, double or triple
+int tetris_attack_lines(struct tetris_lock lock);
+
+// Push the stack up by lines rows that are full but for the hole column,
+// and the piece up with it if it no longer fits. Sets over, and returns
+// false, if filled cells are pushed out of the top or the piece has nowhere
+// to go.
+bool tetris_add_garbage(struct tetris* game, int lines, int hole);
+
+bool tetris_landed(const struct tetris* game);
+int tetris_ghost_y(const struct tetris* game);
+
+// Gravity at a level (guideline curve, (0.8 - (level - 1) * 0.007)^(level - 1)
+// seconds per row), levels 1 to 20. The simulation uses the microseconds,
+// a fixed table, so every platform's game clock agrees exactly.
+int64_t tetris_gravity_us(int level);
+double tetris_gravity_seconds(int level);
+
+const char* tetris_type_name(int type);
+
+static inline bool tetris_cell(const struct tetris_well* well, int x, int y) {
+    return (well->rows[y] >> (x + TETRIS_WALL)) & 1;
+}
+
+static inline int tetris_popcount16(uint16_t x) {
+#ifdef _MSC_VER
+    return (int)__popcnt16(x);
+#else
+    return __builtin_popcount(x);
+#endif
+}
+
+// Filled cells in a row, walls excluded
+static inline int tetris_row_cells(uint16_t row) {
+    return tetris_popcount16((uint16_t)(row & ~TETRIS_EMPTY_ROW));
+}
+
+#endif
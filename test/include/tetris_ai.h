@@ -0,0 +1,88 @@
+#ifndef TETRIS_AI_H
+#define TETRIS_AI_H
+
+// Placement search for Tetris (tetris.h), used for the hint overlay and the
+// CPU player.
+//
+// A breadth-first search from the spawn position over left, right, both
+// rotations (with SRS kicks) and one-row drops finds every final position a
+// player can reach, tucks and spins included, with the shortest key sequence
+// to get there. Positions that leave the same cells filled count once.
+// Each one is placed on a copy of the well and scored as a weighted sum of
+// board features (tetris_ai_weights).
+//
+// The search covers the current piece and the hold piece. With lookahead,
+// each of those placements is scored by the best placement of the piece
+// after it. Those second-level searches run in parallel on a pool of
+// TETRIS_AI_WORKERS threads that all searches share.
+
+#include <stdbool.h>
+
+#include "tetris.h"
+
+#define TETRIS_AI_WORKERS 4
+#define TETRIS_AI_MAX_PLACEMENTS 256     // per piece; a 10-wide well has at most about 80
+#define TETRIS_AI_MAX_PATH 96
+
+enum tetris_action {
+    TETRIS_ACTION_LEFT = 0,
+    TETRIS_ACTION_RIGHT,
+    TETRIS_ACTION_CW,
+    TETRIS_ACTION_CCW,
+    TETRIS_ACTION_DOWN,              // one row
+    TETRIS_ACTION_DROP,              // hard drop, ends every path
+    TETRIS_ACTION_HOLD,              // starts the path when the hold piece is used
+};
+
+// Feature weights; positive features are rewarded, negative ones penalized
+struct tetris_ai_weights {
+    double aggregate_height;         // sum of column heights
+    double max_height;
+    double holes;                    // empty cells with a filled cell above
+    double hole_rows;                // rows with at least one hole
+    double bumpiness;                // sum of height steps between columns
+    double wells;                    // depth of columns lower than both neighbours, summed 1 + 2 + ... per cell
+    double row_transitions;
+    double column_transitions;
+    double lines;
+    double tetris;                   // extra for a four-line clear
+    double tspin;
+};
+
+extern const struct tetris_ai_weights tetris_ai_default_weights;
+
+struct tetris_placement {
+    struct tetris_piece piece;       // final position, before the hard drop locks it
+    bool use_hold;
+    bool tspin;
+    int lines;
+    double value;
+    int path_length;
+    uint8_t path[TETRIS_AI_MAX_PATH];    // enum tetris_action, ending in TETRIS_ACTION_DROP
+};
+
+struct tetris_ai_result {
+    bool found;
+    struct tetris_placement best;
+    long long placements;            // placements scored
+    long long elapsed_us;
+    double placements_per_second;
+};
+
+// Every final position of piece reachable from where it is now. Returns the
+// count; paths are filled in, values are not.
+int tetris_ai_placements(const struct tetris_well* well, struct tetris_piece piece, struct tetris_placement* out, int max);
+
+// Board score after a placement that cleared lines (tspin if it was a T-spin)
+double tetris_ai_evaluate(const struct tetris_well* well, const struct tetris_ai_weights* weights, int lines, bool tspin);
+
+// Blocking search for the best placement of the current or hold piece,
+// meant to run off the UI thread. weights may be NULL for the defaults.
+// Stops early when *cancel becomes non-zero. Returns result->found.
+bool tetris_ai_search(const struct tetris* game, const struct tetris_ai_weights* weights, bool lookahead,
+    volatile int* cancel, struct tetris_ai_result* result);
+
+// Stop the worker pool; searches still running are aborted
+void tetris_ai_shutdown(void);
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef TETRIS_SIM_H
+#define TETRIS_SIM_H
+
+// Fixed-step Tetris simulation driven by timestamped key events.
+//
+// Key presses and releases go into a queue, each with the time it happened
+// on the game clock (microseconds since the game started). The simulation
+// runs in TETRIS_SIM_STEP_US steps. In every step it first applies the
+// inputs timestamped inside that step. It then runs auto-shift (DAS/ARR),
+// soft drop repeat, gravity and the lock delay, all on the game clock.
+// When the caller advances the simulation does not change what happens:
+// an input has the same effect whether the frame that advances past it
+// comes on time or 50 ms late. The same inputs and seed always replay to
+// the same game.
+//
+// For versus play a lock that clears lines produces an attack
+// (tetris_attack_lines) for the caller to send. Garbage from the opponent
+// comes back as a TETRIS_INPUT_GARBAGE input, so it is replayed like a key.
+// It waits until the next lock: a clear cancels as much of it as the
+// attack would have sent, and a lock that clears nothing lets the rest in.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "tetris.h"
+
+#define TETRIS_SIM_STEP_US 1000
+#define TETRIS_SIM_DAS_MS 167           // hold time before auto-shift starts
+#define TETRIS_SIM_ARR_MS 33            // time between auto-shifts, 0 for instant
+#define TETRIS_SIM_SOFT_DROP_FACTOR 20  // soft drop speed as a multiple of gravity
+#define TETRIS_SIM_QUEUE 64
+#define TETRIS_SIM_PENDING 8            // garbage inputs waiting for the next lock
+#define TETRIS_SIM_ATTACKS 8            // attacks not yet taken by the caller
+
+enum tetris_key {
+    TETRIS_KEY_LEFT = 0,
+    TETRIS_KEY_RIGHT,
+    TETRIS_KEY_CW,
+    TETRIS_KEY_CCW,
+    TETRIS_KEY_SOFT_DROP,
+    TETRIS_KEY_HARD_DROP,
+    TETRIS_KEY_HOLD,
+    TETRIS_KEYS
+};
+
+#define TETRIS_INPUT_GARBAGE 15      // a tetris_input key that is not a key
+
+struct tetris_input {
+    int64_t time_us;                 // game clock
+    uint8_t key;                     // enum tetris_key or TETRIS_INPUT_GARBAGE
+    bool pressed;
+    uint8_t lines;                   // garbage only
+    uint8_t hole;
+};
+
+struct tetris_attack {
+    int64_t time_us;
+    uint8_t lines;
+    uint8_t hole;
+};
+
+struct tetris_sim {
+    struct tetris game;
+    int64_t now_us;                  // game clock, simulated up to here
+    bool gravity;                    // off while the CPU plays; also stops the lock delay
+    int das_us;
+    int arr_us;
+
+    int64_t last_fall;               // time of the last gravity step
+    bool locking;                    // the piece has landed and the lock delay runs
+    int64_t lock_since;
+    int lock_resets;
+
+    bool held[TETRIS_KEYS];
+    int shift_direction;             // -1, 0, 1: the horizontal key that auto-shifts
+    int64_t shift_at;                // time of the next auto-shift
+    int64_t soft_drop_at;
+
+    struct tetris_input queue[TETRIS_SIM_QUEUE];
+    int queue_head;
+    int queue_count;
+    int64_t last_input_us;
+
+    uint8_t pending_lines[TETRIS_SIM_PENDING];
+    uint8_t pending_holes[TETRIS_SIM_PENDING];
+    int pending_count;
+    int pending_total;               // garbage lines waiting
+    struct tetris_attack attacks[TETRIS_SIM_ATTACKS];
+    int attack_head;
+    int attack_count;
+    struct rng garbage_random;       // picks the hole of each attack
+    uint32_t lines_sent;
+    uint32_t lines_received;         // garbage that reached the well
+
+    uint32_t locks;                  // pieces locked, hard drops included
+    uint32_t holds;                  // successful holds; with locks, tells when the piece in play changed
+    int late_inputs;                 // inputs that arrived after their step had run
+};
+
+void tetris_sim_init(struct tetris_sim* sim, uint64_t seed);
+
+// Queue an input. An input older than the simulated time, or older than
+// the last one queued, is moved forward to the next step, and
+// input->time_us is updated to when it takes effect; record that time to
+// replay the game. Returns false if the queue is full.
+bool tetris_sim_input(struct tetris_sim* sim, struct tetris_input* input);
+
+// Run every step that ends at or before until_us
+void tetris_sim_advance(struct tetris_sim* sim, int64_t until_us);
+
+// Take the oldest attack not taken yet; returns false if there is none
+bool tetris_sim_take_attack(struct tetris_sim* sim, struct tetris_attack* attack);
+
+// Turn gravity on or off; turning it on starts the fall timer now
+void tetris_sim_set_gravity(struct tetris_sim* sim, bool gravity);
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef TETRIS_VERSUS_H
+#define TETRIS_VERSUS_H
+
+// Wire format of head-to-head Tetris over the game WebSocket, shared by the
+// client (game_tetris.c) and the server's validator (versus_service.h).
+//
+// Each player runs its own simulation (tetris_sim.h) and sends only what
+// the other side needs to run a copy of it. Messages are text, after the
+// game server's "[room] user: " prefix:
+//
+//   VS READY <commitment>    the player's nonce, hidden: 64 hex digits of
+//                            tetris_versus_commitment
+//   VS NONCE <nonce>         16 hex digits, sent once both players are
+//                            READY; the seed of both games is the XOR of the
+//                            two players' nonces
+//   VS I <upto> <tokens>     inputs, and the sender's game has been
+//                            simulated up to game time <upto> ms
+//   VS A <lines> <hole>      an attack: garbage for the opponent
+//   VS OVER                  the sender topped out
+//   VS LEAVE
+//   VS REJECT <user> <why>   from the server, ends the match
+//   VS RESULT <winner>       from the server
+//
+// A token is one input: a letter for the key, 'a' + key when pressed and
+// 'A' + key when released, followed by the milliseconds since the previous
+// input of the stream. A garbage input is 'z', the milliseconds, then
+// "/<lines>/<hole>". A key pressed 80 ms after the previous input and
+// released 45 ms later is "d80D45", so an input costs 2 to 4 bytes. Inputs
+// are sent in batches, a message at most every TETRIS_VERSUS_BATCH_MS
+// unless an attack goes with it, and at least every
+// TETRIS_VERSUS_HEARTBEAT_MS so the opponent's copy keeps falling. An
+// attack is sent after the inputs that made it.
+// Inputs may be timed a little past <upto>; they wait in the queue.
+//
+// The nonces are committed to before either is revealed, so the player who
+// is READY second cannot pick the seed from the first player's nonce. The
+// server checks each NONCE against its READY and only relays it once both
+// players are READY; the match starts when both nonces are out.
+//
+// Times on the wire are whole milliseconds. An input at game time t us is
+// applied in the step ending at the next whole millisecond, so sending
+// that millisecond replays it exactly.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tetris_sim.h"
+
+#define TETRIS_VERSUS_BATCH_MS 50         // inputs wait this long to share a message
+#define TETRIS_VERSUS_HEARTBEAT_MS 100
+#define TETRIS_VERSUS_MESSAGE 480        // fits the game socket's 512-byte messages after the prefix
+#define TETRIS_VERSUS_COMMITMENT 65      // 64 hex digits and the terminator
+
+// Time of the previous input of one player's stream, for either direction
+struct tetris_versus_stream {
+    int64_t last_ms;
+};
+
+// Encode "VS I <upto> <tokens>" for inputs taken from a tetris_sim (times
+// as tetris_sim_input adjusted them). Returns the length, or -1 if it does
+// not fit; the stream is only updated on success.
+int tetris_versus_encode(struct tetris_versus_stream* stream, const struct tetris_input* inputs, int count,
+    int64_t upto_ms, char* out, size_t size);
+
+// Decode the text after "VS I ". Returns the number of inputs, or -1 if the
+// message is malformed, out of order or holds more than max.
+int tetris_versus_decode(struct tetris_versus_stream* stream, const char* text, int64_t* upto_ms,
+    struct tetris_input* out, int max);
+
+// Run a copy of the sender's game through decoded inputs up to upto_ms.
+// Returns false if an input is timed before the point the copy had already
+// reached, which the sender's own simulation would not have allowed.
+bool tetris_versus_feed(struct tetris_sim* sim, const struct tetris_input* inputs, int count, int64_t upto_ms);
+
+// SHA-256, in hex, of the nonce as NONCE carries it
+void tetris_versus_commitment(uint64_t nonce, char out[TETRIS_VERSUS_COMMITMENT]);
+
+// Split "[room] user: text". room and user are truncated to their buffers.
+// Returns false if the message does not have that form.
+bool tetris_versus_split(const char* message, char* room, size_t room_size, char* user, size_t user_size, const char** text);
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef TTT_TABLE_H
+#define TTT_TABLE_H
+
+// Solved 3x3 Tic-Tac-Toe, generated by tools/gen_ttt_table.c.
+//
+// A board is indexed by its base-3 encoding: cell i (row * 3 + col) adds
+// value * 3^i with value 0 empty, 1 X, 2 O. Each entry packs
+// (best cell + 1) << 2 | (game value + 2), where the value is 1 win, 0 draw,
+// -1 loss for the side to move. Unreachable positions are 0.
+
+#include <stdint.h>
+
+#define TTT_POSITIONS 19683
+
+extern const uint8_t ttt_table[TTT_POSITIONS];
+
+// Best cell (-1 when the game is over or the position is unreachable); the
+// game value goes to *value when it is not NULL
+static inline int ttt_lookup(int code, int* value) {
+    uint8_t entry = ttt_table[code];
+    if (!entry) return -1;
+    if (value) *value = (entry & 3) - 2;
+    return (entry >> 2) - 1;
+}
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef VERSUS_SERVICE_H
+#define VERSUS_SERVICE_H
+
+// Referee for head-to-head Tetris (tetris_versus.h), embedded in the game
+// server like the ranking service. The server passes every room message
+// through versus_service_message before relaying it. The service plays each
+// player's inputs on its own copy of their game and checks that:
+//
+//   - the input stream is well formed and in order
+//   - a player's game clock stays within VERSUS_CLOCK_SLACK_MS of the time
+//     since the match started, ahead or behind, also while they send nothing
+//   - every attack a player announces was made by a clear in their game,
+//     with the same lines and hole
+//   - garbage a player takes in is the opponent's attacks, in order, each
+//     by VERSUS_CLOCK_SLACK_MS after it was announced on their game clock
+//   - a player who announces OVER has topped out
+//   - a NONCE matches the player's READY and comes after both READYs
+//
+// A message that fails is not relayed; the room gets "VS REJECT <user>
+// <reason>" and the match ends. A finished match gets "VS RESULT <winner>".
+//
+// Only the two players of a match may READY it again. A player who sends
+// READY or LEAVE while the match runs gives it up, and the room gets the
+// opponent's "VS RESULT". A match waits at most
+// VERSUS_READY_TIMEOUT_MS for both READYs and NONCEs; then whoever is not
+// ready is rejected. A stalled client cannot hold the room, and a player who
+// holds back their nonce after seeing the other one is rejected too.
+
+#include <stdint.h>
+
+#define VERSUS_CLOCK_SLACK_MS 2000
+#define VERSUS_READY_TIMEOUT_MS 60000
+
+// Sends a message to every player in a room, under the server's name
+typedef void (*versus_broadcast_fn)(const char* room, const char* message);
+
+enum versus_verdict {
+    VERSUS_NOT_MINE = 0,             // not a versus message, relay as usual
+    VERSUS_RELAY,                    // checked, relay it
+    VERSUS_DROP,                     // rejected or malformed, do not relay
+};
+
+// text is the message after the "[room] user: " prefix; now_ms is any
+// monotonic clock in milliseconds
+enum versus_verdict versus_service_message(const char* room, const char* user, const char* text, int64_t now_ms,
+    versus_broadcast_fn broadcast);
+
+// A player left the room or disconnected; their match ends
+void versus_service_leave(const char* room, const char* user);
+
+// Ends matches whose READY wait ran out or whose player stopped reporting.
+// Messages to a room check its match already; call this now and then (once a
+// second is plenty) for rooms that have gone quiet.
+void versus_service_expire(int64_t now_ms, versus_broadcast_fn broadcast);
+
+void versus_service_shutdown(void);
+
+#endif
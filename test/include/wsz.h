@@ -0,0 +1,32 @@
+#ifndef WSZ_H
+#define WSZ_H
+
+// zlib framing for large payloads (wsz.c).
+//
+// The lws build has no permessage-deflate (LWS_WITHOUT_EXTENSIONS), so large
+// WebSocket messages are compressed by the application instead: a message
+// of WSZ_THRESHOLD bytes or more is raw-deflated and sent as a binary frame
+// starting with WSZ_MARKER. Smaller messages stay plain text frames, since
+// deflate costs more than it saves on them. wsz_gzip() does the same job
+// for HTTP response bodies.
+
+#include <stddef.h>
+
+#define WSZ_THRESHOLD 1024
+#define WSZ_MARKER 'Z'
+#define WSZ_LEVEL 1                  // most of level 9's savings at half the CPU, see tools/bench_compress.c
+#define WSZ_MAX_DECODED (16 * 1024 * 1024)
+
+// Frame a message for sending. The result is malloc()ed with headroom free
+// bytes before the payload (LWS_PRE for lws_write); *binary says whether it
+// was compressed and must go out as a binary frame.
+unsigned char* wsz_encode(const char* message, size_t length, size_t headroom, size_t* out_length, int* binary);
+
+// Text of a received binary frame, NUL-terminated and malloc()ed; NULL if
+// the frame is not a wsz frame or fails to inflate
+char* wsz_decode(const unsigned char* data, size_t length, size_t* out_length);
+
+// gzip (RFC 1952) encoding of data for Content-Encoding: gzip, malloc()ed
+unsigned char* wsz_gzip(const char* data, size_t length, size_t* out_length);
+
+#endif
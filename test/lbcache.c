@@ -0,0 +1,219 @@
+#define _CRT_SECURE_NO_WARNINGS
+// Leaderboard cache (see lbcache.h).
+//
+// L1 is a hash table of heap copies ordered by an LRU list and bounded by
+// payload bytes; an item also leaves L1 once its L1 TTL has run out. L2 is
+// one file per key under the user cache directory, written atomically, with
+// the ETag and store time in a one-line header. The functions are called from
+// both the GTK thread and the HTTP client thread, a mutex guards everything.
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lbcache.h"
+
+#define L1_MAX_FOOTPRINT (8 * 1024 * 1024)
+#define L1_TTL_US (10LL * 60 * G_USEC_PER_SEC)
+
+struct l1_node {
+    char* key;
+    struct lbcache_item item;
+    gint64 l1_expiry;            // monotonic
+    GList* lru;                  // link in l1_lru, head is most recent
+};
+
+static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static GHashTable* l1 = NULL;
+static GQueue l1_lru = G_QUEUE_INIT;
+static guint64 l1_footprint = 0;
+static struct lbcache_stats stats;
+
+static void l1_remove(struct l1_node* node) {
+    g_hash_table_remove(l1, node->key);
+    g_queue_delete_link(&l1_lru, node->lru);
+    l1_footprint -= node->item.size;
+    g_free(node->key);
+    g_free(node->item.body);
+    g_free(node);
+}
+
+static void l1_insert(const char* key, const struct lbcache_item* item) {
+    struct l1_node* old = (struct l1_node*)g_hash_table_lookup(l1, key);
+    if (old) l1_remove(old);
+    if (item->size > L1_MAX_FOOTPRINT) return;
+
+    // Evict least recently used entries until the new one fits
+    while (l1_footprint + item->size > L1_MAX_FOOTPRINT && !g_queue_is_empty(&l1_lru)) {
+        l1_remove((struct l1_node*)g_queue_peek_tail(&l1_lru));
+    }
+
+    struct l1_node* node = g_new0(struct l1_node, 1);
+    node->key = g_strdup(key);
+    node->item = *item;
+    node->item.body = g_memdup2(item->body, item->size);
+    node->l1_expiry = g_get_monotonic_time() + L1_TTL_US;
+    g_queue_push_head(&l1_lru, node);
+    node->lru = l1_lru.head;
+    g_hash_table_insert(l1, node->key, node);
+    l1_footprint += item->size;
+}
+
+static char* l2_path(const char* key) {
+    char* name = g_strdup(key);
+    for (char* p = name; *p; p++) {
+        if (!g_ascii_isalnum(*p)) *p = '_';
+    }
+
+    char* dir = g_build_filename(g_get_user_cache_dir(), "jik", "leaderboard", NULL);
+    g_mkdir_with_parents(dir, 0700);
+    char* path = g_build_filename(dir, name, NULL);
+    g_free(dir);
+    g_free(name);
+    return path;
+}
+
+// Header line: "<stored_at> <etag>\n", followed by the body. The ETag is the
+// rest of the line (quoted ETags may hold spaces), "-" when there is none.
+static gboolean l2_load(const char* key, struct lbcache_item* item) {
+    char* path = l2_path(key);
+    char* contents = NULL;
+    gsize length = 0;
+    gboolean ok = g_file_get_contents(path, &contents, &length, NULL);
+    g_free(path);
+    if (!ok) return FALSE;
+
+    char* newline = memchr(contents, '\n', length);
+    long long stored_at = 0;
+    int etag_at = 0;
+    if (!newline || sscanf(contents, "%lld %n", &stored_at, &etag_at) < 1 || contents + etag_at > newline) {
+        g_free(contents);
+        return FALSE;
+    }
+
+    gsize header = (gsize)(newline - contents) + 1;
+    *newline = '\0';
+    if (newline > contents && newline[-1] == '\r') newline[-1] = '\0';
+    const char* etag = contents + etag_at;
+    item->size = length - header;
+    item->body = g_memdup2(contents + header, item->size);
+    item->stored_at = stored_at;
+    g_strlcpy(item->etag, strcmp(etag, "-") == 0 ? "" : etag, sizeof(item->etag));
+    g_free(contents);
+    return TRUE;
+}
+
+static void l2_store(const char* key, const struct lbcache_item* item) {
+    char* header = g_strdup_printf("%lld %s\n", (long long)item->stored_at, item->etag[0] ? item->etag : "-");
+    gsize header_len = strlen(header);
+    char* contents = g_malloc(header_len + item->size);
+    memcpy(contents, header, header_len);
+    memcpy(contents + header_len, item->body, item->size);
+
+    char* path = l2_path(key);
+    if (!g_file_set_contents(path, contents, (gssize)(header_len + item->size), NULL)) {
+        fprintf(stderr, "Failed to write leaderboard cache %s\n", path);
+    }
+    g_free(path);
+    g_free(contents);
+    g_free(header);
+}
+
+static void ensure_init(void) {
+    if (!l1) l1 = g_hash_table_new(g_str_hash, g_str_equal);
+}
+
+// Copy of the cached response for key, from memory or else from disk
+enum lbcache_level lbcache_get(const char* key, struct lbcache_item* item) {
+    enum lbcache_level level = LBCACHE_MISS;
+    memset(item, 0, sizeof(*item));
+
+    pthread_mutex_lock(&cache_lock);
+    ensure_init();
+
+    struct l1_node* node = (struct l1_node*)g_hash_table_lookup(l1, key);
+    if (node && node->l1_expiry < g_get_monotonic_time()) {
+        l1_remove(node);
+        node = NULL;
+    }
+
+    if (node) {
+        g_queue_unlink(&l1_lru, node->lru);
+        g_queue_push_head_link(&l1_lru, node->lru);
+        *item = node->item;
+        item->body = g_memdup2(node->item.body, node->item.size);
+        stats.l1_hits++;
+        level = LBCACHE_L1;
+    }
+    else if (l2_load(key, item)) {
+        l1_insert(key, item);
+        stats.l2_hits++;
+        level = LBCACHE_L2;
+    }
+    else {
+        stats.misses++;
+    }
+    pthread_mutex_unlock(&cache_lock);
+    return level;
+}
+
+void lbcache_put(const char* key, const char* body, gsize size, const char* etag) {
+    struct lbcache_item item;
+    memset(&item, 0, sizeof(item));
+    item.body = (char*)body;
+    item.size = size;
+    item.stored_at = g_get_real_time();
+    if (etag) g_strlcpy(item.etag, etag, sizeof(item.etag));
+
+    pthread_mutex_lock(&cache_lock);
+    ensure_init();
+    l1_insert(key, &item);
+    l2_store(key, &item);
+    pthread_mutex_unlock(&cache_lock);
+}
+
+// The server answered 304 Not Modified: the entry is fresh again
+void lbcache_touch(const char* key) {
+    struct lbcache_item item;
+
+    pthread_mutex_lock(&cache_lock);
+    ensure_init();
+    stats.revalidated++;
+
+    struct l1_node* node = (struct l1_node*)g_hash_table_lookup(l1, key);
+    if (node) {
+        node->item.stored_at = g_get_real_time();
+        node->l1_expiry = g_get_monotonic_time() + L1_TTL_US;
+        l2_store(key, &node->item);
+    }
+    else if (l2_load(key, &item)) {
+        item.stored_at = g_get_real_time();
+        l1_insert(key, &item);
+        l2_store(key, &item);
+        g_free(item.body);
+    }
+    pthread_mutex_unlock(&cache_lock);
+}
+
+gboolean lbcache_is_fresh(const struct lbcache_item* item) {
+    return g_get_real_time() - item->stored_at < (gint64)LBCACHE_FRESH_SECONDS * G_USEC_PER_SEC;
+}
+
+void lbcache_get_stats(struct lbcache_stats* out) {
+    pthread_mutex_lock(&cache_lock);
+    *out = stats;
+    out->l1_footprint = l1_footprint;
+    out->l1_items = l1 ? g_hash_table_size(l1) : 0;
+    pthread_mutex_unlock(&cache_lock);
+}
+
+void lbcache_log_stats(void) {
+    struct lbcache_stats s;
+    lbcache_get_stats(&s);
+
+    long lookups = s.l1_hits + s.l2_hits + s.misses;
+    printf("Leaderboard cache: %ld lookups, L1 %ld / L2 %ld hits (%.0f%%), %ld revalidated, %u items, %llu bytes in memory\n",
+        lookups, s.l1_hits, s.l2_hits,
+        lookups ? 100.0 * (s.l1_hits + s.l2_hits) / lookups : 0.0,
+        s.revalidated, s.l1_items, (unsigned long long)s.l1_footprint);
+}
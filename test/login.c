@@ -0,0 +1,432 @@
+#define _CRT_SECURE_NO_WARNINGS
+// Login and signup screens, and the login session they produce (see auth.h).
+//
+// Auth requests go through the shared HTTP client; their results come back
+// to the GTK thread with g_idle_add. The token itself is guarded by a mutex
+// because the score uploader reads it from its own thread. The client never
+// verifies the signature, it only reads "sub" and "exp" to know whose token
+// it holds and when to renew it.
+#include <curl/curl.h>
+#include <glib/gstdio.h>
+#include <json-c/json.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "auth.h"
+#include "games.h"
+#include "http_client.h"
+
+#define TOKEN_FILE "session.jwt"
+
+bool is_guest_mode = true;
+char username[50] = "";
+
+static pthread_mutex_t token_lock = PTHREAD_MUTEX_INITIALIZER;
+static char* token = NULL;               // guarded by token_lock
+static gint64 token_expires = 0;         // unix seconds, guarded by token_lock
+static guint refresh_source = 0;
+static gboolean refreshing = FALSE;
+
+struct login_form {
+    GtkStack* stack;
+    GtkWidget* username;
+    GtkWidget* password;
+    GtkWidget* confirm;                  // signup only
+    GtkWidget* submit;
+    GtkWidget* status;
+    gboolean signup;
+};
+
+static struct login_form login_form;
+static struct login_form signup_form;
+
+typedef void (*auth_done_fn)(long http_status, const char* new_token, gpointer user_data);
+
+struct auth_request {
+    char* body;
+    struct Memory response;
+    struct curl_slist* headers;
+    CURLcode result;
+    long http_status;
+    auth_done_fn done;
+    gpointer user_data;
+};
+
+static char* token_path(void) {
+    char* base = g_build_filename(g_get_user_config_dir(), "jik", NULL);
+    g_mkdir_with_parents(base, 0700);
+    char* path = g_build_filename(base, TOKEN_FILE, NULL);
+    g_free(base);
+    return path;
+}
+
+// "sub" and "exp" of a JWT, without checking its signature
+static gboolean read_claims(const char* jwt, char* subject, size_t subject_size, gint64* expires) {
+    const char* dot1 = strchr(jwt, '.');
+    const char* dot2 = dot1 ? strchr(dot1 + 1, '.') : NULL;
+    if (!dot2) return FALSE;
+
+    // base64url -> base64 with padding
+    GString* part = g_string_new_len(dot1 + 1, dot2 - dot1 - 1);
+    for (gsize i = 0; i < part->len; i++) {
+        if (part->str[i] == '-') part->str[i] = '+';
+        else if (part->str[i] == '_') part->str[i] = '/';
+    }
+    while (part->len % 4) g_string_append_c(part, '=');
+    gsize length;
+    guchar* json = g_base64_decode(part->str, &length);
+    g_string_free(part, TRUE);
+
+    char* text = g_strndup((const char*)json, length);
+    json_object* payload = json_tokener_parse(text);
+    g_free(text);
+    g_free(json);
+
+    json_object* sub;
+    json_object* exp;
+    gboolean ok = payload && json_object_object_get_ex(payload, "sub", &sub) && json_object_object_get_ex(payload, "exp", &exp);
+    if (ok) {
+        g_strlcpy(subject, json_object_get_string(sub), subject_size);
+        *expires = json_object_get_int64(exp);
+        ok = subject[0] && *expires > 0;
+    }
+    json_object_put(payload);
+    return ok;
+}
+
+static gint64 now_seconds(void) {
+    return g_get_real_time() / G_USEC_PER_SEC;
+}
+
+char* auth_token_dup(void) {
+    pthread_mutex_lock(&token_lock);
+    char* copy = (token && token_expires > now_seconds()) ? g_strdup(token) : NULL;
+    pthread_mutex_unlock(&token_lock);
+    return copy;
+}
+
+static void post_auth(const char* path, const char* body, const char* bearer, auth_done_fn done, gpointer user_data);
+static void schedule_refresh(void);
+
+// Take a token from the auth service (or the cache file) as the session
+static gboolean install_token(const char* new_token, gboolean save) {
+    char subject[50];
+    gint64 expires;
+    if (!read_claims(new_token, subject, sizeof(subject), &expires) || expires <= now_seconds()) return FALSE;
+
+    pthread_mutex_lock(&token_lock);
+    g_free(token);
+    token = g_strdup(new_token);
+    token_expires = expires;
+    pthread_mutex_unlock(&token_lock);
+
+    g_strlcpy(username, subject, sizeof(username));
+    is_guest_mode = false;
+
+    if (save) {
+        char* path = token_path();
+        GError* error = NULL;
+        if (!g_file_set_contents_full(path, new_token, -1, G_FILE_SET_CONTENTS_CONSISTENT, 0600, &error)) {
+            fprintf(stderr, "Failed to cache login token: %s\n", error->message);
+            g_error_free(error);
+        }
+        g_free(path);
+    }
+    schedule_refresh();
+    return TRUE;
+}
+
+void auth_logout(void) {
+    if (refresh_source) g_source_remove(refresh_source);
+    refresh_source = 0;
+
+    pthread_mutex_lock(&token_lock);
+    g_free(token);
+    token = NULL;
+    token_expires = 0;
+    pthread_mutex_unlock(&token_lock);
+
+    char* path = token_path();
+    g_remove(path);
+    g_free(path);
+    username[0] = '\0';
+    is_guest_mode = true;
+}
+
+static gboolean refresh_now(gpointer data);
+
+static void refresh_done(long http_status, const char* new_token, gpointer user_data) {
+    (void)user_data;
+    refreshing = FALSE;
+    if (is_guest_mode) return; // logged out meanwhile
+    if (http_status == 200 && new_token && install_token(new_token, TRUE)) return;
+
+    if (http_status == 401 || http_status == 403) {
+        // The session was revoked, a new login is needed
+        fprintf(stderr, "Login session of %s ended, please log in again\n", username);
+        auth_logout();
+        return;
+    }
+
+    // Auth service unreachable: keep using the token while it lasts
+    fprintf(stderr, "Token refresh failed (HTTP %ld), retrying in %d s\n", http_status, AUTH_RETRY_SECONDS);
+    pthread_mutex_lock(&token_lock);
+    gboolean alive = token && token_expires > now_seconds();
+    pthread_mutex_unlock(&token_lock);
+    if (alive) {
+        if (refresh_source) g_source_remove(refresh_source);
+        refresh_source = g_timeout_add_seconds(AUTH_RETRY_SECONDS, refresh_now, NULL);
+    }
+}
+
+static gboolean refresh_now(gpointer data) {
+    (void)data;
+    refresh_source = 0;
+    if (refreshing) return FALSE;
+
+    char* current = auth_token_dup();
+    if (!current) return FALSE;
+    refreshing = TRUE;
+    post_auth("/refresh", NULL, current, refresh_done, NULL);
+    g_free(current);
+    return FALSE;
+}
+
+// Renew the token AUTH_REFRESH_MARGIN_SECONDS before it expires, or halfway
+// through its life when it is shorter than that
+static void schedule_refresh(void) {
+    if (refresh_source) g_source_remove(refresh_source);
+    refresh_source = 0;
+
+    pthread_mutex_lock(&token_lock);
+    gint64 remaining = token ? token_expires - now_seconds() : 0;
+    pthread_mutex_unlock(&token_lock);
+    if (remaining <= 0) return;
+
+    gint64 delay = remaining > 2 * AUTH_REFRESH_MARGIN_SECONDS ? remaining - AUTH_REFRESH_MARGIN_SECONDS : remaining / 2;
+    if (delay < 1) delay = 1;
+    refresh_source = g_timeout_add_seconds((guint)delay, refresh_now, NULL);
+}
+
+static gboolean refresh_rejected(gpointer data) {
+    if (refresh_source) g_source_remove(refresh_source);
+    return refresh_now(data);
+}
+
+void auth_token_rejected(void) {
+    g_idle_add(refresh_rejected, NULL);
+}
+
+void auth_init(void) {
+    char* path = token_path();
+    char* cached = NULL;
+    if (g_file_get_contents(path, &cached, NULL, NULL)) {
+        g_strstrip(cached);
+        if (install_token(cached, FALSE)) {
+            printf("Logged in as %s (cached session)\n", username);
+        }
+        else {
+            g_remove(path); // expired or unreadable
+        }
+        g_free(cached);
+    }
+    g_free(path);
+}
+
+// Runs on the GTK thread
+static gboolean deliver_auth(gpointer data) {
+    struct auth_request* request = (struct auth_request*)data;
+    char* new_token = NULL;
+
+    if (request->result == CURLE_OK && request->http_status == 200 && request->response.response) {
+        json_object* reply = json_tokener_parse(request->response.response);
+        json_object* value;
+        if (reply && json_object_object_get_ex(reply, "token", &value)) {
+            new_token = g_strdup(json_object_get_string(value));
+        }
+        json_object_put(reply);
+    }
+    request->done(request->result == CURLE_OK ? request->http_status : 0, new_token, request->user_data);
+
+    g_free(new_token);
+    g_free(request->body);
+    free(request->response.response);
+    curl_slist_free_all(request->headers);
+    g_free(request);
+    return FALSE;
+}
+
+// Runs on the HTTP client thread
+static void auth_transfer_done(CURL* easy, CURLcode result, long http_status, void* user_data) {
+    struct auth_request* request = (struct auth_request*)user_data;
+    (void)easy;
+    request->result = result;
+    request->http_status = http_status;
+    g_idle_add(deliver_auth, request);
+}
+
+static void post_auth(const char* path, const char* body, const char* bearer, auth_done_fn done, gpointer user_data) {
+    struct auth_request* request = g_new0(struct auth_request, 1);
+    request->body = g_strdup(body ? body : "{}");
+    request->done = done;
+    request->user_data = user_data;
+    request->headers = curl_slist_append(NULL, "Content-Type: application/json");
+    if (bearer) {
+        char* header = g_strdup_printf("Authorization: Bearer %s", bearer);
+        request->headers = curl_slist_append(request->headers, header);
+        g_free(header);
+    }
+
+    char* url = g_strconcat(AUTH_URL, path, NULL);
+    CURL* easy = http_client_easy_new(url);
+    g_free(url);
+    if (easy) {
+        curl_easy_setopt(easy, CURLOPT_HTTPHEADER, request->headers);
+        curl_easy_setopt(easy, CURLOPT_POSTFIELDS, request->body);
+        curl_easy_setopt(easy, CURLOPT_WRITEFUNCTION, write_callback);
+        curl_easy_setopt(easy, CURLOPT_WRITEDATA, (void*)&request->response);
+        curl_easy_setopt(easy, CURLOPT_TIMEOUT, AUTH_TIMEOUT_SECONDS);
+        if (http_client_submit(easy, auth_transfer_done, request) == 0) return;
+        curl_easy_cleanup(easy);
+    }
+    request->result = CURLE_FAILED_INIT;
+    g_idle_add(deliver_auth, request);
+}
+
+static void show_main_menu(GtkStack* stack) {
+    if (gtk_stack_get_child_by_name(stack, "main_menu")) {
+        gtk_stack_set_visible_child_name(stack, "main_menu");
+    }
+}
+
+static void form_done(long http_status, const char* new_token, gpointer user_data) {
+    struct login_form* form = (struct login_form*)user_data;
+    gtk_widget_set_sensitive(form->submit, TRUE);
+
+    if (http_status == 200 && new_token && install_token(new_token, TRUE)) {
+        gtk_label_set_text(GTK_LABEL(form->status), "");
+        show_main_menu(form->stack);
+        return;
+    }
+
+    const char* text = "Server unreachable, try again later";
+    if (http_status == 401) text = "Wrong username or password";
+    else if (http_status == 409) text = "That username is taken";
+    else if (http_status == 200 || http_status == 400) text = "Login failed";
+    gtk_label_set_text(GTK_LABEL(form->status), text);
+}
+
+static void on_form_submit(GtkWidget* widget, gpointer data) {
+    struct login_form* form = (struct login_form*)data;
+    (void)widget;
+    const char* name = gtk_entry_get_text(GTK_ENTRY(form->username));
+    const char* password = gtk_entry_get_text(GTK_ENTRY(form->password));
+
+    if (!name[0] || !password[0]) {
+        gtk_label_set_text(GTK_LABEL(form->status), "Enter a username and password");
+        return;
+    }
+    if (strlen(name) >= sizeof(username)) {
+        gtk_label_set_text(GTK_LABEL(form->status), "Username is too long");
+        return;
+    }
+    if (form->signup && strcmp(password, gtk_entry_get_text(GTK_ENTRY(form->confirm))) != 0) {
+        gtk_label_set_text(GTK_LABEL(form->status), "Passwords do not match");
+        return;
+    }
+
+    json_object* body = json_object_new_object();
+    json_object_object_add(body, "username", json_object_new_string(name));
+    json_object_object_add(body, "password", json_object_new_string(password));
+    post_auth(form->signup ? "/signup" : "/login", json_object_to_json_string_ext(body, JSON_C_TO_STRING_PLAIN),
+        NULL, form_done, form);
+    json_object_put(body);
+
+    gtk_entry_set_text(GTK_ENTRY(form->password), "");
+    if (form->confirm) gtk_entry_set_text(GTK_ENTRY(form->confirm), "");
+    gtk_widget_set_sensitive(form->submit, FALSE);
+    gtk_label_set_text(GTK_LABEL(form->status), form->signup ? "Creating account..." : "Logging in...");
+}
+
+static void on_guest_clicked(GtkWidget* widget, gpointer data) {
+    (void)widget;
+    auth_logout();
+    show_main_menu(GTK_STACK(data));
+}
+
+static void on_signup_clicked(GtkWidget* widget, gpointer data) {
+    (void)widget;
+    gtk_stack_set_visible_child_name(GTK_STACK(data), "signup");
+}
+
+void switch_to_login(GtkWidget* widget, gpointer data) {
+    (void)widget;
+    gtk_stack_set_visible_child_name(GTK_STACK(data), "login");
+}
+
+static GtkWidget* add_entry(GtkWidget* grid, int row, const char* title, gboolean secret) {
+    GtkWidget* label = gtk_label_new(title);
+    gtk_widget_set_halign(label, GTK_ALIGN_END);
+    gtk_grid_attach(GTK_GRID(grid), label, 0, row, 1, 1);
+
+    GtkWidget* entry = gtk_entry_new();
+    gtk_entry_set_visibility(GTK_ENTRY(entry), !secret);
+    gtk_grid_attach(GTK_GRID(grid), entry, 1, row, 1, 1);
+    return entry;
+}
+
+static GtkWidget* create_form(GtkStack* stack, struct login_form* form, gboolean signup) {
+    form->stack = stack;
+    form->signup = signup;
+
+    GtkWidget* grid = gtk_grid_new();
+    gtk_container_set_border_width(GTK_CONTAINER(grid), 10);
+    gtk_grid_set_row_spacing(GTK_GRID(grid), 6);
+    gtk_grid_set_column_spacing(GTK_GRID(grid), 6);
+    gtk_widget_set_halign(grid, GTK_ALIGN_CENTER);
+    gtk_widget_set_valign(grid, GTK_ALIGN_CENTER);
+
+    int row = 0;
+    form->username = add_entry(grid, row++, "Username", FALSE);
+    gtk_entry_set_max_length(GTK_ENTRY(form->username), sizeof(username) - 1);
+    form->password = add_entry(grid, row++, "Password", TRUE);
+    if (signup) form->confirm = add_entry(grid, row++, "Confirm password", TRUE);
+    g_signal_connect(signup ? form->confirm : form->password, "activate", G_CALLBACK(on_form_submit), form);
+
+    form->submit = gtk_button_new_with_label(signup ? "Sign up" : "Log in");
+    g_signal_connect(form->submit, "clicked", G_CALLBACK(on_form_submit), form);
+    gtk_grid_attach(GTK_GRID(grid), form->submit, 0, row++, 2, 1);
+
+    if (signup) {
+        GtkWidget* back = gtk_button_new_with_label("Back to login");
+        g_signal_connect(back, "clicked", G_CALLBACK(switch_to_login), stack);
+        gtk_grid_attach(GTK_GRID(grid), back, 0, row++, 2, 1);
+    }
+    else {
+        GtkWidget* create = gtk_button_new_with_label("Create account");
+        g_signal_connect(create, "clicked", G_CALLBACK(on_signup_clicked), stack);
+        gtk_grid_attach(GTK_GRID(grid), create, 0, row++, 2, 1);
+
+        GtkWidget* guest = gtk_button_new_with_label("Play as guest");
+        g_signal_connect(guest, "clicked", G_CALLBACK(on_guest_clicked), stack);
+        gtk_grid_attach(GTK_GRID(grid), guest, 0, row++, 2, 1);
+    }
+
+    form->status = gtk_label_new("");
+    gtk_grid_attach(GTK_GRID(grid), form->status, 0, row++, 2, 1);
+    return grid;
+}
+
+GtkWidget* create_login_screen(GtkStack* stack) {
+    GtkWidget* screen = create_form(stack, &login_form, FALSE);
+    gtk_stack_add_named(stack, screen, "login");
+    return screen;
+}
+
+GtkWidget* create_signup_screen(GtkStack* stack) {
+    GtkWidget* screen = create_form(stack, &signup_form, TRUE);
+    gtk_stack_add_named(stack, screen, "signup");
+    return screen;
+}
@@ -7,6 +7,15 @@
 #include <string.h>
 #include <pthread.h>
 #include <glib.h>
+#include "mnk.h"
+#include "ai.h"
+#include "auth.h"
+#include "games.h"
+#include "g2048_ai.h"
+#include "http_client.h"
+#include "lbcache.h"
+#include "tetris_ai.h"
+#include "wsz.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -14,10 +23,13 @@
 #endif
 
 #define MESSAGE_SIZE 512
+#define CELL_PIXELS 32 // Cell size of the drawn board used above 3x3
+#define AI_TIME_BUDGET_MS 1000 // Think time of the offline AI per move
 
 static struct lws* web_socket = NULL;
 static int interrupted = 0;
 GtkWidget* buttons[3][3]; // Tic-Tac-Toe button grid
+GtkWidget* board_area = NULL; // Single drawing surface used for boards larger than 3x3
 GtkWidget* status_label;
 static GAsyncQueue* message_queue = NULL; // Ensure initialization
 
@@ -25,8 +37,19 @@ char room_id[50]; // Room ID
 char user_id[50]; // User ID
 char my_symbol = ' '; // User's symbol (X or O)
 char current_turn = 'X'; // Current turn
-int board[3][3] = { 0 }; // Board state (0: empty, 1: X, 2: O)
+int board_size = 3; // Board side length (3: Tic-Tac-Toe, up to 19: gomoku)
+int win_length = 3; // Stones in a row needed to win
+static struct mnk_rules board_rules; // Board geometry and line masks
+static struct mnk_runs board_runs; // Incremental run lengths for win detection
+struct mnk_board board; // Board state, one bitmask per side (see mnk.h)
 int players_connected = 0; // Track connected players
+static int offline_mode = 0; // Server unreachable, the local AI is the opponent
+static volatile int ai_cancel = 0; // Set on exit to stop a running AI search
+static pthread_t ai_worker; // Last AI search, joined before the next one and on exit
+static int ai_worker_started = 0;
+static int my_last_cell = -1; // Our last move until the server echoes it back
+static int board_agreed = 0; // The opponent announced the same board size and rule
+static char board_problem[96] = ""; // Why the boards do not match, shown instead of the turn
 
 // WebSocket protocol initialization
 static int callback_messenger(struct lws* wsi, enum lws_callback_reasons reason, void* user, void* in, size_t len);
@@ -44,6 +67,14 @@ void prompt_for_room_and_user() {
     printf("Enter User ID: ");
     fgets(user_id, sizeof(user_id), stdin);
     user_id[strcspn(user_id, "\n")] = 0; // Remove newline
+
+    char size_text[16];
+    printf("Enter board size (3-%d, default 3): ", MNK_MAX_SIDE);
+    if (fgets(size_text, sizeof(size_text), stdin)) {
+        int size = atoi(size_text);
+        if (size >= 3 && size <= MNK_MAX_SIDE) board_size = size;
+    }
+    win_length = (board_size < 5) ? board_size : 5; // Gomoku is five in a row
 }
 
 // Send message function
@@ -59,19 +90,50 @@ static int send_message(struct lws* wsi, const char* message) {
     return lws_write(wsi, p, strlen((char*)p), LWS_WRITE_TEXT);
 }
 
+// Live scoreboard subscriptions share the game socket
+static int send_live_message(const char* message) {
+    if (!web_socket || offline_mode) return -1;
+    return send_message(web_socket, message);
+}
+
+// Disable the grid and report the outcome once the rules engine ends the game
+static void show_game_over() {
+    const char* text = "Draw!";
+    if (board.state == MNK_WIN_X || board.state == MNK_WIN_O) {
+        char winner = (board.state == MNK_WIN_X) ? 'X' : 'O';
+        text = (winner == my_symbol) ? "You win!" : "You lose!";
+    }
+    gtk_label_set_text(GTK_LABEL(status_label), text);
+
+    if (board_area) return; // Drawn boards ignore clicks once the game is over
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            gtk_widget_set_sensitive(buttons[i][j], FALSE);
+        }
+    }
+}
+
 void update_turn(char new_turn) {
     current_turn = new_turn;
-    gboolean is_my_turn = (current_turn == my_symbol);
+    if (board.state != MNK_PLAYING) {
+        show_game_over();
+        return;
+    }
+    // Nobody moves until both sides play the same board
+    gboolean playable = offline_mode || board_agreed;
+    gboolean is_my_turn = (current_turn == my_symbol) && playable;
 
     // Ͽ   ޽ Ʈ
     const char* status_message = is_my_turn ? "Your turn!" : "Wait for your turn!";
+    if (!playable) status_message = board_problem[0] ? board_problem : "Waiting for the opponent's board size...";
     gtk_label_set_text(GTK_LABEL(status_label), status_message);
 
+    if (board_area) return; // Clicks on the drawn board check the turn themselves
     //  ư ȸϸ Ȱȭ/Ȱȭ  
     for (int i = 0; i < 3; i++) {
         for (int j = 0; j < 3; j++) {
             // ư ִ 쿡 Ȱȭ/Ȱȭ 
-            if (board[i][j] == 0) {
+            if (mnk_cell(&board, i, j) == MNK_EMPTY) {
                 gtk_widget_set_sensitive(buttons[i][j], is_my_turn);
             }
         }
@@ -79,28 +141,183 @@ void update_turn(char new_turn) {
 }
 
 
+static gboolean update_button_label(gpointer data);
+
+// Runs on the GTK thread: play the AI's move through the same path as a remote MOVE
+static gboolean apply_ai_move(gpointer data) {
+    int cell = GPOINTER_TO_INT(data);
+    if (cell < 0 || ai_cancel) return FALSE;
+
+    char ai_symbol = (my_symbol == 'X') ? 'O' : 'X';
+    if (mnk_play(&board, mnk_side_of(ai_symbol), cell / board_size, cell % board_size) == MNK_OK) {
+        update_button_label(GINT_TO_POINTER(cell));
+        update_turn(my_symbol);
+    }
+    return FALSE;
+}
+
+// Search on a private copy of the board so the UI never waits for the AI
+static void* ai_thread(void* arg) {
+    struct mnk_board* snapshot = (struct mnk_board*)arg;
+    struct ai_result result;
+
+    ai_search(snapshot, AI_TIME_BUDGET_MS, &ai_cancel, &result);
+    printf("AI move %d (depth %d, %lld nodes)\n", result.cell, result.depth, result.nodes);
+    g_free(snapshot);
+
+    g_idle_add((GSourceFunc)apply_ai_move, GINT_TO_POINTER(result.cell));
+    return NULL;
+}
+
+static void request_ai_move() {
+    // The previous search has already posted its move, so this does not wait
+    if (ai_worker_started) {
+        pthread_join(ai_worker, NULL);
+        ai_worker_started = 0;
+    }
+
+    struct mnk_board* snapshot = g_new(struct mnk_board, 1);
+    *snapshot = board;
+    snapshot->runs = NULL; // The search plays and unplays, run tracking stays with the UI board
+
+    if (pthread_create(&ai_worker, NULL, ai_thread, snapshot) != 0) {
+        fprintf(stderr, "Failed to start AI thread\n");
+        g_free(snapshot);
+        return;
+    }
+    ai_worker_started = 1;
+}
+
+// Server unreachable: the local AI takes the second seat
+static void start_offline_game() {
+    offline_mode = 1;
+    players_connected = 2;
+    my_symbol = 'X';
+    update_turn('X');
+    gtk_label_set_text(GTK_LABEL(status_label), "Server unreachable, playing against the computer. Your turn!");
+}
+
+// Announce our board; the opponent compares it with its own (check_board)
+static void send_board() {
+    char board_msg[32];
+    snprintf(board_msg, sizeof(board_msg), "BOARD %d %d", board_size, win_length);
+    send_message(web_socket, board_msg);
+}
+
+// The game only starts when the opponent's BOARD matches ours; a client
+// cannot switch boards mid-session, so a mismatch is reported and play stays blocked
+static void check_board(const char* sender, int size, int length) {
+    if (strcmp(sender, user_id) == 0) return; // Our own announcement, echoed
+    board_agreed = (size == board_size && length == win_length);
+    if (board_agreed) {
+        board_problem[0] = '\0';
+    }
+    else {
+        snprintf(board_problem, sizeof(board_problem), "Opponent plays %dx%d, %d in a row. Restart with the same board.",
+            size, size, length);
+        fprintf(stderr, "Board mismatch: ours %dx%d/%d, opponent %dx%d/%d\n", board_size, board_size, win_length,
+            size, size, length);
+    }
+    update_turn(current_turn);
+}
+
+// Validate and play a move made on this client, then tell the server
+static void play_local_move(int row, int col) {
+    if (!offline_mode && !board_agreed) {
+        gtk_label_set_text(GTK_LABEL(status_label), board_problem[0] ? board_problem : "Waiting for the opponent's board size...");
+        return;
+    }
+    enum mnk_result result = mnk_play(&board, mnk_side_of(my_symbol), row, col);
+    if (result == MNK_OK) {
+        my_last_cell = row * board_size + col;
+        if (board_area) {
+            gtk_widget_queue_draw(board_area);
+        }
+        else {
+            gtk_button_set_label(GTK_BUTTON(buttons[row][col]), (my_symbol == 'X') ? "X" : "O");
+        }
+
+        if (!offline_mode) {
+            char msg[50];
+            snprintf(msg, sizeof(msg), "MOVE %d %d %c", row, col, my_symbol);
+            send_message(web_socket, msg);
+        }
+
+        update_turn((my_symbol == 'X') ? 'O' : 'X');
+        if (offline_mode && board.state == MNK_PLAYING) {
+            request_ai_move();
+        }
+    }
+    else {
+        gtk_label_set_text(GTK_LABEL(status_label), mnk_result_text(result));
+    }
+}
+
 static void on_button_clicked(GtkWidget* widget, gpointer data) {
-    if (!gtk_widget_get_sensitive(widget)) { // ư Ȱȭ ¶ ƹ ۾  
+    if (!gtk_widget_get_sensitive(widget)) { // Ignore clicks on disabled buttons
         return;
     }
 
     int pos = GPOINTER_TO_INT(data);
-    int row = pos / 3;
-    int col = pos % 3;
+    play_local_move(pos / 3, pos % 3);
+}
+
+// Paint the whole gomoku board; a single widget keeps 19x19 as cheap as 3x3
+static gboolean on_board_draw(GtkWidget* widget, cairo_t* cr, gpointer data) {
+    const double half = CELL_PIXELS / 2.0;
+    const double span = CELL_PIXELS * board_size - half;
+
+    cairo_set_source_rgb(cr, 0.86, 0.70, 0.42);
+    cairo_paint(cr);
+
+    cairo_set_source_rgb(cr, 0.0, 0.0, 0.0);
+    cairo_set_line_width(cr, 1.0);
+    for (int i = 0; i < board_size; i++) {
+        double p = CELL_PIXELS * i + half;
+        cairo_move_to(cr, half, p);
+        cairo_line_to(cr, span, p);
+        cairo_move_to(cr, p, half);
+        cairo_line_to(cr, p, span);
+    }
+    cairo_stroke(cr);
 
-    if (board[row][col] == 0) { //   Ȯ
-        board[row][col] = (my_symbol == 'X') ? 1 : 2;
-        gtk_button_set_label(GTK_BUTTON(buttons[row][col]), (my_symbol == 'X') ? "X" : "O");
+    for (int row = 0; row < board_size; row++) {
+        for (int col = 0; col < board_size; col++) {
+            int cell = mnk_cell(&board, row, col);
+            if (cell == MNK_EMPTY) continue;
 
-        char msg[50];
-        snprintf(msg, sizeof(msg), "MOVE %d %d %c", row, col, my_symbol);
-        send_message(web_socket, msg);
+            cairo_arc(cr, CELL_PIXELS * col + half, CELL_PIXELS * row + half, half * 0.85, 0, 2 * G_PI);
+            if (cell == MNK_X) {
+                cairo_set_source_rgb(cr, 0.0, 0.0, 0.0);
+                cairo_fill(cr);
+            }
+            else {
+                cairo_set_source_rgb(cr, 1.0, 1.0, 1.0);
+                cairo_fill_preserve(cr);
+                cairo_set_source_rgb(cr, 0.0, 0.0, 0.0);
+                cairo_stroke(cr);
+            }
+        }
+    }
 
-        update_turn((my_symbol == 'X') ? 'O' : 'X'); //  Ʈ
+    // Mark the last move, it is hard to spot on a large board
+    if (board.last_cell >= 0) {
+        int row = board.last_cell / board_size;
+        int col = board.last_cell % board_size;
+        cairo_set_source_rgb(cr, 0.9, 0.1, 0.1);
+        cairo_arc(cr, CELL_PIXELS * col + half, CELL_PIXELS * row + half, half * 0.2, 0, 2 * G_PI);
+        cairo_fill(cr);
     }
-    else {
-        gtk_label_set_text(GTK_LABEL(status_label), "Invalid move! Position already taken.");
+    return FALSE;
+}
+
+static gboolean on_board_pressed(GtkWidget* widget, GdkEventButton* event, gpointer data) {
+    if (event->button != 1 || current_turn != my_symbol) {
+        return TRUE;
     }
+
+    play_local_move((int)(event->y / CELL_PIXELS), (int)(event->x / CELL_PIXELS));
+    return TRUE;
 }
 
 // WebSocket callback function
@@ -112,11 +329,52 @@ static int callback_messenger(struct lws* wsi, enum lws_callback_reasons reason,
         send_message(wsi, "CONNECTED");
         break;
     case LWS_CALLBACK_CLIENT_RECEIVE: {
-        char* message = g_strdup_printf("%.*s", (int)len, (char*)in);
+        // Messages longer than MESSAGE_SIZE (live scoreboard pushes) arrive in pieces
+        static GString* partial = NULL;
+        static int binary = 0;
+        if (!partial) {
+            partial = g_string_new(NULL);
+            binary = lws_frame_is_binary(wsi);
+        }
+        g_string_append_len(partial, (const char*)in, (gssize)len);
+        if (!lws_is_final_fragment(wsi) || lws_remaining_packet_payload(wsi)) break;
+
+        size_t length = partial->len;
+        char* message = g_string_free(partial, FALSE);
+        partial = NULL;
+        if (binary) {
+            // Large messages come deflated (wsz.h)
+            char* text = wsz_decode((const unsigned char*)message, length, NULL);
+            g_free(message);
+            if (!text) {
+                fprintf(stderr, "Dropping undecodable binary message\n");
+                break;
+            }
+            message = g_strdup(text);
+            free(text);
+        }
         printf("Received message: %s\n", message); // α ߰
         g_async_queue_push(message_queue, message);
         break;
     }
+    case LWS_CALLBACK_CLIENT_APPEND_HANDSHAKE_HEADER: {
+        // The server checks the login token itself when we join (auth.h)
+        char* token = auth_token_dup();
+        if (!token) break;
+        unsigned char** p = (unsigned char**)in;
+        char* value = g_strdup_printf("Bearer %s", token);
+        int failed = lws_add_http_header_by_token(wsi, WSI_TOKEN_HTTP_AUTHORIZATION,
+            (const unsigned char*)value, (int)strlen(value), p, *p + len);
+        g_free(value);
+        g_free(token);
+        if (failed) return -1;
+        break;
+    }
+    case LWS_CALLBACK_CLIENT_CONNECTION_ERROR:
+        printf("WebSocket connection failed: %s\n", in ? (char*)in : "(unknown)");
+        g_async_queue_push(message_queue, g_strdup("OFFLINE"));
+        interrupted = 1;
+        break;
     case LWS_CALLBACK_CLOSED:
         printf("WebSocket closed\n"); // α ߰
         g_async_queue_push(message_queue, g_strdup("Connection closed."));
@@ -153,7 +411,8 @@ static struct lws_context* initialize_websocket() {
     web_socket = lws_client_connect_via_info(&connect_info);
     if (!web_socket) {
         fprintf(stderr, "Failed to connect to WebSocket server\n");
-        exit(1);
+        g_async_queue_push(message_queue, g_strdup("OFFLINE"));
+        interrupted = 1;
     }
 
     return context;
@@ -171,12 +430,17 @@ void* websocket_thread(void* arg) {
 // ư  Ʈ Լ
 static gboolean update_button_label(gpointer data) {
     int pos = GPOINTER_TO_INT(data);
-    int row = pos / 3;
-    int col = pos % 3;
+    int row = pos / board_size;
+    int col = pos % board_size;
+
+    if (board_area) {
+        gtk_widget_queue_draw(board_area);
+        return FALSE;
+    }
 
     // ư  Ʈ
     gtk_button_set_label(GTK_BUTTON(buttons[row][col]),
-        (board[row][col] == 1) ? "X" : "O");
+        (mnk_cell(&board, row, col) == MNK_X) ? "X" : "O");
 
     //  ư ٽ ׸
     gtk_widget_queue_draw(GTK_WIDGET(buttons[row][col]));
@@ -194,10 +458,45 @@ static gboolean process_queue() {
         printf("Processing message: %s\n", message); //  ޽ α ߰
         int row, col;
         char symbol;
+        char sender[50];
+
+        // Server unreachable, switch to the local AI opponent
+        if (strcmp(message, "OFFLINE") == 0) {
+            scoreboard_set_live_sender(NULL);
+            tetris_set_versus_sender(NULL, NULL);
+            start_offline_game();
+        }
+
+        // Live scoreboard push, the payload is JSON
+        else if (strncmp(message, "RANKS ", 6) == 0) {
+            scoreboard_live_update(message + 6);
+        }
+
+        // Tetris versus traffic from the room
+        else if (strstr(message, ": VS ")) {
+            tetris_versus_message(message);
+        }
+
+        else if (strcmp(message, "CONNECTED") == 0) {
+            scoreboard_set_live_sender(send_live_message);
+            tetris_set_versus_sender(send_live_message, user_id);
+        }
+
+        else if (strcmp(message, "Connection closed.") == 0) {
+            scoreboard_set_live_sender(NULL);
+            tetris_set_versus_sender(NULL, NULL);
+        }
+
+        // The opponent's board size and rule
+        else if (sscanf(message, "[%*[^]]] %49[^:]: BOARD %d %d", sender, &row, &col) == 3) {
+            check_board(sender, row, col);
+        }
 
         //   ޽ ó  ʱ  
-        if (strstr(message, "Game starts!")) {
+        else if (strstr(message, "Game starts!")) {
             players_connected = 2;
+            // Both players are in the room now, so each one hears the other's board
+            send_board();
             gtk_label_set_text(GTK_LABEL(status_label), "Game started!");
             // ʱ  X , X O Ȱȭ  
             update_turn('X'); //  ۵Ǹ X Ѵٰ 
@@ -226,13 +525,24 @@ static gboolean process_queue() {
 
         //   ó
         else if (sscanf(message, "[%*[^]]] %*[^:]: MOVE %d %d %c", &row, &col, &symbol) == 3) {
-            if (board[row][col] == 0) {
-                board[row][col] = (symbol == 'X') ? 1 : 2;
-                g_idle_add((GSourceFunc)update_button_label, GINT_TO_POINTER(row * 3 + col));
+            // The server echoes our own move back, it is already on the board
+            if (symbol == my_symbol && row * board_size + col == my_last_cell) {
+                my_last_cell = -1;
+            }
+            else if (mnk_play(&board, mnk_side_of(symbol), row, col) == MNK_OK) {
+                g_idle_add((GSourceFunc)update_button_label, GINT_TO_POINTER(row * board_size + col));
                 // ̵   Ʈ
                 current_turn = (symbol == 'X') ? 'O' : 'X';
-                gtk_label_set_text(GTK_LABEL(status_label),
-                    (current_turn == my_symbol) ? "Your turn!" : "Wait for your turn!");
+                if (board.state != MNK_PLAYING) {
+                    show_game_over();
+                }
+                else {
+                    gtk_label_set_text(GTK_LABEL(status_label),
+                        (current_turn == my_symbol) ? "Your turn!" : "Wait for your turn!");
+                }
+            }
+            else {
+                printf("Rejected move: %d %d %c\n", row, col, symbol);
             }
         }
 
@@ -250,12 +560,19 @@ static gboolean process_queue() {
 // Main function
 int main(int argc, char** argv) {
     gtk_init(&argc, &argv);
+    auth_init();
 
     prompt_for_room_and_user();
+    if (mnk_rules_init(&board_rules, board_size, board_size, win_length) != 0) {
+        fprintf(stderr, "Failed to initialize board rules\n");
+        return 1;
+    }
+    mnk_board_init(&board, &board_rules);
+    mnk_board_track_runs(&board, &board_runs);
     message_queue = g_async_queue_new();
 
     GtkWidget* window = gtk_window_new(GTK_WINDOW_TOPLEVEL);
-    gtk_window_set_title(GTK_WINDOW(window), "Tic-Tac-Toe");
+    gtk_window_set_title(GTK_WINDOW(window), (board_size == 3) ? "Tic-Tac-Toe" : "Gomoku");
     gtk_container_set_border_width(GTK_CONTAINER(window), 10);
 
     GtkWidget* grid = gtk_grid_new();
@@ -264,13 +581,23 @@ int main(int argc, char** argv) {
     status_label = gtk_label_new("Waiting for second player...");
     gtk_grid_attach(GTK_GRID(grid), status_label, 0, 0, 3, 1);
 
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 3; j++) {
-            buttons[i][j] = gtk_button_new_with_label(" ");
-            gtk_grid_attach(GTK_GRID(grid), buttons[i][j], j, i + 1, 1, 1);
-            g_signal_connect(buttons[i][j], "clicked", G_CALLBACK(on_button_clicked), GINT_TO_POINTER(i * 3 + j));
+    if (board_size == 3) {
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                buttons[i][j] = gtk_button_new_with_label(" ");
+                gtk_grid_attach(GTK_GRID(grid), buttons[i][j], j, i + 1, 1, 1);
+                g_signal_connect(buttons[i][j], "clicked", G_CALLBACK(on_button_clicked), GINT_TO_POINTER(i * 3 + j));
+            }
         }
     }
+    else {
+        board_area = gtk_drawing_area_new();
+        gtk_widget_set_size_request(board_area, CELL_PIXELS * board_size, CELL_PIXELS * board_size);
+        gtk_widget_add_events(board_area, GDK_BUTTON_PRESS_MASK);
+        g_signal_connect(board_area, "draw", G_CALLBACK(on_board_draw), NULL);
+        g_signal_connect(board_area, "button-press-event", G_CALLBACK(on_board_pressed), NULL);
+        gtk_grid_attach(GTK_GRID(grid), board_area, 0, 1, 3, 1);
+    }
     gtk_widget_show_all(window);
 
     struct lws_context* context = initialize_websocket();
@@ -281,8 +608,19 @@ int main(int argc, char** argv) {
     gtk_main();
 
     interrupted = 1;
+    ai_cancel = 1;
+    // The search reads board_rules through its snapshot
+    if (ai_worker_started) pthread_join(ai_worker, NULL);
     pthread_join(ws_thread, NULL);
     lws_context_destroy(context);
+    // The scoreboard, login and score uploads share one HTTP client, stopped once here
+    score_client_shutdown();
+    http_client_shutdown();
+    lbcache_log_stats();
+    // Hint and autoplay searches still running give up once their pool stops
+    g2048_ai_shutdown();
+    tetris_ai_shutdown();
+    mnk_rules_free(&board_rules);
     return 0;
 }
     
\ No newline at end of file
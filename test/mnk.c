@@ -0,0 +1,223 @@
+// m,n,k-game rules engine (see mnk.h)
+#include "mnk.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static const int directions[4][2] = { { 0, 1 }, { 1, 0 }, { 1, 1 }, { 1, -1 } };
+
+static bool line_fits(const struct mnk_rules* rules, int row, int col, int d) {
+    int end_row = row + directions[d][0] * (rules->k - 1);
+    int end_col = col + directions[d][1] * (rules->k - 1);
+    return end_row >= 0 && end_row < rules->rows && end_col >= 0 && end_col < rules->cols;
+}
+
+int mnk_rules_init(struct mnk_rules* rules, int rows, int cols, int k) {
+    memset(rules, 0, sizeof(*rules));
+    if (rows < 1 || cols < 1 || rows > MNK_MAX_SIDE || cols > MNK_MAX_SIDE || k < 1) {
+        return -1;
+    }
+    rules->rows = rows;
+    rules->cols = cols;
+    rules->k = k;
+    rules->cells = rows * cols;
+    rules->words = (rules->cells + 63) / 64;
+
+    // First pass: count lines so everything can be allocated up front
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            for (int d = 0; d < 4; d++) {
+                // A single cell is a line in every direction, count it once
+                if (k == 1 && d > 0) break;
+                if (line_fits(rules, r, c, d)) rules->line_count++;
+            }
+        }
+    }
+    if (rules->line_count == 0) {
+        return -1;
+    }
+
+    rules->lines = calloc(rules->line_count, sizeof(mnk_bits));
+    rules->cell_line_start = calloc(rules->cells + 1, sizeof(int));
+    rules->cell_lines = calloc((size_t)rules->line_count * k, sizeof(uint16_t));
+    if (!rules->lines || !rules->cell_line_start || !rules->cell_lines) {
+        mnk_rules_free(rules);
+        return -1;
+    }
+
+    // Second pass: build the masks and count how many lines cross each cell
+    int n = 0;
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            for (int d = 0; d < 4; d++) {
+                if (k == 1 && d > 0) break;
+                if (!line_fits(rules, r, c, d)) continue;
+                for (int i = 0; i < k; i++) {
+                    int cell = (r + directions[d][0] * i) * cols + (c + directions[d][1] * i);
+                    mnk_bit_set(&rules->lines[n], cell);
+                    rules->cell_line_start[cell + 1]++;
+                }
+                n++;
+            }
+        }
+    }
+    for (int cell = 0; cell < rules->cells; cell++) {
+        rules->cell_line_start[cell + 1] += rules->cell_line_start[cell];
+    }
+
+    // Third pass: bucket line indices per cell
+    int* fill = calloc(rules->cells, sizeof(int));
+    if (!fill) {
+        mnk_rules_free(rules);
+        return -1;
+    }
+    for (int line = 0; line < rules->line_count; line++) {
+        for (int cell = 0; cell < rules->cells; cell++) {
+            if (mnk_bit_test(&rules->lines[line], cell)) {
+                rules->cell_lines[rules->cell_line_start[cell] + fill[cell]++] = (uint16_t)line;
+            }
+        }
+    }
+    free(fill);
+    return 0;
+}
+
+void mnk_rules_free(struct mnk_rules* rules) {
+    free(rules->lines);
+    free(rules->cell_line_start);
+    free(rules->cell_lines);
+    rules->lines = NULL;
+    rules->cell_line_start = NULL;
+    rules->cell_lines = NULL;
+    rules->line_count = 0;
+}
+
+void mnk_board_init(struct mnk_board* board, const struct mnk_rules* rules) {
+    memset(board, 0, sizeof(*board));
+    board->rules = rules;
+    board->to_move = MNK_SIDE_X;
+    board->last_cell = -1;
+    board->state = MNK_PLAYING;
+}
+
+// Switches win detection for this board to incremental run lengths. Boards
+// tracking runs must not be unplayed with mnk_undo().
+void mnk_board_track_runs(struct mnk_board* board, struct mnk_runs* runs) {
+    memset(runs, 0, sizeof(*runs));
+    board->runs = runs;
+}
+
+// Joins the stone at cell with the runs ending next to it and returns the
+// longest run through cell. Runs are only read at their end cells.
+int mnk_runs_place(struct mnk_runs* runs, const struct mnk_board* board, int side, int cell) {
+    const struct mnk_rules* rules = board->rules;
+    const mnk_bits* stones = &board->stones[side];
+    int row = cell / rules->cols;
+    int col = cell % rules->cols;
+    int longest = 1;
+
+    for (int d = 0; d < 4; d++) {
+        int dr = directions[d][0];
+        int dc = directions[d][1];
+        int step = dr * rules->cols + dc;
+        int before = 0;
+        int after = 0;
+
+        int r = row - dr, c = col - dc;
+        if (r >= 0 && r < rules->rows && c >= 0 && c < rules->cols && mnk_bit_test(stones, cell - step)) {
+            before = runs->len[d][cell - step];
+        }
+        r = row + dr;
+        c = col + dc;
+        if (r >= 0 && r < rules->rows && c >= 0 && c < rules->cols && mnk_bit_test(stones, cell + step)) {
+            after = runs->len[d][cell + step];
+        }
+
+        int total = before + 1 + after;
+        runs->len[d][cell] = (uint16_t)total;
+        runs->len[d][cell - before * step] = (uint16_t)total;
+        runs->len[d][cell + after * step] = (uint16_t)total;
+        if (total > longest) longest = total;
+    }
+    return longest;
+}
+
+int mnk_cell(const struct mnk_board* board, int row, int col) {
+    int cell = row * board->rules->cols + col;
+    if (mnk_bit_test(&board->stones[MNK_SIDE_X], cell)) return MNK_X;
+    if (mnk_bit_test(&board->stones[MNK_SIDE_O], cell)) return MNK_O;
+    return MNK_EMPTY;
+}
+
+bool mnk_wins_at(const struct mnk_board* board, int side, int cell) {
+    const struct mnk_rules* rules = board->rules;
+    const mnk_bits* stones = &board->stones[side];
+
+    for (int i = rules->cell_line_start[cell]; i < rules->cell_line_start[cell + 1]; i++) {
+        const mnk_bits* mask = &rules->lines[rules->cell_lines[i]];
+        int w = 0;
+        while (w < rules->words && (stones->w[w] & mask->w[w]) == mask->w[w]) w++;
+        if (w == rules->words) return true;
+    }
+    return false;
+}
+
+enum mnk_result mnk_check(const struct mnk_board* board, int side, int row, int col) {
+    const struct mnk_rules* rules = board->rules;
+
+    if (board->state != MNK_PLAYING) return MNK_ERR_OVER;
+    if (row < 0 || row >= rules->rows || col < 0 || col >= rules->cols) return MNK_ERR_RANGE;
+    if (side != board->to_move) return MNK_ERR_TURN;
+
+    int cell = row * rules->cols + col;
+    if (mnk_bit_test(&board->stones[0], cell) || mnk_bit_test(&board->stones[1], cell)) {
+        return MNK_ERR_OCCUPIED;
+    }
+    return MNK_OK;
+}
+
+enum mnk_result mnk_play(struct mnk_board* board, int side, int row, int col) {
+    enum mnk_result result = mnk_check(board, side, row, col);
+    if (result != MNK_OK) return result;
+
+    int cell = row * board->rules->cols + col;
+    mnk_bit_set(&board->stones[side], cell);
+    board->moves++;
+    board->last_cell = cell;
+    board->to_move = side ^ 1;
+
+    bool won = board->runs
+        ? mnk_runs_place(board->runs, board, side, cell) >= board->rules->k
+        : mnk_wins_at(board, side, cell);
+    if (won) {
+        board->state = (side == MNK_SIDE_X) ? MNK_WIN_X : MNK_WIN_O;
+    }
+    else if (board->moves == board->rules->cells) {
+        board->state = MNK_DRAW;
+    }
+    return MNK_OK;
+}
+
+// Takes back a stone placed by mnk_play (used by search code, which plays
+// and unplays in strict LIFO order)
+void mnk_undo(struct mnk_board* board, int row, int col) {
+    int cell = row * board->rules->cols + col;
+    int side = board->to_move ^ 1;
+
+    mnk_bit_clear(&board->stones[side], cell);
+    board->moves--;
+    board->to_move = side;
+    board->last_cell = -1;
+    board->state = MNK_PLAYING;
+}
+
+const char* mnk_result_text(enum mnk_result result) {
+    switch (result) {
+    case MNK_OK: return "OK";
+    case MNK_ERR_RANGE: return "Invalid move! Position is off the board.";
+    case MNK_ERR_OCCUPIED: return "Invalid move! Position already taken.";
+    case MNK_ERR_TURN: return "Invalid move! Wait for your turn.";
+    case MNK_ERR_OVER: return "Game is over.";
+    }
+    return "Unknown error";
+}
@@ -0,0 +1,217 @@
+#define _CRT_SECURE_NO_WARNINGS
+// Game replays (see replay.h)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "g2048_play.h"
+#include "replay.h"
+#include "tetris_sim.h"
+
+#define REPLAY_VERSION 1
+#define MAX_DELTA_MS (INT64_C(1) << 40)  // a stream this far apart is broken
+
+static void put(struct replay* replay, const uint8_t* bytes, size_t count) {
+    if (replay->failed) return;
+    if (replay->size + count > replay->capacity) {
+        size_t capacity = replay->capacity ? replay->capacity * 2 : 1024;
+        while (capacity < replay->size + count) capacity *= 2;
+        uint8_t* data = capacity > REPLAY_MAX_BYTES ? NULL : (uint8_t*)realloc(replay->data, capacity);
+        if (!data) {
+            replay->failed = true;
+            return;
+        }
+        replay->data = data;
+        replay->capacity = capacity;
+    }
+    memcpy(replay->data + replay->size, bytes, count);
+    replay->size += count;
+}
+
+static void put_varint(struct replay* replay, uint64_t value) {
+    uint8_t bytes[10];
+    size_t count = 0;
+    while (value >= 0x80) {
+        bytes[count++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    bytes[count++] = (uint8_t)value;
+    put(replay, bytes, count);
+}
+
+void replay_start(struct replay* replay, enum replay_game game, int param, uint64_t seed) {
+    replay->size = 0;
+    replay->last_ms = 0;
+    replay->ended = false;
+    replay->failed = false;
+
+    uint8_t header[REPLAY_HEADER] = { 'R', 'P', REPLAY_VERSION, (uint8_t)game, (uint8_t)param };
+    for (int i = 0; i < 8; i++) header[5 + i] = (uint8_t)(seed >> (8 * i));
+    put(replay, header, sizeof(header));
+}
+
+static void add_event(struct replay* replay, int64_t time_ms, int code) {
+    if (replay->ended) {
+        replay->failed = true;
+        return;
+    }
+    if (time_ms < replay->last_ms) time_ms = replay->last_ms;
+    put_varint(replay, ((uint64_t)(time_ms - replay->last_ms) << 4) | (uint64_t)code);
+    replay->last_ms = time_ms;
+}
+
+void replay_add(struct replay* replay, int64_t time_ms, int code) {
+    if (code < 0 || code >= REPLAY_END) {
+        replay->failed = true;
+        return;
+    }
+    add_event(replay, time_ms, code);
+}
+
+void replay_end(struct replay* replay, int64_t time_ms) {
+    add_event(replay, time_ms, REPLAY_END);
+    replay->ended = true;
+}
+
+bool replay_complete(const struct replay* replay) {
+    return replay->ended && !replay->failed;
+}
+
+void replay_free(struct replay* replay) {
+    free(replay->data);
+    memset(replay, 0, sizeof(*replay));
+}
+
+int replay_save(const struct replay* replay, const char* path) {
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        fprintf(stderr, "Failed to write replay %s\n", path);
+        return -1;
+    }
+    size_t written = fwrite(replay->data, 1, replay->size, file);
+    if (fclose(file) != 0 || written != replay->size) {
+        fprintf(stderr, "Failed to write replay %s\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+uint8_t* replay_load(const char* path, size_t* size) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return NULL;
+    uint8_t* data = (uint8_t*)malloc(REPLAY_MAX_BYTES + 1);
+    size_t count = data ? fread(data, 1, REPLAY_MAX_BYTES + 1, file) : 0;
+    fclose(file);
+    if (!data || count > REPLAY_MAX_BYTES) {
+        free(data);
+        return NULL;
+    }
+    *size = count;
+    return data;
+}
+
+bool replay_open(struct replay_reader* reader, const uint8_t* data, size_t size) {
+    if (size < REPLAY_HEADER || data[0] != 'R' || data[1] != 'P' || data[2] != REPLAY_VERSION) return false;
+    reader->game = (enum replay_game)data[3];
+    reader->param = data[4];
+    reader->seed = 0;
+    for (int i = 0; i < 8; i++) reader->seed |= (uint64_t)data[5 + i] << (8 * i);
+    reader->p = data + REPLAY_HEADER;
+    reader->end = data + size;
+    reader->time_ms = 0;
+    return true;
+}
+
+int replay_next(struct replay_reader* reader, int* code) {
+    uint64_t value = 0;
+    for (int shift = 0;; shift += 7) {
+        if (reader->p == reader->end || shift > 63) return -1;
+        uint8_t byte = *reader->p++;
+        value |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) break;
+    }
+    if ((value >> 4) > (uint64_t)MAX_DELTA_MS) return -1;
+    reader->time_ms += (int64_t)(value >> 4);
+    *code = (int)(value & 0xF);
+    return *code == REPLAY_END ? 0 : 1;
+}
+
+static bool run_tetris(struct replay_reader* reader, int64_t max_ms, struct replay_result* result) {
+    // About 1 KB, and a verifier may run several at once, so not static
+    struct tetris_sim* sim = (struct tetris_sim*)malloc(sizeof(*sim));
+    if (!sim) return false;
+    tetris_sim_init(sim, reader->seed);
+
+    int code, status = -1;
+    bool ok = true;
+    while (ok && (status = replay_next(reader, &code)) > 0) {
+        int64_t time = reader->time_ms * 1000;
+        if (code >= 2 * TETRIS_KEYS || (max_ms && reader->time_ms > max_ms)) {
+            ok = false;
+            break;
+        }
+        // Up to the input's step first so the queue stays short, as in the game
+        tetris_sim_advance(sim, time - TETRIS_SIM_STEP_US);
+        struct tetris_input input = { time, (uint8_t)(code >> 1), (code & 1) != 0, 0, 0 };
+        ok = tetris_sim_input(sim, &input);
+        result->inputs++;
+    }
+    if (ok && status == 0 && (!max_ms || reader->time_ms <= max_ms)) {
+        tetris_sim_advance(sim, reader->time_ms * 1000);
+        result->score = sim->game.score;
+        result->over = sim->game.over;
+    }
+    else {
+        ok = false;
+    }
+    free(sim);
+    return ok;
+}
+
+static bool run_2048(struct replay_reader* reader, int64_t max_ms, struct replay_result* result) {
+    if (reader->param != G2048_SIZE && (reader->param < 5 || reader->param > G2048B_MAX_SIZE)) return false;
+    struct g2048_play* play = (struct g2048_play*)malloc(sizeof(*play));
+    if (!play) return false;
+    if (g2048_play_init(play) != 0) {
+        free(play);
+        return false;
+    }
+    g2048_play_new(play, reader->param, reader->seed);
+
+    // Every recorded input changed the game; one that cannot is forged
+    int code, status = -1;
+    bool ok = true;
+    while (ok && (status = replay_next(reader, &code)) > 0) {
+        if (max_ms && reader->time_ms > max_ms) ok = false;
+        else if (code <= G2048_DOWN) ok = g2048_play_move(play, (enum g2048_move)code);
+        else if (code == REPLAY_UNDO) ok = g2048_play_undo(play);
+        else if (code == REPLAY_REDO) ok = g2048_play_redo(play);
+        else ok = false;
+        result->inputs++;
+    }
+    ok = ok && status == 0;
+    result->score = play->score;
+    result->over = play->over;
+    g2048_play_free(play);
+    free(play);
+    return ok;
+}
+
+bool replay_run(const uint8_t* data, size_t size, int64_t max_ms, struct replay_result* result) {
+    struct replay_reader reader;
+    memset(result, 0, sizeof(*result));
+    if (!replay_open(&reader, data, size)) return false;
+    result->game = reader.game;
+    result->param = reader.param;
+    result->seed = reader.seed;
+
+    bool ok;
+    switch (reader.game) {
+    case REPLAY_TETRIS: ok = run_tetris(&reader, max_ms, result); break;
+    case REPLAY_2048: ok = run_2048(&reader, max_ms, result); break;
+    default: return false;
+    }
+    result->duration_ms = reader.time_ms;
+    // Nothing may follow the end
+    return ok && reader.p == reader.end;
+}
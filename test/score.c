@@ -0,0 +1,410 @@
+#define _CRT_SECURE_NO_WARNINGS
+// Scoreboard submission.
+//
+// Every score is first appended to a local outbox file, so nothing is lost
+// while the scoreboard server is unreachable. A dedicated uploader thread
+// sends the outbox in batches (one JSON array per request) through the
+// shared HTTP client and persists how far the server has acknowledged. Each
+// score carries a client-generated id, which the server remembers for eight
+// days, so a batch that is re-sent after a crash or a lost response does not
+// count twice. Scores also carry the time they were played, which decides
+// their day and week windows however late they arrive. Callbacks are handed
+// back to the GTK thread with g_idle_add, the GTK thread never waits for the
+// network.
+// Batches carry the login token (auth.h); a rejected token is refreshed and
+// the batch retried like any other failure. Scores carry the replay of their
+// game in base64, which the server plays again before filing the score, so
+// outbox lines run to tens of KB.
+#include <curl/curl.h>
+#include <json-c/json.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "auth.h"
+#include "games.h"
+#include "http_client.h"
+
+#define SCORE_SERVER_URL "http://192.168.55.239:8080/scores/batch"
+#define SCORE_TIMEOUT_SECONDS 10L
+#define SCORE_POLL_US 1000000
+#define OUTBOX_FILE "scores.outbox"
+#define OUTBOX_CURSOR_FILE "scores.outbox.pos"
+#define OUTBOX_BATCH_MAX 100                // scores per request
+#define OUTBOX_BATCH_DELAY_US 2000000       // wait up to 2 s to fill a batch
+#define RETRY_MIN_US 1000000
+#define RETRY_MAX_US 60000000
+
+struct score_record {
+    char* json;                  // outbox line, without the newline
+    long end_offset;             // outbox offset just past this record, -1 if not on disk
+    gint64 queued_at;            // monotonic time, 0 for records loaded from disk
+    char game[32];
+    int score;
+    score_callback callback;
+    gpointer user_data;
+    gboolean ok;
+};
+
+struct score_batch {
+    char* body;
+    int count;
+    struct Memory response;
+    struct curl_slist* headers;
+    CURLcode result;
+    long http_status;
+};
+
+// Uploader thread input: either a new record or a finished batch
+struct score_event {
+    struct score_record* record;
+    struct score_batch* batch;
+};
+
+static GAsyncQueue* events = NULL;       // -> uploader thread
+static GQueue* pending = NULL;           // uploader thread only: records not yet acknowledged
+static struct score_batch* in_flight = NULL;
+static pthread_t io_thread;
+static pthread_once_t io_once = PTHREAD_ONCE_INIT;
+static int io_started = 0;
+static volatile int io_stop = 0;
+static gint64 retry_at = 0;
+static gint64 retry_delay = RETRY_MIN_US;
+
+static pthread_mutex_t outbox_lock = PTHREAD_MUTEX_INITIALIZER;
+static FILE* outbox = NULL;              // append-only, guarded by outbox_lock
+static char* outbox_path = NULL;
+static char* cursor_path = NULL;
+static long cursor = 0;                  // uploader thread only: acknowledged prefix of the outbox
+
+// Append a received chunk to the struct Memory passed as userp
+size_t write_callback(void* data, size_t size, size_t nmemb, void* userp) {
+    size_t realsize = size * nmemb;
+    struct Memory* mem = (struct Memory*)userp;
+
+    char* ptr = realloc(mem->response, mem->size + realsize + 1);
+    if (!ptr) {
+        return 0; // Out of memory, makes curl fail the transfer
+    }
+
+    mem->response = ptr;
+    memcpy(&(mem->response[mem->size]), data, realsize);
+    mem->size += realsize;
+    mem->response[mem->size] = 0;
+    return realsize;
+}
+
+static void free_record(struct score_record* rec) {
+    g_free(rec->json);
+    g_free(rec);
+}
+
+// Runs on the GTK thread
+static gboolean deliver_result(gpointer data) {
+    struct score_record* rec = (struct score_record*)data;
+    rec->callback(rec->game, rec->score, rec->ok, rec->ok ? 200 : 0, rec->user_data);
+    free_record(rec);
+    return FALSE;
+}
+
+static void complete_record(struct score_record* rec, gboolean ok) {
+    if (!rec->callback) {
+        free_record(rec);
+        return;
+    }
+    rec->ok = ok;
+    g_idle_add(deliver_result, rec);
+}
+
+static void save_cursor(void) {
+    // A torn write only makes the next start re-send acknowledged scores,
+    // which the server drops by id
+    FILE* f = fopen(cursor_path, "w");
+    if (!f) return;
+    fprintf(f, "%ld\n", cursor);
+    fclose(f);
+}
+
+// Drop the outbox once everything in it has been acknowledged
+static void compact_outbox(void) {
+    if (!outbox || !g_queue_is_empty(pending) || g_async_queue_length(events) > 0) return;
+
+    pthread_mutex_lock(&outbox_lock);
+    if (ftell(outbox) == cursor && cursor > 0) {
+        fclose(outbox);
+        outbox = fopen(outbox_path, "wb");
+        cursor = 0;
+        save_cursor();
+    }
+    pthread_mutex_unlock(&outbox_lock);
+}
+
+// One line without its line break, however long; FALSE at the end of the file
+static gboolean read_line(FILE* f, GString* line) {
+    char chunk[4096];
+    g_string_truncate(line, 0);
+    while (fgets(chunk, sizeof(chunk), f)) {
+        g_string_append(line, chunk);
+        if (line->str[line->len - 1] == '\n') break;
+    }
+    if (!line->len) return FALSE;
+    while (line->len && (line->str[line->len - 1] == '\n' || line->str[line->len - 1] == '\r')) {
+        g_string_truncate(line, line->len - 1);
+    }
+    return TRUE;
+}
+
+// Re-queue everything after the acknowledged prefix from a previous session
+static void load_outbox(void) {
+    char* base = g_build_filename(g_get_user_data_dir(), "jik", NULL);
+    g_mkdir_with_parents(base, 0700);
+    outbox_path = g_build_filename(base, OUTBOX_FILE, NULL);
+    cursor_path = g_build_filename(base, OUTBOX_CURSOR_FILE, NULL);
+    g_free(base);
+
+    FILE* f = fopen(cursor_path, "r");
+    if (f) {
+        if (fscanf(f, "%ld", &cursor) != 1 || cursor < 0) cursor = 0;
+        fclose(f);
+    }
+
+    f = fopen(outbox_path, "rb");
+    if (f) {
+        GString* line = g_string_new(NULL);
+        if (fseek(f, cursor, SEEK_SET) != 0) cursor = 0;
+        while (read_line(f, line)) {
+            json_object* obj = json_tokener_parse(line->str);
+            if (!obj) continue; // torn last line after a crash
+            json_object_put(obj);
+
+            struct score_record* rec = g_new0(struct score_record, 1);
+            rec->json = g_strndup(line->str, line->len);
+            rec->end_offset = ftell(f);
+            g_queue_push_tail(pending, rec);
+        }
+        g_string_free(line, TRUE);
+        fclose(f);
+    }
+    if (!g_queue_is_empty(pending)) {
+        printf("Score outbox: %u scores waiting for upload\n", g_queue_get_length(pending));
+    }
+
+    outbox = fopen(outbox_path, "ab");
+    if (!outbox) {
+        fprintf(stderr, "Failed to open score outbox %s, scores are kept in memory only\n", outbox_path);
+    }
+}
+
+static void push_event(struct score_record* record, struct score_batch* batch) {
+    struct score_event* ev = g_new0(struct score_event, 1);
+    ev->record = record;
+    ev->batch = batch;
+    g_async_queue_push(events, ev);
+}
+
+// Runs on the HTTP client thread, hands the result back to the uploader
+static void batch_done(CURL* easy, CURLcode result, long http_status, void* user_data) {
+    struct score_batch* batch = (struct score_batch*)user_data;
+    (void)easy;
+    batch->result = result;
+    batch->http_status = http_status;
+    push_event(NULL, batch);
+}
+
+// Keep the scores and try again later, waiting twice as long each time
+static void back_off(void) {
+    retry_at = g_get_monotonic_time() + retry_delay;
+    retry_delay = (retry_delay * 2 > RETRY_MAX_US) ? RETRY_MAX_US : retry_delay * 2;
+}
+
+static void start_batch(void) {
+    CURL* easy = http_client_easy_new(SCORE_SERVER_URL);
+    if (!easy) {
+        // Without a retry time the batch stays due and the uploader would spin
+        fprintf(stderr, "Score upload: no HTTP handle, retrying in %lld s\n", (long long)(retry_delay / 1000000));
+        back_off();
+        return;
+    }
+
+    struct score_batch* batch = g_new0(struct score_batch, 1);
+    json_object* array = json_object_new_array();
+    for (GList* it = pending->head; it && batch->count < OUTBOX_BATCH_MAX; it = it->next) {
+        struct score_record* rec = (struct score_record*)it->data;
+        json_object_array_add(array, json_tokener_parse(rec->json));
+        batch->count++;
+    }
+    batch->body = g_strdup(json_object_to_json_string_ext(array, JSON_C_TO_STRING_PLAIN));
+    json_object_put(array);
+
+    batch->headers = curl_slist_append(NULL, "Content-Type: application/json");
+    char* token = auth_token_dup();
+    if (token) {
+        char* header = g_strdup_printf("Authorization: Bearer %s", token);
+        batch->headers = curl_slist_append(batch->headers, header);
+        g_free(header);
+        g_free(token);
+    }
+    curl_easy_setopt(easy, CURLOPT_HTTPHEADER, batch->headers);
+    curl_easy_setopt(easy, CURLOPT_POSTFIELDS, batch->body);
+    curl_easy_setopt(easy, CURLOPT_WRITEFUNCTION, write_callback);
+    curl_easy_setopt(easy, CURLOPT_WRITEDATA, (void*)&batch->response);
+    curl_easy_setopt(easy, CURLOPT_TIMEOUT, SCORE_TIMEOUT_SECONDS);
+
+    in_flight = batch;
+    if (http_client_submit(easy, batch_done, batch) != 0) {
+        curl_easy_cleanup(easy);
+        batch->result = CURLE_FAILED_INIT;
+        push_event(NULL, batch);
+    }
+}
+
+static void finish_batch(struct score_batch* batch) {
+    CURLcode result = batch->result;
+    long status = batch->http_status;
+    in_flight = NULL;
+
+    if (result == CURLE_OK && status >= 200 && status < 300) {
+        long end = -1;
+        for (int i = 0; i < batch->count; i++) {
+            struct score_record* rec = (struct score_record*)g_queue_pop_head(pending);
+            if (rec->end_offset >= 0) end = rec->end_offset;
+            complete_record(rec, TRUE);
+        }
+        if (end >= 0) {
+            cursor = end;
+            save_cursor();
+        }
+        retry_delay = RETRY_MIN_US;
+        compact_outbox();
+    }
+    else {
+        if (result == CURLE_OK && status == 401) auth_token_rejected();
+        // Keep the scores and back off; they stay in the outbox meanwhile
+        fprintf(stderr, "Score upload of %d scores failed: %s (HTTP %ld), retrying in %lld s\n",
+            batch->count, curl_easy_strerror(result), status, (long long)(retry_delay / 1000000));
+        back_off();
+    }
+
+    g_free(batch->body);
+    free(batch->response.response);
+    curl_slist_free_all(batch->headers);
+    g_free(batch);
+}
+
+// Microseconds until the next batch should go out, or -1 if nothing is due
+static gint64 next_batch_due(gint64 now) {
+    if (in_flight || g_queue_is_empty(pending)) return -1;
+
+    struct score_record* oldest = (struct score_record*)g_queue_peek_head(pending);
+    gint64 due = oldest->queued_at + OUTBOX_BATCH_DELAY_US;
+    if (g_queue_get_length(pending) >= OUTBOX_BATCH_MAX) due = now;
+    if (due < retry_at) due = retry_at;
+    return (due > now) ? due - now : 0;
+}
+
+// Uploader thread: collects new scores and uploads them in batches
+static void* score_io_thread(void* arg) {
+    (void)arg;
+    while (!io_stop) {
+        // Sleeps until a score is queued, a batch finishes or one is due
+        gint64 wait = next_batch_due(g_get_monotonic_time());
+        struct score_event* ev = (struct score_event*)g_async_queue_timeout_pop(events,
+            (wait >= 0 && wait < SCORE_POLL_US) ? (guint64)wait : SCORE_POLL_US);
+
+        if (ev) {
+            if (ev->record) g_queue_push_tail(pending, ev->record);
+            if (ev->batch) finish_batch(ev->batch);
+            g_free(ev);
+        }
+
+        if (next_batch_due(g_get_monotonic_time()) == 0) {
+            start_batch();
+        }
+    }
+    return NULL;
+}
+
+static void score_client_init(void) {
+    events = g_async_queue_new();
+    pending = g_queue_new();
+    load_outbox();
+
+    if (pthread_create(&io_thread, NULL, score_io_thread, NULL) != 0) {
+        fprintf(stderr, "Failed to start score upload thread\n");
+        return;
+    }
+    io_started = 1;
+}
+
+// Queue a score upload. The score is durable once this returns; callback
+// (may be NULL) runs on the GTK thread after the server has acknowledged it.
+// The server only files scores with a replay (replay.h) that plays back to
+// them; replay may be NULL for a game that was not recorded.
+void send_game_score_async(const char* username, const char* game, int score, const void* replay, size_t replay_size,
+    score_callback callback, gpointer user_data) {
+    pthread_once(&io_once, score_client_init);
+
+    struct score_record* rec = g_new0(struct score_record, 1);
+    g_strlcpy(rec->game, game, sizeof(rec->game));
+    rec->score = score;
+    rec->callback = callback;
+    rec->user_data = user_data;
+    rec->queued_at = g_get_monotonic_time();
+
+    char* id = g_uuid_string_random();
+    json_object* body = json_object_new_object();
+    json_object_object_add(body, "id", json_object_new_string(id));
+    json_object_object_add(body, "username", json_object_new_string(username));
+    json_object_object_add(body, "game", json_object_new_string(game));
+    json_object_object_add(body, "score", json_object_new_int(score));
+    json_object_object_add(body, "time", json_object_new_int64(g_get_real_time() / 1000000));
+    if (replay && replay_size) {
+        char* encoded = g_base64_encode((const guchar*)replay, replay_size);
+        json_object_object_add(body, "replay", json_object_new_string(encoded));
+        g_free(encoded);
+    }
+    rec->json = g_strdup(json_object_to_json_string_ext(body, JSON_C_TO_STRING_PLAIN));
+    json_object_put(body);
+    g_free(id);
+
+    rec->end_offset = -1;
+    pthread_mutex_lock(&outbox_lock);
+    if (outbox) {
+        fputs(rec->json, outbox);
+        fputc('\n', outbox);
+        fflush(outbox);
+        rec->end_offset = ftell(outbox);
+    }
+    pthread_mutex_unlock(&outbox_lock);
+
+    if (!io_started) {
+        // Stays in the outbox for the next session
+        complete_record(rec, FALSE);
+        return;
+    }
+    push_event(rec, NULL);
+}
+
+// Fire-and-forget submission, returns immediately
+void send_game_score(const char* username, const char* game, int score, const void* replay, size_t replay_size) {
+    send_game_score_async(username, game, score, replay, replay_size, NULL, NULL);
+}
+
+// Stop the uploader thread. Scores not yet acknowledged stay in the outbox and
+// are uploaded on the next start. The shared HTTP client belongs to main(),
+// which shuts it down after this; a batch still in flight ends there and its
+// result is left in the event queue.
+void score_client_shutdown(void) {
+    if (!io_started) return;
+
+    io_stop = 1;
+    push_event(NULL, NULL); // wake the uploader
+    pthread_join(io_thread, NULL);
+    io_started = 0;
+
+    pthread_mutex_lock(&outbox_lock);
+    if (outbox) fclose(outbox);
+    outbox = NULL;
+    pthread_mutex_unlock(&outbox_lock);
+}
@@ -0,0 +1,675 @@
+#define _CRT_SECURE_NO_WARNINGS
+// Scoreboard screen. The leaderboard is parsed while it downloads: each
+// chunk curl hands to the write callback goes straight into an incremental
+// lejp parser, and the rows completed by that chunk are posted to the GTK
+// thread, so the list starts filling after the first chunk instead of after
+// the whole response has been buffered.
+//
+// Responses are kept in the two-level leaderboard cache. A cached copy is
+// shown immediately; once it is older than LBCACHE_FRESH_SECONDS it is
+// revalidated with If-None-Match and only replaced when the server sends a
+// new body.
+//
+// The list is virtual. Rows are requested from the server by rank range, one
+// page of PAGE_ROWS at a time, only for the pages that are on screen, and at
+// most RESIDENT_PAGES pages are kept; the least recently used page is dropped
+// to make room. One drawing area paints the visible rows, so neither memory
+// nor widget count grows with the size of the leaderboard.
+//
+// While the game WebSocket is up, the visible range is also subscribed to
+// (SUBSCRIBE game window first count) and the server pushes RANKS messages
+// with just the rows that changed, which are patched into the resident pages.
+#include <gtk/gtk.h>
+#include <json-c/json.h>
+#include <libwebsockets.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "games.h"
+#include "http_client.h"
+#include "lbcache.h"
+
+#define SCOREBOARD_URL "http://192.168.55.239:8080/scores"
+#define SCOREBOARD_TIMEOUT_SECONDS 30L
+#define PAGE_ROWS 100
+#define RESIDENT_PAGES 32
+#define ROW_HEIGHT 24
+#define HEADER_HEIGHT 28
+#define LIVE_MAX_ROWS 100
+#define PAGE_RETRY_US 5000000            // a failed page is fetched again when in view after this
+
+struct scoreboard_row {
+    int rank;
+    char username[50];
+    int score;
+};
+
+// Rows of one page parsed from one or more chunks, on their way to the GTK thread
+struct row_batch {
+    guint generation;
+    long page;
+    long total;                  // leaderboard size, -1 until the response gave it
+    int count;
+    gboolean last;               // fetch finished, count may be 0
+    gboolean failed;
+    gboolean replace;            // clear the rows shown from the cache first
+    gboolean cached;             // rows came from the cache
+    struct scoreboard_row rows[PAGE_ROWS];
+};
+
+// One page download, owned by the HTTP client thread
+struct scoreboard_fetch {
+    guint generation;
+    long page;
+    CURL* easy;
+    char key[96];
+    char etag[128];              // from the response headers
+    GString* body;               // copy of a 200 response for the cache
+    struct curl_slist* headers;
+    gboolean clear_pending;      // cached rows are on screen until new ones arrive
+    gboolean cached;
+    struct lejp_ctx ctx;
+    struct scoreboard_row row;
+    gboolean row_has_data;
+    gboolean parse_failed;
+    struct row_batch* batch;
+    int rows_parsed;
+    long total;
+};
+
+// Response: {"total": N, "rows": [{"rank": r, "username": u, "score": s}, ...]}
+static const char* const row_paths[] = {
+    "total",
+    "rows[].rank",
+    "rows[].username",
+    "rows[].score",
+};
+
+enum { PATH_TOTAL = 1, PATH_RANK, PATH_USERNAME, PATH_SCORE };
+
+static const char* const game_names[] = { "2048", "tetris", "breakout", "minesweeper", "tictactoe" };
+static const char* const window_names[] = { "all", "week", "day" };
+static const char* const window_titles[] = { "All time", "This week", "Today" };
+
+struct page_slot {
+    long page;                   // -1 when the slot is free
+    guint generation;
+    int count;
+    gboolean loading;
+    gboolean failed;
+    gint64 retry_at;             // monotonic time a failed page may be fetched again
+    guint64 last_used;
+    struct scoreboard_row rows[PAGE_ROWS];
+};
+
+static struct {
+    GtkWidget* area;
+    GtkAdjustment* adjustment;
+    GtkWidget* game_combo;
+    GtkWidget* window_combo;
+    GtkWidget* status_label;
+    int game;
+    int window;
+    guint generation;            // bumped on every refresh, stale rows are dropped
+    long total;                  // -1 while unknown
+    long known_rows;             // lower bound used until the total is known
+    guint64 use_clock;
+    struct page_slot pages[RESIDENT_PAGES];
+
+    scoreboard_send_fn live_send;
+    guint live_generation;       // what the server was last asked to stream
+    long live_first;
+    int live_count;
+} view;
+
+static void request_visible_pages(void);
+
+static struct page_slot* find_page(long page) {
+    for (int i = 0; i < RESIDENT_PAGES; i++) {
+        if (view.pages[i].page == page && view.pages[i].generation == view.generation) return &view.pages[i];
+    }
+    return NULL;
+}
+
+// A free slot, or else the least recently used one
+static struct page_slot* claim_page(long page) {
+    struct page_slot* victim = &view.pages[0];
+    for (int i = 0; i < RESIDENT_PAGES; i++) {
+        struct page_slot* slot = &view.pages[i];
+        if (slot->page < 0 || slot->generation != view.generation) {
+            victim = slot;
+            break;
+        }
+        if (slot->last_used < victim->last_used) victim = slot;
+    }
+    // An in-flight fetch for the evicted page finds no slot and is dropped
+    victim->page = page;
+    victim->generation = view.generation;
+    victim->count = 0;
+    victim->loading = TRUE;
+    victim->failed = FALSE;
+    victim->last_used = ++view.use_clock;
+    return victim;
+}
+
+static void page_failed(struct page_slot* slot) {
+    slot->loading = FALSE;
+    slot->failed = TRUE;
+    slot->retry_at = g_get_monotonic_time() + PAGE_RETRY_US;
+}
+
+static long row_count(void) {
+    return view.total >= 0 ? view.total : view.known_rows;
+}
+
+static void update_adjustment(void) {
+    double page_size = gtk_widget_get_allocated_height(view.area) - HEADER_HEIGHT;
+    if (page_size < ROW_HEIGHT) page_size = ROW_HEIGHT;
+    gtk_adjustment_configure(view.adjustment, gtk_adjustment_get_value(view.adjustment),
+        0, (double)row_count() * ROW_HEIGHT, ROW_HEIGHT, page_size * 0.9, page_size);
+}
+
+// Runs on the GTK thread
+static gboolean append_rows(gpointer data) {
+    struct row_batch* batch = (struct row_batch*)data;
+    struct page_slot* slot = batch->generation == view.generation ? find_page(batch->page) : NULL;
+
+    if (slot) {
+        if (batch->replace) slot->count = 0;
+        int room = PAGE_ROWS - slot->count;
+        int count = batch->count < room ? batch->count : room;
+        memcpy(&slot->rows[slot->count], batch->rows, count * sizeof(batch->rows[0]));
+        slot->count += count;
+
+        if (batch->total >= 0) view.total = batch->total;
+        long end = batch->page * PAGE_ROWS + slot->count;
+        // Without a total, a full page means there may be more below it
+        if (batch->last && slot->count == PAGE_ROWS) end++;
+        if (end > view.known_rows) view.known_rows = end;
+
+        if (batch->last) {
+            if (batch->failed) page_failed(slot);
+            else slot->loading = FALSE;
+
+            char text[64];
+            if (batch->failed) snprintf(text, sizeof(text), "Failed to load scores");
+            else if (batch->cached) snprintf(text, sizeof(text), "%ld players (cached)", row_count());
+            else snprintf(text, sizeof(text), "%ld players", row_count());
+            gtk_label_set_text(GTK_LABEL(view.status_label), text);
+        }
+
+        update_adjustment();
+        gtk_widget_queue_draw(view.area);
+        if (batch->last) request_visible_pages();
+    }
+    g_free(batch);
+    return FALSE;
+}
+
+static struct row_batch* new_batch(struct scoreboard_fetch* fetch) {
+    struct row_batch* batch = g_new0(struct row_batch, 1);
+    batch->generation = fetch->generation;
+    batch->page = fetch->page;
+    batch->replace = fetch->clear_pending;
+    fetch->clear_pending = FALSE;
+    return batch;
+}
+
+static void post_batch(struct scoreboard_fetch* fetch, gboolean last) {
+    struct row_batch* batch = fetch->batch;
+    if (!batch) {
+        if (!last) return;
+        batch = new_batch(fetch);
+    }
+    batch->last = last;
+    batch->failed = last && fetch->parse_failed;
+    batch->cached = fetch->cached;
+    batch->total = fetch->total;
+    fetch->batch = NULL;
+    g_idle_add(append_rows, batch);
+}
+
+static signed char row_parsed(struct lejp_ctx* ctx, char reason) {
+    struct scoreboard_fetch* fetch = (struct scoreboard_fetch*)ctx->user;
+
+    if (reason == LEJPCB_OBJECT_START) {
+        memset(&fetch->row, 0, sizeof(fetch->row));
+        fetch->row_has_data = FALSE;
+        return 0;
+    }
+
+    if (reason == LEJPCB_OBJECT_END) {
+        if (!fetch->row_has_data || fetch->rows_parsed == PAGE_ROWS) return 0;
+        if (!fetch->batch) fetch->batch = new_batch(fetch);
+        fetch->batch->rows[fetch->batch->count++] = fetch->row;
+        fetch->rows_parsed++;
+        fetch->row_has_data = FALSE;
+        return 0;
+    }
+
+    if (!(reason & LEJP_FLAG_CB_IS_VALUE) || !ctx->path_match) return 0;
+
+    switch (ctx->path_match) {
+    case PATH_TOTAL:
+        fetch->total = atol(ctx->buf);
+        return 0;
+    case PATH_RANK:
+        fetch->row.rank = atoi(ctx->buf);
+        break;
+    case PATH_USERNAME:
+        // Names longer than one lejp chunk arrive in pieces
+        strncat(fetch->row.username, ctx->buf,
+            sizeof(fetch->row.username) - strlen(fetch->row.username) - 1);
+        break;
+    case PATH_SCORE:
+        fetch->row.score = atoi(ctx->buf);
+        break;
+    }
+    fetch->row_has_data = TRUE;
+    return 0;
+}
+
+// curl write callback: parse the chunk in place and publish what it completed
+static size_t scoreboard_write(void* data, size_t size, size_t nmemb, void* userp) {
+    struct scoreboard_fetch* fetch = (struct scoreboard_fetch*)userp;
+    size_t realsize = size * nmemb;
+
+    long status = 0;
+    curl_easy_getinfo(fetch->easy, CURLINFO_RESPONSE_CODE, &status);
+    if (status != 200) return realsize;
+
+    g_string_append_len(fetch->body, (const char*)data, (gssize)realsize);
+    if (!fetch->parse_failed) {
+        int n = lejp_parse(&fetch->ctx, (const unsigned char*)data, (int)realsize);
+        if (n < 0 && n != LEJP_CONTINUE) {
+            fprintf(stderr, "Scoreboard parse error: %s\n", lejp_error_to_string(n));
+            fetch->parse_failed = TRUE;
+        }
+    }
+    post_batch(fetch, FALSE);
+    return realsize;
+}
+
+static size_t scoreboard_header(char* data, size_t size, size_t nitems, void* userp) {
+    struct scoreboard_fetch* fetch = (struct scoreboard_fetch*)userp;
+    size_t realsize = size * nitems;
+
+    if (realsize > 5 && g_ascii_strncasecmp(data, "ETag:", 5) == 0) {
+        char* value = g_strndup(data + 5, realsize - 5);
+        g_strlcpy(fetch->etag, g_strstrip(value), sizeof(fetch->etag));
+        g_free(value);
+    }
+    return realsize;
+}
+
+static struct scoreboard_fetch* new_fetch(long page, const char* key) {
+    struct scoreboard_fetch* fetch = g_new0(struct scoreboard_fetch, 1);
+    fetch->generation = view.generation;
+    fetch->page = page;
+    fetch->total = -1;
+    fetch->body = g_string_new(NULL);
+    g_strlcpy(fetch->key, key, sizeof(fetch->key));
+    lejp_construct(&fetch->ctx, row_parsed, fetch, row_paths, LWS_ARRAY_SIZE(row_paths));
+    return fetch;
+}
+
+static void free_fetch(struct scoreboard_fetch* fetch) {
+    lejp_destruct(&fetch->ctx);
+    g_string_free(fetch->body, TRUE);
+    curl_slist_free_all(fetch->headers);
+    g_free(fetch);
+}
+
+// Runs on the HTTP client thread
+static void fetch_done(CURL* easy, CURLcode result, long http_status, void* user_data) {
+    struct scoreboard_fetch* fetch = (struct scoreboard_fetch*)user_data;
+    (void)easy;
+
+    if (result == CURLE_OK && http_status == 304) {
+        // Cached rows are still current
+        lbcache_touch(fetch->key);
+        fetch->clear_pending = FALSE;
+        fetch->cached = TRUE;
+    }
+    else if (result != CURLE_OK || http_status != 200) {
+        fprintf(stderr, "Scoreboard fetch failed: %s (HTTP %ld)\n", curl_easy_strerror(result), http_status);
+        if (fetch->clear_pending) {
+            // Keep showing the cached copy rather than an empty page
+            fetch->clear_pending = FALSE;
+            fetch->cached = TRUE;
+        }
+        else fetch->parse_failed = TRUE;
+    }
+    else if (!fetch->parse_failed) {
+        lbcache_put(fetch->key, fetch->body->str, fetch->body->len, fetch->etag);
+    }
+    post_batch(fetch, TRUE);
+    free_fetch(fetch);
+}
+
+// Cached copy first, then the network when the copy is missing or stale
+static void load_page(long page) {
+    char key[96];
+    snprintf(key, sizeof(key), "scores?game=%s&window=%s&offset=%ld&limit=%d",
+        game_names[view.game], window_names[view.window], page * PAGE_ROWS, PAGE_ROWS);
+
+    struct lbcache_item cached;
+    enum lbcache_level level = lbcache_get(key, &cached);
+    if (level != LBCACHE_MISS) {
+        struct scoreboard_fetch* local = new_fetch(page, key);
+        local->cached = TRUE;
+        lejp_parse(&local->ctx, (const unsigned char*)cached.body, (int)cached.size);
+        post_batch(local, TRUE);
+        free_fetch(local);
+
+        if (lbcache_is_fresh(&cached)) {
+            g_free(cached.body);
+            return;
+        }
+    }
+
+    char url[256];
+    snprintf(url, sizeof(url), "%s?game=%s&window=%s&offset=%ld&limit=%d",
+        SCOREBOARD_URL, game_names[view.game], window_names[view.window], page * PAGE_ROWS, PAGE_ROWS);
+    CURL* easy = http_client_easy_new(url);
+    if (!easy) {
+        g_free(cached.body);
+        return;
+    }
+
+    struct scoreboard_fetch* fetch = new_fetch(page, key);
+    fetch->easy = easy;
+    fetch->clear_pending = level != LBCACHE_MISS;
+    if (level != LBCACHE_MISS && cached.etag[0]) {
+        char header[160];
+        snprintf(header, sizeof(header), "If-None-Match: %s", cached.etag);
+        fetch->headers = curl_slist_append(NULL, header);
+    }
+    g_free(cached.body);
+
+    curl_easy_setopt(easy, CURLOPT_HTTPHEADER, fetch->headers);
+    curl_easy_setopt(easy, CURLOPT_HEADERFUNCTION, scoreboard_header);
+    curl_easy_setopt(easy, CURLOPT_HEADERDATA, (void*)fetch);
+    curl_easy_setopt(easy, CURLOPT_WRITEFUNCTION, scoreboard_write);
+    curl_easy_setopt(easy, CURLOPT_WRITEDATA, (void*)fetch);
+    curl_easy_setopt(easy, CURLOPT_TIMEOUT, SCOREBOARD_TIMEOUT_SECONDS);
+    if (http_client_submit(easy, fetch_done, fetch) != 0) {
+        curl_easy_cleanup(easy);
+        free_fetch(fetch);
+        if (level == LBCACHE_MISS) {
+            struct page_slot* slot = find_page(page);
+            if (slot) page_failed(slot);
+            gtk_label_set_text(GTK_LABEL(view.status_label), "Failed to load scores");
+        }
+    }
+}
+
+// Ask the server to stream the rows in the viewport, if they changed
+static void live_subscribe(void) {
+    if (!view.live_send || !view.area) return;
+
+    long first = (long)(gtk_adjustment_get_value(view.adjustment) / ROW_HEIGHT) + 1;
+    int count = (int)(gtk_adjustment_get_page_size(view.adjustment) / ROW_HEIGHT) + 1;
+    if (count > LIVE_MAX_ROWS) count = LIVE_MAX_ROWS;
+    if (view.live_generation == view.generation && view.live_first == first && view.live_count == count) return;
+
+    char message[96];
+    snprintf(message, sizeof(message), "SUBSCRIBE %s %s %ld %d", game_names[view.game], window_names[view.window], first, count);
+    if (view.live_send(message) < 0) return;
+    view.live_generation = view.generation;
+    view.live_first = first;
+    view.live_count = count;
+}
+
+void scoreboard_set_live_sender(scoreboard_send_fn send) {
+    view.live_send = send;
+    view.live_count = 0;
+    live_subscribe();
+}
+
+// RANKS push from the server, on the GTK thread
+void scoreboard_live_update(const char* json) {
+    if (!view.area) return;
+    json_object* update = json_tokener_parse(json);
+    if (!update) return;
+
+    json_object* field;
+    const char* game = json_object_object_get_ex(update, "game", &field) ? json_object_get_string(field) : "";
+    const char* window = json_object_object_get_ex(update, "window", &field) ? json_object_get_string(field) : "";
+    if (strcmp(game, game_names[view.game]) != 0 || strcmp(window, window_names[view.window]) != 0) {
+        json_object_put(update);
+        return;
+    }
+
+    if (json_object_object_get_ex(update, "total", &field)) {
+        view.total = (long)json_object_get_int64(field);
+        for (int i = 0; i < RESIDENT_PAGES; i++) {
+            struct page_slot* slot = &view.pages[i];
+            long room = view.total - slot->page * PAGE_ROWS;
+            if (slot->page >= 0 && slot->count > room) slot->count = room < 0 ? 0 : (int)room;
+        }
+    }
+
+    json_object* rows;
+    if (json_object_object_get_ex(update, "rows", &rows)) {
+        size_t n = json_object_array_length(rows);
+        for (size_t i = 0; i < n; i++) {
+            json_object* row = json_object_array_get_idx(rows, i);
+            long rank = (long)json_object_get_int64(json_object_array_get_idx(row, 0));
+            const char* name = json_object_get_string(json_object_array_get_idx(row, 1));
+            if (rank < 1 || !name) continue;
+
+            // Rows that are not paged in are fetched when scrolled to
+            struct page_slot* slot = find_page((rank - 1) / PAGE_ROWS);
+            int index = (int)((rank - 1) % PAGE_ROWS);
+            if (!slot || index > slot->count) continue;
+
+            struct scoreboard_row* target = &slot->rows[index];
+            target->rank = (int)rank;
+            g_strlcpy(target->username, name, sizeof(target->username));
+            target->score = json_object_get_int(json_object_array_get_idx(row, 2));
+            if (index == slot->count) slot->count++;
+        }
+    }
+    json_object_put(update);
+
+    char text[64];
+    snprintf(text, sizeof(text), "%ld players", row_count());
+    gtk_label_set_text(GTK_LABEL(view.status_label), text);
+    update_adjustment();
+    gtk_widget_queue_draw(view.area);
+}
+
+// Make sure the pages under the viewport, plus the next one, are resident
+static void request_visible_pages(void) {
+    live_subscribe();
+
+    double top = gtk_adjustment_get_value(view.adjustment);
+    double height = gtk_adjustment_get_page_size(view.adjustment);
+    long first = (long)(top / ROW_HEIGHT) / PAGE_ROWS;
+    long last = (long)((top + height) / ROW_HEIGHT) / PAGE_ROWS + 1;
+
+    long rows = row_count();
+    long last_page = rows > 0 ? (rows - 1) / PAGE_ROWS : 0;
+    if (last > last_page) last = last_page;
+
+    for (long page = first; page <= last; page++) {
+        struct page_slot* slot = find_page(page);
+        if (slot) {
+            slot->last_used = ++view.use_clock;
+            // Failed pages stay resident so a dead server is not polled on every redraw
+            if (!slot->failed || g_get_monotonic_time() < slot->retry_at) continue;
+            slot->failed = FALSE;
+            slot->loading = TRUE;
+        }
+        else {
+            claim_page(page);
+        }
+        load_page(page);
+    }
+}
+
+static gboolean on_list_draw(GtkWidget* widget, cairo_t* cr, gpointer data) {
+    (void)data;
+    int width = gtk_widget_get_allocated_width(widget);
+    int height = gtk_widget_get_allocated_height(widget);
+    const double columns[] = { 12, 100, width - 120.0 };
+
+    cairo_set_source_rgb(cr, 1.0, 1.0, 1.0);
+    cairo_paint(cr);
+    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_NORMAL);
+    cairo_set_font_size(cr, 13);
+
+    double top = gtk_adjustment_get_value(view.adjustment);
+    long first = (long)(top / ROW_HEIGHT);
+    long rows = row_count();
+
+    for (long row = first; row < rows; row++) {
+        double y = HEADER_HEIGHT + row * ROW_HEIGHT - top;
+        if (y > height) break;
+
+        if (row % 2) {
+            cairo_set_source_rgb(cr, 0.95, 0.95, 0.95);
+            cairo_rectangle(cr, 0, y, width, ROW_HEIGHT);
+            cairo_fill(cr);
+        }
+
+        struct page_slot* slot = find_page(row / PAGE_ROWS);
+        int index = (int)(row % PAGE_ROWS);
+        cairo_set_source_rgb(cr, 0.0, 0.0, 0.0);
+        if (!slot || index >= slot->count) {
+            // Not paged in yet
+            cairo_set_source_rgb(cr, 0.6, 0.6, 0.6);
+            cairo_move_to(cr, columns[0], y + ROW_HEIGHT - 7);
+            cairo_show_text(cr, "...");
+            continue;
+        }
+
+        char text[32];
+        snprintf(text, sizeof(text), "%d", slot->rows[index].rank);
+        cairo_move_to(cr, columns[0], y + ROW_HEIGHT - 7);
+        cairo_show_text(cr, text);
+        cairo_move_to(cr, columns[1], y + ROW_HEIGHT - 7);
+        cairo_show_text(cr, slot->rows[index].username);
+        snprintf(text, sizeof(text), "%d", slot->rows[index].score);
+        cairo_move_to(cr, columns[2], y + ROW_HEIGHT - 7);
+        cairo_show_text(cr, text);
+    }
+
+    // Column titles stay put over the scrolled rows
+    const char* titles[] = { "Rank", "Player", "Score" };
+    cairo_set_source_rgb(cr, 0.85, 0.85, 0.85);
+    cairo_rectangle(cr, 0, 0, width, HEADER_HEIGHT);
+    cairo_fill(cr);
+    cairo_set_source_rgb(cr, 0.0, 0.0, 0.0);
+    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
+    for (int i = 0; i < 3; i++) {
+        cairo_move_to(cr, columns[i], HEADER_HEIGHT - 9);
+        cairo_show_text(cr, titles[i]);
+    }
+    return FALSE;
+}
+
+static gboolean on_list_scroll(GtkWidget* widget, GdkEventScroll* event, gpointer data) {
+    (void)widget;
+    (void)data;
+    double delta = 0;
+    if (event->direction == GDK_SCROLL_UP) delta = -3 * ROW_HEIGHT;
+    else if (event->direction == GDK_SCROLL_DOWN) delta = 3 * ROW_HEIGHT;
+    else if (event->direction == GDK_SCROLL_SMOOTH) delta = event->delta_y * 3 * ROW_HEIGHT;
+
+    double upper = gtk_adjustment_get_upper(view.adjustment) - gtk_adjustment_get_page_size(view.adjustment);
+    double value = gtk_adjustment_get_value(view.adjustment) + delta;
+    if (value > upper) value = upper;
+    if (value < 0) value = 0;
+    gtk_adjustment_set_value(view.adjustment, value);
+    return TRUE;
+}
+
+static void on_list_scrolled(GtkAdjustment* adjustment, gpointer data) {
+    (void)adjustment;
+    (void)data;
+    request_visible_pages();
+    gtk_widget_queue_draw(view.area);
+}
+
+static void on_list_resized(GtkWidget* widget, GtkAllocation* allocation, gpointer data) {
+    (void)widget;
+    (void)allocation;
+    (void)data;
+    update_adjustment();
+    request_visible_pages();
+}
+
+static void refresh_scoreboard(GtkWidget* widget, gpointer data) {
+    (void)widget;
+    (void)data;
+
+    view.game = gtk_combo_box_get_active(GTK_COMBO_BOX(view.game_combo));
+    if (view.game < 0) view.game = 0;
+    view.window = gtk_combo_box_get_active(GTK_COMBO_BOX(view.window_combo));
+    if (view.window < 0) view.window = 0;
+
+    view.generation++;
+    view.total = -1;
+    view.known_rows = 0;
+    for (int i = 0; i < RESIDENT_PAGES; i++) view.pages[i].page = -1;
+    gtk_label_set_text(GTK_LABEL(view.status_label), "Loading...");
+
+    update_adjustment();
+    gtk_adjustment_set_value(view.adjustment, 0);
+    request_visible_pages();
+    gtk_widget_queue_draw(view.area);
+}
+
+GtkWidget* create_scoreboard_screen(GtkStack* stack) {
+    GtkWidget* box = gtk_box_new(GTK_ORIENTATION_VERTICAL, 6);
+    gtk_container_set_border_width(GTK_CONTAINER(box), 10);
+
+    GtkWidget* toolbar = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 6);
+    view.game_combo = gtk_combo_box_text_new();
+    for (size_t i = 0; i < G_N_ELEMENTS(game_names); i++) {
+        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(view.game_combo), game_names[i]);
+    }
+    gtk_combo_box_set_active(GTK_COMBO_BOX(view.game_combo), 0);
+    g_signal_connect(view.game_combo, "changed", G_CALLBACK(refresh_scoreboard), NULL);
+    gtk_box_pack_start(GTK_BOX(toolbar), view.game_combo, FALSE, FALSE, 0);
+
+    view.window_combo = gtk_combo_box_text_new();
+    for (size_t i = 0; i < G_N_ELEMENTS(window_titles); i++) {
+        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(view.window_combo), window_titles[i]);
+    }
+    gtk_combo_box_set_active(GTK_COMBO_BOX(view.window_combo), 0);
+    g_signal_connect(view.window_combo, "changed", G_CALLBACK(refresh_scoreboard), NULL);
+    gtk_box_pack_start(GTK_BOX(toolbar), view.window_combo, FALSE, FALSE, 0);
+
+    GtkWidget* refresh = gtk_button_new_with_label("Refresh");
+    g_signal_connect(refresh, "clicked", G_CALLBACK(refresh_scoreboard), NULL);
+    gtk_box_pack_start(GTK_BOX(toolbar), refresh, FALSE, FALSE, 0);
+
+    view.status_label = gtk_label_new("");
+    gtk_box_pack_end(GTK_BOX(toolbar), view.status_label, FALSE, FALSE, 0);
+    gtk_box_pack_start(GTK_BOX(box), toolbar, FALSE, FALSE, 0);
+
+    GtkWidget* list = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 0);
+    view.area = gtk_drawing_area_new();
+    gtk_widget_set_hexpand(view.area, TRUE);
+    gtk_widget_set_vexpand(view.area, TRUE);
+    gtk_widget_add_events(view.area, GDK_SCROLL_MASK | GDK_SMOOTH_SCROLL_MASK);
+    g_signal_connect(view.area, "draw", G_CALLBACK(on_list_draw), NULL);
+    g_signal_connect(view.area, "scroll-event", G_CALLBACK(on_list_scroll), NULL);
+    g_signal_connect(view.area, "size-allocate", G_CALLBACK(on_list_resized), NULL);
+    gtk_box_pack_start(GTK_BOX(list), view.area, TRUE, TRUE, 0);
+
+    view.adjustment = gtk_adjustment_new(0, 0, 0, ROW_HEIGHT, ROW_HEIGHT, ROW_HEIGHT);
+    g_signal_connect(view.adjustment, "value-changed", G_CALLBACK(on_list_scrolled), NULL);
+    GtkWidget* scrollbar = gtk_scrollbar_new(GTK_ORIENTATION_VERTICAL, view.adjustment);
+    gtk_box_pack_start(GTK_BOX(list), scrollbar, FALSE, FALSE, 0);
+    gtk_box_pack_start(GTK_BOX(box), list, TRUE, TRUE, 0);
+
+    for (int i = 0; i < RESIDENT_PAGES; i++) view.pages[i].page = -1;
+    gtk_stack_add_named(stack, box, "scoreboard");
+    refresh_scoreboard(NULL, NULL);
+    return box;
+}
@@ -0,0 +1,284 @@
+#define _CRT_SECURE_NO_WARNINGS
+// Local JWT verification (see jwt.h).
+//
+// The JWK set is parsed with json-c and each RSA key is turned into an
+// EVP_PKEY once, so a verification is one RSA public-key operation. The lws
+// build carries no JOSE support (no LWS_WITH_JOSE / LWS_WITH_GENCRYPTO in
+// lws_config.h), so the signature check goes to OpenSSL's EVP API directly.
+#include <glib.h>
+#include <glib/gstdio.h>
+#include <json-c/json.h>
+#include <openssl/core_names.h>
+#include <openssl/evp.h>
+#include <openssl/param_build.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "jwt.h"
+
+static GHashTable* keys = NULL;          // kid -> EVP_PKEY*
+static GHashTable* verified = NULL;      // token -> struct jwt_claims*
+static char* keys_path = NULL;
+static gint64 keys_mtime = 0;
+static gint64 keys_checked_at = 0;
+
+// base64url without padding, as JWS uses it; NULL on bad input
+static guchar* base64url_decode(const char* text, size_t length, gsize* out_length) {
+    if (length % 4 == 1) return NULL;
+
+    char* padded = g_malloc(length + 3);
+    for (size_t i = 0; i < length; i++) {
+        char c = text[i];
+        if (c == '-') c = '+';
+        else if (c == '_') c = '/';
+        else if (!g_ascii_isalnum(c)) {
+            g_free(padded);
+            return NULL;
+        }
+        padded[i] = c;
+    }
+    size_t n = length;
+    while (n % 4) padded[n++] = '=';
+    padded[n] = '\0';
+
+    guchar* data = g_base64_decode(padded, out_length);
+    g_free(padded);
+    return data;
+}
+
+static json_object* decode_json_part(const char* text, size_t length) {
+    gsize json_length;
+    guchar* json = base64url_decode(text, length, &json_length);
+    if (!json) return NULL;
+    char* string = g_strndup((const char*)json, json_length);
+    json_object* obj = json_tokener_parse(string);
+    g_free(string);
+    g_free(json);
+    if (obj && !json_object_is_type(obj, json_type_object)) {
+        json_object_put(obj);
+        return NULL;
+    }
+    return obj;
+}
+
+static BIGNUM* jwk_number(json_object* jwk, const char* field) {
+    json_object* value;
+    if (!json_object_object_get_ex(jwk, field, &value) || !json_object_is_type(value, json_type_string)) return NULL;
+    const char* text = json_object_get_string(value);
+    gsize length;
+    guchar* bytes = base64url_decode(text, strlen(text), &length);
+    if (!bytes) return NULL;
+    BIGNUM* number = BN_bin2bn(bytes, (int)length, NULL);
+    g_free(bytes);
+    return number;
+}
+
+static EVP_PKEY* jwk_to_rsa_key(json_object* jwk) {
+    BIGNUM* n = jwk_number(jwk, "n");
+    BIGNUM* e = jwk_number(jwk, "e");
+    EVP_PKEY* pkey = NULL;
+    OSSL_PARAM_BLD* builder = OSSL_PARAM_BLD_new();
+    OSSL_PARAM* params = NULL;
+    EVP_PKEY_CTX* ctx = NULL;
+
+    if (!n || !e || !builder) goto done;
+    if (!OSSL_PARAM_BLD_push_BN(builder, OSSL_PKEY_PARAM_RSA_N, n) ||
+        !OSSL_PARAM_BLD_push_BN(builder, OSSL_PKEY_PARAM_RSA_E, e)) goto done;
+    params = OSSL_PARAM_BLD_to_param(builder);
+    ctx = EVP_PKEY_CTX_new_from_name(NULL, "RSA", NULL);
+    if (!params || !ctx || EVP_PKEY_fromdata_init(ctx) <= 0) goto done;
+    if (EVP_PKEY_fromdata(ctx, &pkey, EVP_PKEY_PUBLIC_KEY, params) <= 0) pkey = NULL;
+
+done:
+    EVP_PKEY_CTX_free(ctx);
+    OSSL_PARAM_free(params);
+    OSSL_PARAM_BLD_free(builder);
+    BN_free(n);
+    BN_free(e);
+    return pkey;
+}
+
+static void free_key(gpointer key) {
+    EVP_PKEY_free((EVP_PKEY*)key);
+}
+
+static gint64 file_mtime(const char* path) {
+    GStatBuf st;
+    if (g_stat(path, &st) != 0) return -1;
+    return (gint64)st.st_mtime;
+}
+
+int jwt_keys_load(const char* path) {
+    char* text = NULL;
+    if (!g_file_get_contents(path, &text, NULL, NULL)) {
+        fprintf(stderr, "JWT: cannot read key set %s\n", path);
+        return -1;
+    }
+    json_object* set = json_tokener_parse(text);
+    g_free(text);
+
+    json_object* list;
+    if (!set || !json_object_object_get_ex(set, "keys", &list) || !json_object_is_type(list, json_type_array)) {
+        fprintf(stderr, "JWT: %s is not a JWK set\n", path);
+        json_object_put(set);
+        return -1;
+    }
+
+    GHashTable* loaded = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, free_key);
+    for (size_t i = 0; i < json_object_array_length(list); i++) {
+        json_object* jwk = json_object_array_get_idx(list, i);
+        json_object* kty;
+        json_object* kid;
+        if (!json_object_object_get_ex(jwk, "kty", &kty) || strcmp(json_object_get_string(kty), "RSA") != 0) continue;
+        if (!json_object_object_get_ex(jwk, "kid", &kid)) continue;
+
+        EVP_PKEY* pkey = jwk_to_rsa_key(jwk);
+        if (!pkey) {
+            fprintf(stderr, "JWT: skipping unusable key %s\n", json_object_get_string(kid));
+            continue;
+        }
+        g_hash_table_replace(loaded, g_strdup(json_object_get_string(kid)), pkey);
+    }
+    json_object_put(set);
+
+    // Tokens verified with a key that is gone must be checked again
+    if (keys) g_hash_table_destroy(keys);
+    keys = loaded;
+    if (verified) g_hash_table_remove_all(verified);
+
+    if (path != keys_path) {
+        g_free(keys_path);
+        keys_path = g_strdup(path);
+    }
+    keys_mtime = file_mtime(path);
+    keys_checked_at = g_get_monotonic_time();
+    return (int)g_hash_table_size(keys);
+}
+
+int jwt_keys_loaded(void) {
+    return keys && g_hash_table_size(keys) > 0;
+}
+
+// Rotated keys appear in the file under a new kid
+static void maybe_reload_keys(void) {
+    gint64 now = g_get_monotonic_time();
+    if (!keys_path || now - keys_checked_at < (gint64)JWT_RELOAD_SECONDS * G_USEC_PER_SEC) return;
+    keys_checked_at = now;
+    if (file_mtime(keys_path) != keys_mtime) jwt_keys_load(keys_path);
+}
+
+static int verify_signature(EVP_PKEY* pkey, const char* data, size_t data_length, const guchar* signature, gsize signature_length) {
+    EVP_MD_CTX* md = EVP_MD_CTX_new();
+    if (!md) return 0;
+    int ok = EVP_DigestVerifyInit(md, NULL, EVP_sha256(), NULL, pkey) == 1 &&
+        EVP_DigestVerify(md, signature, signature_length, (const unsigned char*)data, data_length) == 1;
+    EVP_MD_CTX_free(md);
+    return ok;
+}
+
+static long long claim_time(json_object* payload, const char* name) {
+    json_object* value;
+    if (!json_object_object_get_ex(payload, name, &value)) return 0;
+    return (long long)json_object_get_int64(value);
+}
+
+static enum jwt_status check_times(const struct jwt_claims* claims, long long not_before) {
+    long long now = (long long)(g_get_real_time() / G_USEC_PER_SEC);
+    if (now > claims->expires_at + JWT_LEEWAY_SECONDS) return JWT_EXPIRED;
+    if (not_before && now + JWT_LEEWAY_SECONDS < not_before) return JWT_NOT_YET_VALID;
+    return JWT_OK;
+}
+
+enum jwt_status jwt_verify(const char* token, struct jwt_claims* claims) {
+    if (!verified) verified = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+
+    struct jwt_claims* cached = (struct jwt_claims*)g_hash_table_lookup(verified, token);
+    if (cached) {
+        enum jwt_status status = check_times(cached, 0);
+        if (status == JWT_OK) *claims = *cached;
+        else g_hash_table_remove(verified, token);
+        return status;
+    }
+
+    // header.payload.signature
+    const char* dot1 = strchr(token, '.');
+    const char* dot2 = dot1 ? strchr(dot1 + 1, '.') : NULL;
+    if (!dot2 || strchr(dot2 + 1, '.')) return JWT_MALFORMED;
+
+    json_object* header = decode_json_part(token, (size_t)(dot1 - token));
+    if (!header) return JWT_MALFORMED;
+    json_object* alg;
+    json_object* kid;
+    enum jwt_status status = JWT_OK;
+    if (!json_object_object_get_ex(header, "alg", &alg) || strcmp(json_object_get_string(alg), "RS256") != 0) {
+        status = JWT_UNSUPPORTED_ALG;
+    }
+    else if (!json_object_object_get_ex(header, "kid", &kid)) {
+        status = JWT_UNKNOWN_KEY;
+    }
+
+    EVP_PKEY* pkey = NULL;
+    if (status == JWT_OK) {
+        const char* key_id = json_object_get_string(kid);
+        pkey = keys ? (EVP_PKEY*)g_hash_table_lookup(keys, key_id) : NULL;
+        if (!pkey) {
+            maybe_reload_keys();
+            pkey = keys ? (EVP_PKEY*)g_hash_table_lookup(keys, key_id) : NULL;
+        }
+        if (!pkey) status = JWT_UNKNOWN_KEY;
+    }
+    json_object_put(header);
+    if (status != JWT_OK) return status;
+
+    gsize signature_length;
+    guchar* signature = base64url_decode(dot2 + 1, strlen(dot2 + 1), &signature_length);
+    if (!signature) return JWT_MALFORMED;
+    int good = verify_signature(pkey, token, (size_t)(dot2 - token), signature, signature_length);
+    g_free(signature);
+    if (!good) return JWT_BAD_SIGNATURE;
+
+    json_object* payload = decode_json_part(dot1 + 1, (size_t)(dot2 - dot1 - 1));
+    if (!payload) return JWT_MALFORMED;
+    json_object* sub;
+    struct jwt_claims result;
+    memset(&result, 0, sizeof(result));
+    if (json_object_object_get_ex(payload, "sub", &sub)) {
+        g_strlcpy(result.subject, json_object_get_string(sub), sizeof(result.subject));
+    }
+    result.issued_at = claim_time(payload, "iat");
+    result.expires_at = claim_time(payload, "exp");
+    long long not_before = claim_time(payload, "nbf");
+    json_object_put(payload);
+
+    if (!result.subject[0] || !result.expires_at) return JWT_MALFORMED;
+    status = check_times(&result, not_before);
+    if (status != JWT_OK) return status;
+
+    // Expired entries are dropped on lookup; a full cache simply starts over
+    if (g_hash_table_size(verified) >= JWT_CACHE_MAX) g_hash_table_remove_all(verified);
+    g_hash_table_insert(verified, g_strdup(token), g_memdup2(&result, sizeof(result)));
+    *claims = result;
+    return JWT_OK;
+}
+
+const char* jwt_status_string(enum jwt_status status) {
+    switch (status) {
+    case JWT_OK: return "ok";
+    case JWT_MALFORMED: return "malformed token";
+    case JWT_UNSUPPORTED_ALG: return "unsupported algorithm";
+    case JWT_UNKNOWN_KEY: return "unknown signing key";
+    case JWT_BAD_SIGNATURE: return "bad signature";
+    case JWT_EXPIRED: return "token expired";
+    case JWT_NOT_YET_VALID: return "token not yet valid";
+    }
+    return "unknown error";
+}
+
+void jwt_shutdown(void) {
+    if (keys) g_hash_table_destroy(keys);
+    if (verified) g_hash_table_destroy(verified);
+    keys = NULL;
+    verified = NULL;
+    g_free(keys_path);
+    keys_path = NULL;
+}
@@ -0,0 +1,69 @@
+// Standalone host for the ranking service, for running it without the game
+// server. The game server embeds it by adding rank_service_protocol to its
+// protocol list and rank_service_mount to its vhost, and by passing its
+// WebSocket messages through the rank_service_live_* hooks. The Tetris
+// versus referee (versus_service.h) is embedded the same way; it is linked
+// here only because it lives in server/.
+//
+// Score submissions are checked against the auth service's JWK set when one
+// is given; without it the server accepts unauthenticated batches.
+//
+//     gcc -O2 -Iinclude -o rank_server server/*.c wsz.c tetris.c tetris_sim.c tetris_versus.c replay.c g2048_play.c g2048.c g2048_big.c history.c $(pkg-config --cflags --libs libwebsockets glib-2.0 json-c zlib libcrypto)
+//     ./rank_server [port] [jwks.json]
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "jwt.h"
+#include "rank_service.h"
+
+static volatile int interrupted = 0;
+
+static void on_signal(int sig) {
+    (void)sig;
+    interrupted = 1;
+}
+
+int main(int argc, char* argv[]) {
+    struct lws_protocols protocols[] = {
+        rank_service_protocol,
+        rank_live_protocol,
+        { NULL, NULL, 0, 0 }
+    };
+
+    struct lws_context_creation_info context_info = { 0 };
+    context_info.port = argc > 1 ? atoi(argv[1]) : 8080;
+    context_info.protocols = protocols;
+    context_info.mounts = &rank_service_mount;
+    context_info.options |= LWS_SERVER_OPTION_DISABLE_IPV6;
+    context_info.max_http_header_data = 4096; // room for a bearer token
+
+    if (argc > 2) {
+        int count = jwt_keys_load(argv[2]);
+        if (count <= 0) {
+            fprintf(stderr, "No usable keys in %s\n", argv[2]);
+            return 1;
+        }
+        printf("Verifying login tokens with %d keys from %s\n", count, argv[2]);
+    }
+    else {
+        printf("No JWK set given, score batches are not authenticated\n");
+    }
+
+    struct lws_context* context = lws_create_context(&context_info);
+    if (!context) {
+        fprintf(stderr, "Failed to create server context\n");
+        return 1;
+    }
+
+    signal(SIGINT, on_signal);
+    printf("Ranking service listening on port %d\n", context_info.port);
+    while (!interrupted) {
+        if (lws_service(context, 0) < 0) break;
+    }
+
+    lws_context_destroy(context);
+    rank_service_shutdown();
+    jwt_shutdown();
+    return 0;
+}
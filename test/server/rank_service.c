@@ -0,0 +1,749 @@
+#define _CRT_SECURE_NO_WARNINGS
+// Leaderboard ranking service (see rank_service.h).
+//
+// Everything runs on the lws service thread, so the boards need no locking.
+// A player has one entry per game, their best score: a better score removes
+// the old entry and inserts the new one, anything else is ignored.
+//
+// Daily and weekly boards come from the game's rank_windows; scores are
+// filed under the hour of their "time", the moment the game ended on the
+// client, or the current hour if that is in the future. Those boards would
+// count a resent score again, so every score carries a client id and the
+// service remembers the ids it has queued for SEEN_ID_TTL_US (longer than
+// the week window), up to SEEN_IDS_MAX of them; a score with a known id is
+// dropped. That makes outbox retries harmless.
+//
+// Live subscribers remember the rows they were last sent. A change to their
+// game only asks lws for a writable callback, so a burst of scores costs one
+// diff and one message per subscriber, not one per score.
+//
+// Score batches carry the player's login token. It is checked locally
+// against the cached JWK set (jwt.h), and a batch only counts the scores of
+// the player it names.
+//
+// Each score also carries the replay of its game. Scores go to the
+// verification pool (replay_verify.h) as they are parsed and are filed when
+// their check comes back: the pool wakes the service loop with
+// lws_cancel_service, and LWS_CALLBACK_EVENT_WAIT_CANCELLED collects the
+// finished checks on this thread. The batch is answered before that; a
+// batch that finds the pool's queue full is answered 503, and the client's
+// outbox sends it again later; the scores that were queued are dropped from
+// the resend by their id.
+#include <glib.h>
+#include <json-c/json.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rank_service.h"
+#include "rank_tree.h"
+#include "rank_window.h"
+#include "replay_verify.h"
+#include "wsz.h"
+#include "jwt.h"
+
+#define MAX_PAGE_ROWS 500
+#define WRITE_CHUNK 4096
+#define LIVE_MAX_ROWS 100
+#define LIVE_MESSAGE_SIZE 512
+#define REPLAY_BASE64_MAX ((REPLAY_MAX_BYTES + 2) / 3 * 4)
+#define SEEN_IDS_MAX 500000
+#define SEEN_ID_TTL_US ((gint64)8 * 24 * 3600 * G_USEC_PER_SEC)
+
+struct game_board {
+    struct rank_tree tree;
+    GHashTable* players;         // username -> player id + 1
+    GPtrArray* names;            // player id -> username
+    GArray* handles;             // player id -> tree handle
+    struct rank_windows windows;
+    guint64 version;             // bumped on every change, used as the ETag
+};
+
+// Per-connection state
+struct rank_session {
+    char* body;
+    size_t length;
+    size_t sent;
+
+    // POST /scores/batch
+    struct lejp_ctx ctx;
+    gboolean parsing;
+    char id[64];
+    char username[50];
+    char game[32];
+    int score;
+    gint64 time;                 // seconds since the epoch, 0 when not sent
+    GString* replay;             // base64, arrives in chunks
+    int fields;                  // bit per batch_paths entry seen
+    int queued;
+    gboolean busy;               // the verification queue was full
+    char subject[50];            // token owner, empty while tokens are not checked
+};
+
+static const char* const batch_paths[] = {
+    "[].username",
+    "[].game",
+    "[].score",
+    "[].replay",
+    "[].id",
+    "[].time",
+};
+
+enum { BATCH_USERNAME = 1, BATCH_GAME, BATCH_SCORE, BATCH_REPLAY, BATCH_ID, BATCH_TIME };
+#define BATCH_REQUIRED ((1 << BATCH_USERNAME) | (1 << BATCH_GAME) | (1 << BATCH_SCORE) | (1 << BATCH_ID))
+
+static const char* const window_names[RANK_WINDOW_COUNT] = { "all", "day", "week" };
+
+// One viewer of a rank range on a WebSocket
+struct live_subscription {
+    char game[32];
+    enum rank_window window;
+    uint32_t first_rank;
+    int count;
+    gboolean primed;             // sent holds what the client has
+    uint32_t sent_total;
+    int sent_count;
+    struct rank_entry sent[LIVE_MAX_ROWS];
+};
+
+// A score id that was queued, "username id"
+struct seen_id {
+    gint64 expires;              // real time
+    char key[];
+};
+
+static GHashTable* boards = NULL;
+static GHashTable* live_subscriptions = NULL;    // wsi -> live_subscription
+static GHashTable* seen_ids = NULL;              // key -> seen_id
+static GQueue seen_order = G_QUEUE_INIT;         // oldest first
+
+static void free_board(gpointer data) {
+    struct game_board* board = (struct game_board*)data;
+    rank_tree_free(&board->tree);
+    rank_windows_free(&board->windows);
+    g_hash_table_destroy(board->players);
+    g_ptr_array_free(board->names, TRUE);
+    g_array_free(board->handles, TRUE);
+    g_free(board);
+}
+
+static struct game_board* find_board(const char* game, gboolean create) {
+    if (!boards) boards = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, free_board);
+
+    struct game_board* board = (struct game_board*)g_hash_table_lookup(boards, game);
+    if (board || !create) return board;
+
+    board = g_new0(struct game_board, 1);
+    if (rank_tree_init(&board->tree, 1024) != 0) {
+        g_free(board);
+        return NULL;
+    }
+    board->players = g_hash_table_new(g_str_hash, g_str_equal);
+    board->names = g_ptr_array_new_with_free_func(g_free);
+    board->handles = g_array_new(FALSE, FALSE, sizeof(uint32_t));
+    rank_windows_init(&board->windows);
+    g_hash_table_insert(boards, g_strdup(game), board);
+    return board;
+}
+
+static void live_notify(const char* game) {
+    if (!live_subscriptions) return;
+
+    GHashTableIter iter;
+    gpointer key, value;
+    g_hash_table_iter_init(&iter, live_subscriptions);
+    while (g_hash_table_iter_next(&iter, &key, &value)) {
+        struct live_subscription* sub = (struct live_subscription*)value;
+        if (strcmp(sub->game, game) == 0) lws_callback_on_writable((struct lws*)key);
+    }
+}
+
+static gint64 current_hour(void) {
+    return g_get_real_time() / ((gint64)3600 * G_USEC_PER_SEC);
+}
+
+// Was the player's score id queued before? Ids are forgotten after
+// SEEN_ID_TTL_US, or sooner, oldest first, past SEEN_IDS_MAX of them.
+static gboolean seen_before(const char* username, const char* id) {
+    gint64 now = g_get_real_time();
+    while (!g_queue_is_empty(&seen_order)) {
+        struct seen_id* oldest = (struct seen_id*)g_queue_peek_head(&seen_order);
+        if (oldest->expires > now && g_hash_table_size(seen_ids) < SEEN_IDS_MAX) break;
+        g_queue_pop_head(&seen_order);
+        g_hash_table_remove(seen_ids, oldest->key);
+        g_free(oldest);
+    }
+    if (!seen_ids) return FALSE;
+
+    char* key = g_strdup_printf("%s %s", username, id);
+    gboolean seen = g_hash_table_contains(seen_ids, key);
+    g_free(key);
+    return seen;
+}
+
+static void remember_id(const char* username, const char* id) {
+    if (!seen_ids) seen_ids = g_hash_table_new(g_str_hash, g_str_equal);
+    char* key = g_strdup_printf("%s %s", username, id);
+    size_t size = strlen(key) + 1;
+    struct seen_id* seen = (struct seen_id*)g_malloc(sizeof(*seen) + size);
+    seen->expires = g_get_real_time() + SEEN_ID_TTL_US;
+    memcpy(seen->key, key, size);
+    g_free(key);
+    g_hash_table_insert(seen_ids, seen->key, seen);
+    g_queue_push_tail(&seen_order, seen);
+}
+
+// Returns TRUE when the score became the player's best on any board
+static gboolean submit_score(const char* game, const char* username, int score, gint64 played_at) {
+    if (!game[0] || !username[0]) return FALSE;
+    struct game_board* board = find_board(game, TRUE);
+    if (!board) return FALSE;
+
+    guint id = GPOINTER_TO_UINT(g_hash_table_lookup(board->players, username));
+    if (id == 0) {
+        char* name = g_strdup(username);
+        g_ptr_array_add(board->names, name);
+        id = board->names->len;
+        g_hash_table_insert(board->players, name, GUINT_TO_POINTER(id));
+        uint32_t none = RANK_NIL;
+        g_array_append_val(board->handles, none);
+    }
+
+    uint32_t player = id - 1;
+    gint64 hour = played_at > 0 ? MIN(played_at / 3600, current_hour()) : current_hour();
+    gboolean changed = rank_windows_submit(&board->windows, hour, player, score);
+    uint32_t* handle = &g_array_index(board->handles, uint32_t, player);
+    if (*handle == RANK_NIL || rank_tree_node(&board->tree, *handle)->score < score) {
+        if (*handle != RANK_NIL) rank_tree_remove(&board->tree, *handle);
+        *handle = rank_tree_insert(&board->tree, score, player);
+        changed = changed || *handle != RANK_NIL;
+    }
+    if (changed) {
+        board->version++;
+        live_notify(game);
+    }
+    return changed;
+}
+
+// A score is filed once its replay checks out
+static void file_checked_scores(void) {
+    struct replay_check* check = replay_verify_collect();
+    while (check) {
+        struct replay_check* next = check->next;
+        if (check->verdict == REPLAY_VERIFY_OK) {
+            submit_score(check->game, check->username, check->score, check->played_at);
+        }
+        else {
+            lwsl_notice("Rank service: rejected %s score %d of %s: %s\n", check->game, check->score, check->username,
+                replay_verdict_string(check->verdict));
+        }
+        replay_check_free(check);
+        check = next;
+    }
+}
+
+// Runs on a verification worker
+static void wake_service(void* context) {
+    lws_cancel_service((struct lws_context*)context);
+}
+
+static void queue_check(struct rank_session* session) {
+    struct replay_check* check = (struct replay_check*)calloc(1, sizeof(*check));
+    if (!check) return;
+    g_strlcpy(check->game, session->game, sizeof(check->game));
+    g_strlcpy(check->username, session->username, sizeof(check->username));
+    check->score = session->score;
+    check->played_at = session->time;
+    if (session->replay && session->replay->len) {
+        gsize size;
+        guchar* data = g_base64_decode(session->replay->str, &size);
+        check->replay = (uint8_t*)malloc(size ? size : 1);
+        if (check->replay) memcpy(check->replay, data, size);
+        check->size = check->replay ? size : 0;
+        g_free(data);
+    }
+    if (replay_verify_submit(check)) {
+        session->queued++;
+        remember_id(session->username, session->id);
+        return;
+    }
+    session->busy = TRUE;
+    replay_check_free(check);
+}
+
+static signed char batch_parsed(struct lejp_ctx* ctx, char reason) {
+    struct rank_session* session = (struct rank_session*)ctx->user;
+
+    if (reason == LEJPCB_OBJECT_START) {
+        session->id[0] = '\0';
+        session->username[0] = '\0';
+        session->game[0] = '\0';
+        session->time = 0;
+        if (session->replay) g_string_truncate(session->replay, 0);
+        session->fields = 0;
+        return 0;
+    }
+
+    if (reason == LEJPCB_OBJECT_END) {
+        gboolean owned = !session->subject[0] || strcmp(session->subject, session->username) == 0;
+        if ((session->fields & BATCH_REQUIRED) == BATCH_REQUIRED && owned && session->game[0] && !session->busy &&
+            !seen_before(session->username, session->id)) {
+            queue_check(session);
+        }
+        session->fields = 0;
+        return 0;
+    }
+
+    if (!(reason & LEJP_FLAG_CB_IS_VALUE) || !ctx->path_match) return 0;
+
+    // A replay is longer than the parser's buffer; a too long one is cut and fails its check
+    if (ctx->path_match == BATCH_REPLAY) {
+        if (!session->replay) session->replay = g_string_new(NULL);
+        if (session->replay->len + ctx->npos <= REPLAY_BASE64_MAX) g_string_append_len(session->replay, ctx->buf, ctx->npos);
+        session->fields |= 1 << BATCH_REPLAY;
+        return 0;
+    }
+
+    switch (ctx->path_match) {
+    case BATCH_USERNAME:
+        g_strlcpy(session->username, ctx->buf, sizeof(session->username));
+        break;
+    case BATCH_GAME:
+        g_strlcpy(session->game, ctx->buf, sizeof(session->game));
+        break;
+    case BATCH_SCORE:
+        session->score = atoi(ctx->buf);
+        break;
+    case BATCH_ID:
+        g_strlcpy(session->id, ctx->buf, sizeof(session->id));
+        break;
+    case BATCH_TIME:
+        session->time = g_ascii_strtoll(ctx->buf, NULL, 10);
+        break;
+    }
+    session->fields |= 1 << ctx->path_match;
+    return 0;
+}
+
+// Rows first_rank.. of a board; *total is the size of the board
+static int board_range(struct game_board* board, enum rank_window window, uint32_t first_rank, int limit, struct rank_entry* out, uint32_t* total) {
+    *total = 0;
+    if (!board || first_rank < 1) return 0;
+    if (window == RANK_WINDOW_ALL) {
+        *total = rank_tree_size(&board->tree);
+        return rank_tree_range(&board->tree, first_rank, limit, out);
+    }
+
+    int count = 0;
+    const struct rank_entry* entries = rank_windows_top(&board->windows, window, current_hour(), &count);
+    *total = (uint32_t)count;
+    if ((long)first_rank > count) return 0;
+    int n = (int)MIN((long)limit, (long)count - (first_rank - 1));
+    memcpy(out, entries + (first_rank - 1), sizeof(struct rank_entry) * n);
+    return n;
+}
+
+static json_object* leaderboard_page(struct game_board* board, enum rank_window window, long offset, int limit) {
+    json_object* result = json_object_new_object();
+    json_object* rows = json_object_new_array();
+    struct rank_entry* entries = g_new(struct rank_entry, limit);
+    uint32_t total;
+    int count = board_range(board, window, (uint32_t)offset + 1, limit, entries, &total);
+    json_object_object_add(result, "total", json_object_new_int64(total));
+
+    for (int i = 0; i < count; i++) {
+        json_object* row = json_object_new_object();
+        json_object_object_add(row, "rank", json_object_new_int64(entries[i].rank));
+        json_object_object_add(row, "username", json_object_new_string((const char*)g_ptr_array_index(board->names, entries[i].player)));
+        json_object_object_add(row, "score", json_object_new_int(entries[i].score));
+        json_object_array_add(rows, row);
+    }
+    g_free(entries);
+    json_object_object_add(result, "rows", rows);
+    return result;
+}
+
+static json_object* rank_query(struct lws* wsi, struct game_board* board, enum rank_window window) {
+    char arg[64];
+    json_object* result = json_object_new_object();
+    uint32_t total = board ? rank_tree_size(&board->tree) : 0;
+
+    if (board && window != RANK_WINDOW_ALL) {
+        int count;
+        const struct rank_entry* entries = rank_windows_top(&board->windows, window, current_hour(), &count);
+        total = (uint32_t)count;
+        if (lws_get_urlarg_by_name_safe(wsi, "username", arg, sizeof(arg)) >= 0) {
+            guint id = GPOINTER_TO_UINT(g_hash_table_lookup(board->players, arg));
+            int i = 0;
+            while (id && i < count && entries[i].player != id - 1) i++;
+            if (id && i < count) {
+                json_object_object_add(result, "rank", json_object_new_int64(entries[i].rank));
+                json_object_object_add(result, "score", json_object_new_int(entries[i].score));
+            }
+            // Outside the window's top RANK_WINDOW_TOP
+            else json_object_object_add(result, "rank", NULL);
+        }
+        else if (lws_get_urlarg_by_name_safe(wsi, "score", arg, sizeof(arg)) >= 0) {
+            json_object_object_add(result, "rank", json_object_new_int64(rank_windows_rank_of_score(entries, count, atoi(arg))));
+        }
+    }
+    else if (lws_get_urlarg_by_name_safe(wsi, "username", arg, sizeof(arg)) >= 0) {
+        guint id = board ? GPOINTER_TO_UINT(g_hash_table_lookup(board->players, arg)) : 0;
+        uint32_t handle = id ? g_array_index(board->handles, uint32_t, id - 1) : RANK_NIL;
+        if (handle != RANK_NIL) {
+            json_object_object_add(result, "rank", json_object_new_int64(rank_tree_rank_of(&board->tree, handle)));
+            json_object_object_add(result, "score", json_object_new_int(rank_tree_node(&board->tree, handle)->score));
+        }
+        else json_object_object_add(result, "rank", NULL);
+    }
+    else if (lws_get_urlarg_by_name_safe(wsi, "score", arg, sizeof(arg)) >= 0) {
+        uint32_t rank = board ? rank_tree_rank_of_score(&board->tree, atoi(arg)) : 1;
+        json_object_object_add(result, "rank", json_object_new_int64(rank));
+    }
+    json_object_object_add(result, "total", json_object_new_int64(total));
+    return result;
+}
+
+// The gzipped body of a page is another representation, so it gets its own
+// tag: "...-gz" inside the quotes
+static void gzip_etag(const char* etag, char* out, size_t size) {
+    size_t length = strlen(etag);
+    if (length && etag[length - 1] == '"') length--;
+    snprintf(out, size, "%.*s-gz\"", (int)length, etag);
+}
+
+// Send the status line and headers; a body, if any, follows on writable.
+// Bodies and tags depend on Accept-Encoding, which Vary tells caches.
+static int respond(struct lws* wsi, struct rank_session* session, unsigned int status, json_object* body, const char* etag) {
+    unsigned char buffer[LWS_PRE + 512];
+    unsigned char* start = &buffer[LWS_PRE];
+    unsigned char* p = start;
+    unsigned char* end = &buffer[sizeof(buffer) - 1];
+
+    g_free(session->body);
+    session->body = NULL;
+    session->length = 0;
+    session->sent = 0;
+    gboolean gzipped = FALSE;
+    if (body) {
+        size_t length;
+        const char* text = json_object_to_json_string_length(body, JSON_C_TO_STRING_PLAIN, &length);
+
+        char accept[128] = "";
+        lws_hdr_copy(wsi, accept, sizeof(accept), WSI_TOKEN_HTTP_ACCEPT_ENCODING);
+        if (length >= WSZ_THRESHOLD && strstr(accept, "gzip")) {
+            size_t packed_length;
+            unsigned char* packed = wsz_gzip(text, length, &packed_length);
+            if (packed) {
+                session->body = g_memdup2(packed, packed_length);
+                session->length = packed_length;
+                gzipped = TRUE;
+                free(packed);
+            }
+        }
+        if (!gzipped) {
+            session->body = g_strndup(text, length);
+            session->length = length;
+        }
+        json_object_put(body);
+    }
+
+    if (lws_add_http_common_headers(wsi, status, "application/json", session->length, &p, end)) return 1;
+    if (gzipped && lws_add_http_header_by_token(wsi, WSI_TOKEN_HTTP_CONTENT_ENCODING, (const unsigned char*)"gzip", 4, &p, end)) return 1;
+    if ((body || etag) && lws_add_http_header_by_token(wsi, WSI_TOKEN_HTTP_VARY, (const unsigned char*)"Accept-Encoding", 15, &p, end)) return 1;
+    char gz_etag[80];
+    if (etag && gzipped) {
+        gzip_etag(etag, gz_etag, sizeof(gz_etag));
+        etag = gz_etag;
+    }
+    if (etag && lws_add_http_header_by_token(wsi, WSI_TOKEN_HTTP_ETAG, (const unsigned char*)etag, (int)strlen(etag), &p, end)) return 1;
+    if (lws_finalize_write_http_header(wsi, start, &p, end)) return 1;
+
+    if (session->length == 0) return lws_http_transaction_completed(wsi) ? -1 : 0;
+    lws_callback_on_writable(wsi);
+    return 0;
+}
+
+static int handle_get(struct lws* wsi, struct rank_session* session, const char* path) {
+    char game[32] = "";
+    char arg[32];
+    lws_get_urlarg_by_name_safe(wsi, "game", game, sizeof(game));
+    struct game_board* board = find_board(game, FALSE);
+    enum rank_window window = lws_get_urlarg_by_name_safe(wsi, "window", arg, sizeof(arg)) > 0 ? rank_window_from_name(arg) : RANK_WINDOW_ALL;
+
+    if (strcmp(path, "/rank") == 0) return respond(wsi, session, HTTP_STATUS_OK, rank_query(wsi, board, window), NULL);
+    if (path[0] && strcmp(path, "/") != 0) return respond(wsi, session, HTTP_STATUS_NOT_FOUND, NULL, NULL);
+
+    long offset = lws_get_urlarg_by_name_safe(wsi, "offset", arg, sizeof(arg)) > 0 ? atol(arg) : 0;
+    if (offset < 0) offset = 0;
+    int limit = lws_get_urlarg_by_name_safe(wsi, "limit", arg, sizeof(arg)) > 0 ? atoi(arg) : 100;
+    if (limit < 1) limit = 1;
+    if (limit > MAX_PAGE_ROWS) limit = MAX_PAGE_ROWS;
+
+    // Window boards also change when the hour rolls over
+    char etag[64];
+    char gz_etag[80];
+    char if_none_match[80] = "";
+    snprintf(etag, sizeof(etag), "\"%llu-%d-%lld-%ld-%d\"", (unsigned long long)(board ? board->version : 0),
+        (int)window, window == RANK_WINDOW_ALL ? 0LL : (long long)current_hour(), offset, limit);
+    gzip_etag(etag, gz_etag, sizeof(gz_etag));
+    lws_hdr_copy(wsi, if_none_match, sizeof(if_none_match), WSI_TOKEN_HTTP_IF_NONE_MATCH);
+    // A client revalidates the representation it holds
+    if (strcmp(etag, if_none_match) == 0) return respond(wsi, session, HTTP_STATUS_NOT_MODIFIED, NULL, etag);
+    if (strcmp(gz_etag, if_none_match) == 0) return respond(wsi, session, HTTP_STATUS_NOT_MODIFIED, NULL, gz_etag);
+
+    return respond(wsi, session, HTTP_STATUS_OK, leaderboard_page(board, window, offset, limit), etag);
+}
+
+int rank_service_live_message(struct lws* wsi, const char* message) {
+    // Game server messages arrive as "[room] user: TEXT"
+    const char* text = strstr(message, ": ");
+    text = text ? text + 2 : message;
+
+    if (strncmp(text, "UNSUBSCRIBE", 11) == 0) {
+        rank_service_live_closed(wsi);
+        return 1;
+    }
+
+    char game[32];
+    char window[16];
+    unsigned int first_rank;
+    int count;
+    if (sscanf(text, "SUBSCRIBE %31s %15s %u %d", game, window, &first_rank, &count) != 4) return 0;
+    if (first_rank < 1) first_rank = 1;
+    if (count < 1) count = 1;
+    if (count > LIVE_MAX_ROWS) count = LIVE_MAX_ROWS;
+
+    if (!live_subscriptions) live_subscriptions = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+    struct live_subscription* sub = g_new0(struct live_subscription, 1);
+    g_strlcpy(sub->game, game, sizeof(sub->game));
+    sub->window = rank_window_from_name(window);
+    sub->first_rank = first_rank;
+    sub->count = count;
+    g_hash_table_insert(live_subscriptions, wsi, sub);
+
+    // The first push carries the whole range
+    lws_callback_on_writable(wsi);
+    return 1;
+}
+
+void rank_service_live_closed(struct lws* wsi) {
+    if (live_subscriptions) g_hash_table_remove(live_subscriptions, wsi);
+}
+
+// Send the rows that changed since the last push as
+// RANKS {"game", "window", "total", "count", "rows": [[rank, name, score], ...]}
+int rank_service_live_writeable(struct lws* wsi) {
+    struct live_subscription* sub = live_subscriptions ? (struct live_subscription*)g_hash_table_lookup(live_subscriptions, wsi) : NULL;
+    if (!sub) return 0;
+
+    struct game_board* board = find_board(sub->game, FALSE);
+    struct rank_entry entries[LIVE_MAX_ROWS];
+    uint32_t total;
+    int count = board_range(board, sub->window, sub->first_rank, sub->count, entries, &total);
+
+    json_object* rows = json_object_new_array();
+    for (int i = 0; i < count; i++) {
+        if (sub->primed && i < sub->sent_count && entries[i].player == sub->sent[i].player && entries[i].score == sub->sent[i].score) continue;
+        json_object* row = json_object_new_array();
+        json_object_array_add(row, json_object_new_int64(entries[i].rank));
+        json_object_array_add(row, json_object_new_string((const char*)g_ptr_array_index(board->names, entries[i].player)));
+        json_object_array_add(row, json_object_new_int(entries[i].score));
+        json_object_array_add(rows, row);
+    }
+
+    if (sub->primed && json_object_array_length(rows) == 0 && count == sub->sent_count && total == sub->sent_total) {
+        json_object_put(rows);
+        return 0;
+    }
+
+    json_object* update = json_object_new_object();
+    json_object_object_add(update, "game", json_object_new_string(sub->game));
+    json_object_object_add(update, "window", json_object_new_string(window_names[sub->window]));
+    json_object_object_add(update, "total", json_object_new_int64(total));
+    json_object_object_add(update, "count", json_object_new_int(count));
+    json_object_object_add(update, "rows", rows);
+
+    char* message = g_strconcat("RANKS ", json_object_to_json_string_ext(update, JSON_C_TO_STRING_PLAIN), NULL);
+    json_object_put(update);
+
+    // A full range is compressed as a binary frame, small deltas go as text
+    size_t length;
+    int binary;
+    unsigned char* buffer = wsz_encode(message, strlen(message), LWS_PRE, &length, &binary);
+    g_free(message);
+    if (!buffer) return -1;
+    int written = lws_write(wsi, &buffer[LWS_PRE], length, binary ? LWS_WRITE_BINARY : LWS_WRITE_TEXT);
+    free(buffer);
+    if (written < (int)length) return -1;
+
+    memcpy(sub->sent, entries, sizeof(struct rank_entry) * count);
+    sub->sent_count = count;
+    sub->sent_total = total;
+    sub->primed = TRUE;
+    return 0;
+}
+
+int rank_service_authorize(struct lws* wsi, struct jwt_claims* claims) {
+    memset(claims, 0, sizeof(*claims));
+    if (!jwt_keys_loaded()) return 1;
+
+    char header[2048];
+    if (lws_hdr_copy(wsi, header, sizeof(header), WSI_TOKEN_HTTP_AUTHORIZATION) <= 0 ||
+        g_ascii_strncasecmp(header, "Bearer ", 7) != 0) {
+        return 0;
+    }
+    enum jwt_status status = jwt_verify(header + 7, claims);
+    if (status != JWT_OK) {
+        lwsl_info("Rank service: rejected token: %s\n", jwt_status_string(status));
+        return 0;
+    }
+    return 1;
+}
+
+static int callback_rank_http(struct lws* wsi, enum lws_callback_reasons reason, void* user, void* in, size_t len) {
+    struct rank_session* session = (struct rank_session*)user;
+
+    switch (reason) {
+    case LWS_CALLBACK_PROTOCOL_INIT:
+        if (replay_verify_start(0, wake_service, lws_get_context(wsi)) != 0) {
+            lwsl_err("Rank service: no replay verification workers, scores cannot be accepted\n");
+        }
+        break;
+
+    case LWS_CALLBACK_EVENT_WAIT_CANCELLED:
+        file_checked_scores();
+        break;
+
+    // The workers wake the context, so they stop before it goes
+    case LWS_CALLBACK_PROTOCOL_DESTROY:
+        replay_verify_shutdown();
+        break;
+
+    case LWS_CALLBACK_HTTP:
+        if (lws_hdr_total_length(wsi, WSI_TOKEN_POST_URI)) {
+            if (strcmp((const char*)in, "/batch") != 0) return respond(wsi, session, HTTP_STATUS_NOT_FOUND, NULL, NULL);
+            struct jwt_claims claims;
+            if (!rank_service_authorize(wsi, &claims)) return respond(wsi, session, HTTP_STATUS_UNAUTHORIZED, NULL, NULL);
+            g_strlcpy(session->subject, claims.subject, sizeof(session->subject));
+            // The array arrives in LWS_CALLBACK_HTTP_BODY chunks
+            lejp_construct(&session->ctx, batch_parsed, session, batch_paths, LWS_ARRAY_SIZE(batch_paths));
+            session->parsing = TRUE;
+            session->queued = 0;
+            session->busy = FALSE;
+            return 0;
+        }
+        return handle_get(wsi, session, (const char*)in);
+
+    case LWS_CALLBACK_HTTP_BODY:
+        if (session->parsing) {
+            int n = lejp_parse(&session->ctx, (const unsigned char*)in, (int)len);
+            if (n < 0 && n != LEJP_CONTINUE) {
+                lwsl_warn("Rank service: bad batch: %s\n", lejp_error_to_string(n));
+                lejp_destruct(&session->ctx);
+                session->parsing = FALSE;
+                return respond(wsi, session, HTTP_STATUS_BAD_REQUEST, NULL, NULL);
+            }
+        }
+        return 0;
+
+    case LWS_CALLBACK_HTTP_BODY_COMPLETION:
+        if (!session->parsing) return 0;
+        lejp_destruct(&session->ctx);
+        session->parsing = FALSE;
+        // Scores queued before the queue filled are checked anyway; their ids
+        // are remembered, so the client's resend only queues the rest
+        if (session->busy) return respond(wsi, session, HTTP_STATUS_SERVICE_UNAVAILABLE, NULL, NULL);
+        {
+            json_object* result = json_object_new_object();
+            json_object_object_add(result, "queued", json_object_new_int(session->queued));
+            return respond(wsi, session, HTTP_STATUS_OK, result, NULL);
+        }
+
+    case LWS_CALLBACK_HTTP_WRITEABLE: {
+        if (!session->body) return 0;
+        unsigned char buffer[LWS_PRE + WRITE_CHUNK];
+        size_t n = session->length - session->sent;
+        if (n > WRITE_CHUNK) n = WRITE_CHUNK;
+        memcpy(&buffer[LWS_PRE], session->body + session->sent, n);
+        session->sent += n;
+
+        int final = session->sent == session->length;
+        if (lws_write(wsi, &buffer[LWS_PRE], n, final ? LWS_WRITE_HTTP_FINAL : LWS_WRITE_HTTP) != (int)n) return -1;
+        if (!final) {
+            lws_callback_on_writable(wsi);
+            return 0;
+        }
+        g_free(session->body);
+        session->body = NULL;
+        return lws_http_transaction_completed(wsi) ? -1 : 0;
+    }
+
+    case LWS_CALLBACK_CLOSED_HTTP:
+        if (session->parsing) lejp_destruct(&session->ctx);
+        session->parsing = FALSE;
+        g_free(session->body);
+        session->body = NULL;
+        if (session->replay) g_string_free(session->replay, TRUE);
+        session->replay = NULL;
+        break;
+
+    default:
+        break;
+    }
+    return lws_callback_http_dummy(wsi, reason, user, in, len);
+}
+
+const struct lws_protocols rank_service_protocol = {
+    RANK_SERVICE_PROTOCOL,
+    callback_rank_http,
+    sizeof(struct rank_session),
+    0,
+};
+
+// Standalone WebSocket endpoint for live updates, speaking the same messages
+static int callback_rank_live(struct lws* wsi, enum lws_callback_reasons reason, void* user, void* in, size_t len) {
+    (void)user;
+    switch (reason) {
+    case LWS_CALLBACK_RECEIVE: {
+        // Subscriptions are short; large wsz frames only flow server to client
+        char* message = g_strndup((const char*)in, len);
+        rank_service_live_message(wsi, message);
+        g_free(message);
+        break;
+    }
+    case LWS_CALLBACK_SERVER_WRITEABLE:
+        return rank_service_live_writeable(wsi);
+    case LWS_CALLBACK_CLOSED:
+        rank_service_live_closed(wsi);
+        break;
+    default:
+        break;
+    }
+    return 0;
+}
+
+const struct lws_protocols rank_live_protocol = {
+    RANK_LIVE_PROTOCOL,
+    callback_rank_live,
+    0,
+    LIVE_MESSAGE_SIZE,
+};
+
+const struct lws_http_mount rank_service_mount = {
+    .mountpoint = "/scores",
+    .origin = RANK_SERVICE_PROTOCOL,
+    .origin_protocol = LWSMPRO_CALLBACK,
+    .mountpoint_len = 7,
+};
+
+void rank_service_shutdown(void) {
+    replay_verify_shutdown();
+    if (live_subscriptions) g_hash_table_destroy(live_subscriptions);
+    live_subscriptions = NULL;
+    if (boards) g_hash_table_destroy(boards);
+    boards = NULL;
+    if (seen_ids) g_hash_table_destroy(seen_ids);
+    seen_ids = NULL;
+    while (!g_queue_is_empty(&seen_order)) g_free(g_queue_pop_head(&seen_order));
+}
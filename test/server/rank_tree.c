@@ -0,0 +1,201 @@
+// Order-statistic treap (see rank_tree.h).
+//
+// Insert and remove use split/merge, so there are no rotations and no parent
+// links. A node's heap priority is a hash of its slot index: it is as random
+// as a stored one as far as the key order is concerned, and saves 4 bytes a
+// node. Recursion depth is the tree height, about 2.5 log2(n) in expectation.
+#include <stdlib.h>
+#include <string.h>
+
+#include "rank_tree.h"
+
+static uint32_t priority(uint32_t index) {
+    uint32_t x = index + 0x9E3779B9u;
+    x ^= x >> 16;
+    x *= 0x85EBCA6Bu;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35u;
+    x ^= x >> 16;
+    return x;
+}
+
+static uint32_t size_of(const struct rank_tree* tree, uint32_t node) {
+    return node == RANK_NIL ? 0 : tree->nodes[node].size;
+}
+
+static void update(struct rank_tree* tree, uint32_t node) {
+    struct rank_node* n = &tree->nodes[node];
+    n->size = 1 + size_of(tree, n->left) + size_of(tree, n->right);
+}
+
+// Does a rank ahead of b?
+static int ahead(const struct rank_node* a, const struct rank_node* b) {
+    return a->score > b->score || (a->score == b->score && a->seq < b->seq);
+}
+
+// Split t into the nodes ahead of key and the rest
+static void split(struct rank_tree* tree, uint32_t t, const struct rank_node* key, uint32_t* left, uint32_t* right) {
+    if (t == RANK_NIL) {
+        *left = *right = RANK_NIL;
+        return;
+    }
+    struct rank_node* n = &tree->nodes[t];
+    if (ahead(n, key)) {
+        split(tree, n->right, key, &n->right, right);
+        *left = t;
+    }
+    else {
+        split(tree, n->left, key, left, &n->left);
+        *right = t;
+    }
+    update(tree, t);
+}
+
+// Every node of a ranks ahead of every node of b
+static uint32_t merge(struct rank_tree* tree, uint32_t a, uint32_t b) {
+    if (a == RANK_NIL) return b;
+    if (b == RANK_NIL) return a;
+    if (priority(a) > priority(b)) {
+        tree->nodes[a].right = merge(tree, tree->nodes[a].right, b);
+        update(tree, a);
+        return a;
+    }
+    tree->nodes[b].left = merge(tree, a, tree->nodes[b].left);
+    update(tree, b);
+    return b;
+}
+
+static uint32_t remove_first(struct rank_tree* tree, uint32_t t) {
+    struct rank_node* n = &tree->nodes[t];
+    if (n->left == RANK_NIL) return n->right;
+    n->left = remove_first(tree, n->left);
+    update(tree, t);
+    return t;
+}
+
+int rank_tree_init(struct rank_tree* tree, uint32_t capacity_hint) {
+    memset(tree, 0, sizeof(*tree));
+    tree->root = RANK_NIL;
+    tree->free_list = RANK_NIL;
+    if (capacity_hint < 64) capacity_hint = 64;
+    tree->nodes = (struct rank_node*)malloc(sizeof(struct rank_node) * capacity_hint);
+    if (!tree->nodes) return -1;
+    tree->capacity = capacity_hint;
+    return 0;
+}
+
+void rank_tree_free(struct rank_tree* tree) {
+    free(tree->nodes);
+    memset(tree, 0, sizeof(*tree));
+    tree->root = RANK_NIL;
+    tree->free_list = RANK_NIL;
+}
+
+static uint32_t alloc_node(struct rank_tree* tree) {
+    if (tree->free_list != RANK_NIL) {
+        uint32_t node = tree->free_list;
+        tree->free_list = tree->nodes[node].left;
+        return node;
+    }
+    if (tree->used == tree->capacity) {
+        if (tree->capacity >= RANK_NIL / 2) return RANK_NIL;
+        uint32_t capacity = tree->capacity * 2;
+        struct rank_node* nodes = (struct rank_node*)realloc(tree->nodes, sizeof(struct rank_node) * capacity);
+        if (!nodes) return RANK_NIL;
+        tree->nodes = nodes;
+        tree->capacity = capacity;
+    }
+    return tree->used++;
+}
+
+uint32_t rank_tree_insert(struct rank_tree* tree, int32_t score, uint32_t player) {
+    uint32_t node = alloc_node(tree);
+    if (node == RANK_NIL) return RANK_NIL;
+
+    struct rank_node* n = &tree->nodes[node];
+    n->score = score;
+    n->seq = tree->next_seq++;
+    n->player = player;
+    n->size = 1;
+    n->left = n->right = RANK_NIL;
+
+    uint32_t left, right;
+    struct rank_node key = *n;
+    split(tree, tree->root, &key, &left, &right);
+    tree->root = merge(tree, merge(tree, left, node), right);
+    return node;
+}
+
+void rank_tree_remove(struct rank_tree* tree, uint32_t handle) {
+    uint32_t left, right;
+    struct rank_node key = tree->nodes[handle];
+    split(tree, tree->root, &key, &left, &right);
+    // handle is now the first node of right
+    right = remove_first(tree, right);
+    tree->root = merge(tree, left, right);
+
+    tree->nodes[handle].left = tree->free_list;
+    tree->free_list = handle;
+}
+
+uint32_t rank_tree_size(const struct rank_tree* tree) {
+    return size_of(tree, tree->root);
+}
+
+uint32_t rank_tree_rank_of_score(const struct rank_tree* tree, int32_t score) {
+    uint32_t higher = 0;
+    uint32_t t = tree->root;
+    while (t != RANK_NIL) {
+        const struct rank_node* n = &tree->nodes[t];
+        if (n->score > score) {
+            higher += size_of(tree, n->left) + 1;
+            t = n->right;
+        }
+        else t = n->left;
+    }
+    return higher + 1;
+}
+
+uint32_t rank_tree_rank_of(const struct rank_tree* tree, uint32_t handle) {
+    const struct rank_node* key = &tree->nodes[handle];
+    uint32_t before = 0;
+    uint32_t t = tree->root;
+    while (t != RANK_NIL && t != handle) {
+        const struct rank_node* n = &tree->nodes[t];
+        if (ahead(n, key)) {
+            before += size_of(tree, n->left) + 1;
+            t = n->right;
+        }
+        else t = n->left;
+    }
+    return before + size_of(tree, key->left) + 1;
+}
+
+// In-order walk that skips whole subtrees lying before the range
+static void collect(const struct rank_tree* tree, uint32_t t, uint32_t skip, uint32_t base, int* remaining, struct rank_entry* out, int* written) {
+    while (t != RANK_NIL && *remaining > 0) {
+        const struct rank_node* n = &tree->nodes[t];
+        uint32_t left = size_of(tree, n->left);
+        if (skip < left) collect(tree, n->left, skip, base, remaining, out, written);
+        if (*remaining == 0) return;
+        if (skip <= left) {
+            out[*written].rank = base + left + 1;
+            out[*written].score = n->score;
+            out[*written].player = n->player;
+            (*written)++;
+            (*remaining)--;
+            skip = 0;
+        }
+        else skip -= left + 1;
+        base += left + 1;
+        t = n->right;
+    }
+}
+
+int rank_tree_range(const struct rank_tree* tree, uint32_t first_rank, int count, struct rank_entry* out) {
+    if (first_rank < 1 || count <= 0) return 0;
+    int remaining = count;
+    int written = 0;
+    collect(tree, tree->root, first_rank - 1, 0, &remaining, out, &written);
+    return written;
+}
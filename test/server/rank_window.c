@@ -0,0 +1,253 @@
+// Time-windowed leaderboards (see rank_window.h).
+//
+// Scores are stamped with the hour they were played, so most go to the
+// latest hour's bucket. Each player remembers a single heap position in that
+// bucket, tagged with its hour; a position from an earlier hour is simply
+// stale, which is what lets a bucket be recycled without touching its
+// entries. The few scores that arrive late, from a client that was offline,
+// find the player in their older bucket by a scan.
+#include <stdlib.h>
+#include <string.h>
+
+#include "rank_window.h"
+
+static const int window_hours[RANK_WINDOW_COUNT] = { 0, 24, RANK_WINDOW_BUCKETS };
+
+// Does a rank ahead of b?
+static int ahead(const struct rank_node* a, const struct rank_node* b) {
+    return a->score > b->score || (a->score == b->score && a->seq < b->seq);
+}
+
+void rank_windows_init(struct rank_windows* windows) {
+    memset(windows, 0, sizeof(*windows));
+    for (int i = 0; i < RANK_WINDOW_BUCKETS; i++) windows->buckets[i].hour = -1;
+    for (int i = 0; i < RANK_WINDOW_COUNT; i++) windows->merged[i].hour = -1;
+    windows->latest_hour = -1;
+}
+
+void rank_windows_free(struct rank_windows* windows) {
+    for (int i = 0; i < RANK_WINDOW_BUCKETS; i++) free(windows->buckets[i].heap);
+    for (int i = 0; i < RANK_WINDOW_COUNT; i++) free(windows->merged[i].entries);
+    free(windows->player_hour);
+    free(windows->player_pos);
+    free(windows->player_seen);
+    memset(windows, 0, sizeof(*windows));
+}
+
+static int grow_players(struct rank_windows* windows, uint32_t player) {
+    if (player < windows->players) return 0;
+
+    uint32_t players = windows->players ? windows->players : 256;
+    while (players <= player) players *= 2;
+    int64_t* hour = (int64_t*)realloc(windows->player_hour, sizeof(int64_t) * players);
+    if (hour) windows->player_hour = hour;
+    int* pos = (int*)realloc(windows->player_pos, sizeof(int) * players);
+    if (pos) windows->player_pos = pos;
+    uint32_t* seen = (uint32_t*)realloc(windows->player_seen, sizeof(uint32_t) * players);
+    if (seen) windows->player_seen = seen;
+    if (!hour || !pos || !seen) return -1;
+
+    for (uint32_t i = windows->players; i < players; i++) {
+        windows->player_hour[i] = -1;
+        windows->player_seen[i] = 0;
+    }
+    windows->players = players;
+    return 0;
+}
+
+static void heap_place(struct rank_windows* windows, struct rank_bucket* bucket, int pos, const struct rank_node* entry) {
+    bucket->heap[pos] = *entry;
+    if (bucket->hour != windows->latest_hour) return;
+    windows->player_hour[entry->player] = bucket->hour;
+    windows->player_pos[entry->player] = pos;
+}
+
+// Heap position of the player in the bucket, -1 if they are not in its top
+static int find_player(const struct rank_windows* windows, const struct rank_bucket* bucket, uint32_t player) {
+    if (bucket->hour == windows->latest_hour) return windows->player_hour[player] == bucket->hour ? windows->player_pos[player] : -1;
+    for (int i = 0; i < bucket->count; i++) {
+        if (bucket->heap[i].player == player) return i;
+    }
+    return -1;
+}
+
+static void sift_up(struct rank_windows* windows, struct rank_bucket* bucket, int pos) {
+    struct rank_node entry = bucket->heap[pos];
+    while (pos > 0) {
+        int parent = (pos - 1) / 2;
+        if (!ahead(&bucket->heap[parent], &entry)) break;
+        heap_place(windows, bucket, pos, &bucket->heap[parent]);
+        pos = parent;
+    }
+    heap_place(windows, bucket, pos, &entry);
+}
+
+static void sift_down(struct rank_windows* windows, struct rank_bucket* bucket, int pos) {
+    struct rank_node entry = bucket->heap[pos];
+    for (;;) {
+        int child = 2 * pos + 1;
+        if (child >= bucket->count) break;
+        if (child + 1 < bucket->count && ahead(&bucket->heap[child], &bucket->heap[child + 1])) child++;
+        if (!ahead(&entry, &bucket->heap[child])) break;
+        heap_place(windows, bucket, pos, &bucket->heap[child]);
+        pos = child;
+    }
+    heap_place(windows, bucket, pos, &entry);
+}
+
+// Fold a score that entered the current hour's bucket into a merged board
+// that is up to date and covers its hour, in O(RANK_WINDOW_TOP) and without
+// a merge. Nothing
+// ever has to leave a board: an entry a full bucket evicts is behind the
+// RANK_WINDOW_TOP other players in that bucket, so it was not on the board,
+// and a player's replaced bucket entry scored less than the new one. The
+// new score is the latest, so it ranks after equal scores.
+static void merged_update(struct rank_merged* merged, uint32_t player, int32_t score) {
+    struct rank_entry* entries = merged->entries;
+    int from = merged->count;
+    for (int i = 0; i < merged->count; i++) {
+        if (entries[i].player == player) {
+            from = i;
+            break;
+        }
+    }
+    if (from < merged->count && entries[from].score >= score) return;
+
+    // First row scoring less, among the rows ahead of the player's old one
+    int to = 0;
+    int hi = from;
+    while (to < hi) {
+        int mid = (to + hi) / 2;
+        if (entries[mid].score >= score) to = mid + 1;
+        else hi = mid;
+    }
+    if (from == merged->count) {
+        if (to >= RANK_WINDOW_TOP) return;
+        if (merged->count < RANK_WINDOW_TOP) merged->count++;
+        from = merged->count - 1;    // the new last row, or the one pushed off
+    }
+    memmove(&entries[to + 1], &entries[to], sizeof(struct rank_entry) * (size_t)(from - to));
+    entries[to].score = score;
+    entries[to].player = player;
+    for (int i = to; i <= from; i++) entries[i].rank = (uint32_t)i + 1;
+}
+
+int rank_windows_submit(struct rank_windows* windows, int64_t hour, uint32_t player, int32_t score) {
+    if (grow_players(windows, player) != 0) return 0;
+    // Too late for any window
+    if (hour < 0 || hour <= windows->latest_hour - RANK_WINDOW_BUCKETS) return 0;
+    if (hour > windows->latest_hour) windows->latest_hour = hour;
+
+    struct rank_bucket* bucket = &windows->buckets[hour % RANK_WINDOW_BUCKETS];
+    if (bucket->hour != hour) {
+        // Recycle the slot of the hour that just left the week
+        bucket->hour = hour;
+        bucket->count = 0;
+    }
+    if (!bucket->heap) {
+        bucket->heap = (struct rank_node*)malloc(sizeof(struct rank_node) * RANK_WINDOW_TOP);
+        if (!bucket->heap) return 0;
+    }
+
+    struct rank_node entry = { score, windows->next_seq++, player, 1, RANK_NIL, RANK_NIL };
+    int pos = find_player(windows, bucket, player);
+    if (pos >= 0) {
+        // Already in this hour's top: keep the better score
+        if (bucket->heap[pos].score >= score) return 0;
+        bucket->heap[pos] = entry;
+        sift_down(windows, bucket, pos);
+    }
+    else if (bucket->count < RANK_WINDOW_TOP) {
+        bucket->heap[bucket->count++] = entry;
+        sift_up(windows, bucket, bucket->count - 1);
+    }
+    else {
+        // Full: the new score has to beat the worst kept one
+        if (!ahead(&entry, &bucket->heap[0])) return 0;
+        if (hour == windows->latest_hour) windows->player_hour[bucket->heap[0].player] = -1;
+        bucket->heap[0] = entry;
+        sift_down(windows, bucket, 0);
+    }
+
+    // Current boards whose window holds this hour stay current; others are
+    // merged again when asked for
+    for (int w = RANK_WINDOW_ALL + 1; w < RANK_WINDOW_COUNT; w++) {
+        struct rank_merged* merged = &windows->merged[w];
+        if (merged->version != windows->version || hour > merged->hour || merged->hour - hour >= window_hours[w]) continue;
+        merged_update(merged, player, score);
+        merged->version = windows->version + 1;
+    }
+    windows->version++;
+    return 1;
+}
+
+static int by_rank(const void* a, const void* b) {
+    const struct rank_entry* x = (const struct rank_entry*)a;
+    const struct rank_entry* y = (const struct rank_entry*)b;
+    if (x->score != y->score) return x->score > y->score ? -1 : 1;
+    // rank holds the seq until the merge numbers the rows
+    return x->rank < y->rank ? -1 : x->rank > y->rank;
+}
+
+const struct rank_entry* rank_windows_top(struct rank_windows* windows, enum rank_window window, int64_t hour, int* count) {
+    struct rank_merged* merged = &windows->merged[window];
+    *count = 0;
+    if (window <= RANK_WINDOW_ALL || window >= RANK_WINDOW_COUNT) return NULL;
+    if (merged->hour == hour && merged->version == windows->version) {
+        *count = merged->count;
+        return merged->entries;
+    }
+
+    if (!merged->entries) {
+        merged->entries = (struct rank_entry*)malloc(sizeof(struct rank_entry) * RANK_WINDOW_TOP * window_hours[window]);
+        if (!merged->entries) return NULL;
+    }
+
+    int collected = 0;
+    for (int h = 0; h < window_hours[window]; h++) {
+        const struct rank_bucket* bucket = &windows->buckets[(hour - h) % RANK_WINDOW_BUCKETS];
+        if (bucket->hour != hour - h) continue;
+        for (int i = 0; i < bucket->count; i++) {
+            struct rank_entry* e = &merged->entries[collected++];
+            e->score = bucket->heap[i].score;
+            e->player = bucket->heap[i].player;
+            e->rank = bucket->heap[i].seq;
+        }
+    }
+    qsort(merged->entries, collected, sizeof(struct rank_entry), by_rank);
+
+    // A player counts once, with their best score in the window
+    uint32_t stamp = ++windows->merge_stamp;
+    int kept = 0;
+    for (int i = 0; i < collected && kept < RANK_WINDOW_TOP; i++) {
+        uint32_t player = merged->entries[i].player;
+        if (windows->player_seen[player] == stamp) continue;
+        windows->player_seen[player] = stamp;
+        merged->entries[kept] = merged->entries[i];
+        merged->entries[kept].rank = kept + 1;
+        kept++;
+    }
+
+    merged->hour = hour;
+    merged->version = windows->version;
+    merged->count = kept;
+    *count = kept;
+    return merged->entries;
+}
+
+uint32_t rank_windows_rank_of_score(const struct rank_entry* entries, int count, int32_t score) {
+    int lo = 0;
+    int hi = count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (entries[mid].score > score) lo = mid + 1;
+        else hi = mid;
+    }
+    return (uint32_t)lo + 1;
+}
+
+enum rank_window rank_window_from_name(const char* name) {
+    if (strcmp(name, "day") == 0) return RANK_WINDOW_DAY;
+    if (strcmp(name, "week") == 0) return RANK_WINDOW_WEEK;
+    return RANK_WINDOW_ALL;
+}
@@ -0,0 +1,225 @@
+// Replay verification pool (see replay_verify.h)
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "replay_verify.h"
+
+#define HOUR_MS (60LL * 60 * 1000)
+
+// Which replays a game's scores need, and how much game time they may cover
+struct game_budget {
+    const char* game;
+    enum replay_game replay_game;
+    int param;
+    int64_t max_ms;
+};
+
+static const struct game_budget budgets[] = {
+    { "tetris", REPLAY_TETRIS, 0, 3 * HOUR_MS },
+    // 2048 has no clock; the byte limit of a replay bounds its moves
+    { "2048", REPLAY_2048, 4, 24 * HOUR_MS },
+    { "2048-6x6", REPLAY_2048, 6, 24 * HOUR_MS },
+    { "2048-8x8", REPLAY_2048, 8, 24 * HOUR_MS },
+};
+
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_work = PTHREAD_COND_INITIALIZER;
+static struct replay_check* queue_head = NULL;
+static struct replay_check* queue_tail = NULL;
+static struct replay_check* done_head = NULL;
+static struct replay_check* done_tail = NULL;
+static int queued = 0;                   // waiting to start, guarded by pool_lock
+static int backlog = 0;                  // submitted and not collected
+static pthread_t* workers = NULL;
+static int worker_count = 0;
+static volatile int pool_stopping = 0;
+static replay_verify_wake_fn wake_fn = NULL;
+static void* wake_arg = NULL;
+
+static long long monotonic_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+}
+
+static const struct game_budget* find_budget(const char* game) {
+    for (size_t i = 0; i < sizeof(budgets) / sizeof(budgets[0]); i++) {
+        if (strcmp(budgets[i].game, game) == 0) return &budgets[i];
+    }
+    return NULL;
+}
+
+enum replay_verdict replay_verify_run(struct replay_check* check) {
+    long long start = monotonic_us();
+    const struct game_budget* budget = find_budget(check->game);
+    struct replay_reader header;
+    enum replay_verdict verdict;
+
+    if (!budget) verdict = REPLAY_VERIFY_UNKNOWN_GAME;
+    else if (!check->replay || !check->size) verdict = REPLAY_VERIFY_NO_REPLAY;
+    else if (!replay_open(&header, check->replay, check->size)) verdict = REPLAY_VERIFY_INVALID;
+    else if (header.game != budget->replay_game || header.param != budget->param) verdict = REPLAY_VERIFY_WRONG_GAME;
+    else if (!replay_run(check->replay, check->size, budget->max_ms, &check->result)) {
+        verdict = check->result.duration_ms > budget->max_ms ? REPLAY_VERIFY_OVER_BUDGET : REPLAY_VERIFY_INVALID;
+    }
+    else if (!check->result.over) verdict = REPLAY_VERIFY_NOT_OVER;
+    // Clients submit scores as int
+    else if ((check->result.score > INT_MAX ? INT_MAX : (int)check->result.score) != check->score) verdict = REPLAY_VERIFY_SCORE;
+    else verdict = REPLAY_VERIFY_OK;
+
+    check->verdict = verdict;
+    check->elapsed_us = monotonic_us() - start;
+    return verdict;
+}
+
+static void* worker_main(void* arg) {
+    (void)arg;
+    for (;;) {
+        pthread_mutex_lock(&pool_lock);
+        while (!queue_head && !pool_stopping) pthread_cond_wait(&pool_work, &pool_lock);
+        struct replay_check* check = queue_head;
+        if (pool_stopping) {
+            pthread_mutex_unlock(&pool_lock);
+            return NULL;
+        }
+        queue_head = check->next;
+        if (!queue_head) queue_tail = NULL;
+        queued--;
+        pthread_mutex_unlock(&pool_lock);
+
+        check->next = NULL;
+        replay_verify_run(check);
+
+        pthread_mutex_lock(&pool_lock);
+        if (done_tail) done_tail->next = check;
+        else done_head = check;
+        done_tail = check;
+        replay_verify_wake_fn wake = wake_fn;
+        void* wake_data = wake_arg;
+        pthread_mutex_unlock(&pool_lock);
+        if (wake) wake(wake_data);
+    }
+}
+
+int replay_verify_start(int count, replay_verify_wake_fn wake, void* arg) {
+    pthread_mutex_lock(&pool_lock);
+    if (worker_count) {
+        pthread_mutex_unlock(&pool_lock);
+        return 0;
+    }
+    if (count <= 0) count = REPLAY_VERIFY_WORKERS;
+    workers = (pthread_t*)calloc((size_t)count, sizeof(pthread_t));
+    if (!workers) {
+        pthread_mutex_unlock(&pool_lock);
+        return -1;
+    }
+    pool_stopping = 0;
+    wake_fn = wake;
+    wake_arg = arg;
+    for (int i = 0; i < count; i++) {
+        if (pthread_create(&workers[i], NULL, worker_main, NULL) != 0) {
+            fprintf(stderr, "Replay verification: started %d of %d workers\n", i, count);
+            break;
+        }
+        worker_count++;
+    }
+    int started = worker_count;
+    if (!started) {
+        free(workers);
+        workers = NULL;
+    }
+    pthread_mutex_unlock(&pool_lock);
+    return started ? 0 : -1;
+}
+
+bool replay_verify_submit(struct replay_check* check) {
+    pthread_mutex_lock(&pool_lock);
+    if (!worker_count || pool_stopping || queued >= REPLAY_VERIFY_QUEUE) {
+        pthread_mutex_unlock(&pool_lock);
+        return false;
+    }
+    check->verdict = REPLAY_VERIFY_PENDING;
+    check->next = NULL;
+    if (queue_tail) queue_tail->next = check;
+    else queue_head = check;
+    queue_tail = check;
+    queued++;
+    backlog++;
+    pthread_cond_signal(&pool_work);
+    pthread_mutex_unlock(&pool_lock);
+    return true;
+}
+
+struct replay_check* replay_verify_collect(void) {
+    pthread_mutex_lock(&pool_lock);
+    struct replay_check* checks = done_head;
+    for (struct replay_check* check = checks; check; check = check->next) backlog--;
+    done_head = NULL;
+    done_tail = NULL;
+    pthread_mutex_unlock(&pool_lock);
+    return checks;
+}
+
+int replay_verify_backlog(void) {
+    pthread_mutex_lock(&pool_lock);
+    int count = backlog;
+    pthread_mutex_unlock(&pool_lock);
+    return count;
+}
+
+const char* replay_verdict_string(enum replay_verdict verdict) {
+    switch (verdict) {
+    case REPLAY_VERIFY_PENDING: return "pending";
+    case REPLAY_VERIFY_OK: return "ok";
+    case REPLAY_VERIFY_NO_REPLAY: return "no replay";
+    case REPLAY_VERIFY_UNKNOWN_GAME: return "unknown game";
+    case REPLAY_VERIFY_WRONG_GAME: return "replay of another game";
+    case REPLAY_VERIFY_INVALID: return "invalid replay";
+    case REPLAY_VERIFY_OVER_BUDGET: return "replay too long";
+    case REPLAY_VERIFY_NOT_OVER: return "game not over";
+    case REPLAY_VERIFY_SCORE: return "score does not match";
+    }
+    return "unknown";
+}
+
+void replay_check_free(struct replay_check* check) {
+    if (!check) return;
+    free(check->replay);
+    free(check);
+}
+
+static void free_list(struct replay_check* check) {
+    while (check) {
+        struct replay_check* next = check->next;
+        replay_check_free(check);
+        check = next;
+    }
+}
+
+void replay_verify_shutdown(void) {
+    pthread_mutex_lock(&pool_lock);
+    if (!worker_count) {
+        pthread_mutex_unlock(&pool_lock);
+        return;
+    }
+    pool_stopping = 1;
+    pthread_cond_broadcast(&pool_work);
+    pthread_mutex_unlock(&pool_lock);
+
+    for (int i = 0; i < worker_count; i++) pthread_join(workers[i], NULL);
+    pthread_mutex_lock(&pool_lock);
+    free(workers);
+    workers = NULL;
+    worker_count = 0;
+    free_list(queue_head);
+    free_list(done_head);
+    queue_head = queue_tail = done_head = done_tail = NULL;
+    queued = 0;
+    backlog = 0;
+    wake_fn = NULL;
+    pthread_mutex_unlock(&pool_lock);
+}
@@ -0,0 +1,298 @@
+#define _CRT_SECURE_NO_WARNINGS
+// Tetris versus referee (see versus_service.h).
+//
+// Like the ranking service it runs on the lws service thread and needs no
+// locking. A room holds at most one match of two players. The server keeps
+// a tetris_sim per player and feeds it the same inputs the opponent's
+// client gets, so both always agree on what the player's game looks like;
+// that is what makes attacks and top-outs checkable. Attacks a player
+// announces wait in the opponent's owed queue until a garbage input of the
+// opponent takes them in, which has to happen by VERSUS_CLOCK_SLACK_MS after
+// the attack on the opponent's game clock.
+//
+// A player's game clock has to stay within VERSUS_CLOCK_SLACK_MS of the
+// time since the match started, both ways: a game run slower than real time
+// would give its player more time to think. A player who stops reporting
+// falls behind as well, which messages to the room and
+// versus_service_expire notice.
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tetris_versus.h"
+#include "versus_service.h"
+
+#define OWED_ATTACKS 32
+#define MAX_INPUTS 256               // more than a TETRIS_VERSUS_MESSAGE can hold
+
+// An attack of the opponent, to be taken in by game time due_ms
+struct versus_owed {
+    struct tetris_attack attack;
+    int64_t due_ms;
+};
+
+struct versus_player {
+    char name[50];
+    char commitment[TETRIS_VERSUS_COMMITMENT];
+    gboolean ready;              // READY with a commitment
+    uint64_t nonce;
+    gboolean revealed;           // NONCE checked against the commitment
+    struct tetris_sim sim;
+    struct tetris_versus_stream stream;
+    int64_t upto_ms;
+    struct versus_owed owed[OWED_ATTACKS];       // the opponent's attacks not taken in yet
+    int owed_head;
+    int owed_count;
+};
+
+struct versus_match {
+    struct versus_player players[2];
+    int count;
+    gboolean running;
+    int64_t start_ms;
+    gboolean waiting;            // a READY came in and the match has not started
+    int64_t waiting_since_ms;
+};
+
+static GHashTable* matches = NULL;       // room -> versus_match
+
+static struct versus_player* find_player(struct versus_match* match, const char* user, gboolean join) {
+    for (int i = 0; i < match->count; i++) {
+        if (strcmp(match->players[i].name, user) == 0) return &match->players[i];
+    }
+    if (!join || match->count == 2) return NULL;
+    struct versus_player* player = &match->players[match->count++];
+    memset(player, 0, sizeof(*player));
+    g_strlcpy(player->name, user, sizeof(player->name));
+    return player;
+}
+
+static struct versus_player* opponent_of(struct versus_match* match, struct versus_player* player) {
+    if (match->count < 2) return NULL;
+    return player == &match->players[0] ? &match->players[1] : &match->players[0];
+}
+
+static void end_match(const char* room) {
+    g_hash_table_remove(matches, room);
+}
+
+static void announce_reject(const char* room, const char* user, const char* reason, versus_broadcast_fn broadcast) {
+    char message[160];
+    snprintf(message, sizeof(message), "VS REJECT %.49s %s", user, reason);
+    fprintf(stderr, "Versus match in room %s: %s\n", room, message);
+    if (broadcast) broadcast(room, message);
+}
+
+static enum versus_verdict reject(const char* room, const char* user, const char* reason, versus_broadcast_fn broadcast) {
+    announce_reject(room, user, reason, broadcast);
+    end_match(room);
+    return VERSUS_DROP;
+}
+
+// The loser topped out or gave up; the match ends
+static void award(const char* room, struct versus_match* match, struct versus_player* loser, versus_broadcast_fn broadcast) {
+    char message[80];
+    snprintf(message, sizeof(message), "VS RESULT %.49s", opponent_of(match, loser)->name);
+    if (broadcast) broadcast(room, message);
+    end_match(room);
+}
+
+static struct versus_match* new_match(const char* room) {
+    struct versus_match* match = g_new0(struct versus_match, 1);
+    g_hash_table_insert(matches, g_strdup(room), match);
+    return match;
+}
+
+// True, after telling the room, if the match waited too long for READYs;
+// the caller ends it
+static gboolean ready_expired(const char* room, struct versus_match* match, int64_t now_ms, versus_broadcast_fn broadcast) {
+    if (match->running || !match->waiting || now_ms - match->waiting_since_ms < VERSUS_READY_TIMEOUT_MS) return FALSE;
+    for (int i = 0; i < 2 && match->count == 2; i++) {
+        if (!match->players[i].ready || !match->players[i].revealed) {
+            announce_reject(room, match->players[i].name, "not ready in time", broadcast);
+            return TRUE;
+        }
+    }
+    announce_reject(room, match->count ? match->players[0].name : "-", "no opponent in time", broadcast);
+    return TRUE;
+}
+
+// A player still in the game whose clock lags the match's
+static struct versus_player* player_behind(struct versus_match* match, int64_t now_ms) {
+    if (!match->running) return NULL;
+    for (int i = 0; i < match->count; i++) {
+        struct versus_player* player = &match->players[i];
+        if (!player->sim.game.over && player->upto_ms < now_ms - match->start_ms - VERSUS_CLOCK_SLACK_MS) return player;
+    }
+    return NULL;
+}
+
+static void start_match(struct versus_match* match, int64_t now_ms) {
+    uint64_t seed = match->players[0].nonce ^ match->players[1].nonce;
+    for (int i = 0; i < 2; i++) {
+        struct versus_player* player = &match->players[i];
+        tetris_sim_init(&player->sim, seed);
+        player->stream.last_ms = 0;
+        player->upto_ms = 0;
+        player->owed_head = 0;
+        player->owed_count = 0;
+        player->ready = FALSE;
+        player->revealed = FALSE;
+    }
+    match->start_ms = now_ms;
+    match->running = TRUE;
+    match->waiting = FALSE;
+}
+
+static enum versus_verdict handle_inputs(const char* room, struct versus_match* match, struct versus_player* player,
+    const char* text, int64_t now_ms, versus_broadcast_fn broadcast) {
+    static struct tetris_input inputs[MAX_INPUTS];
+    int64_t upto;
+    int count = tetris_versus_decode(&player->stream, text, &upto, inputs, MAX_INPUTS);
+    if (count < 0) return reject(room, player->name, "malformed inputs", broadcast);
+    if (upto < player->upto_ms) return reject(room, player->name, "clock went back", broadcast);
+    if (upto > now_ms - match->start_ms + VERSUS_CLOCK_SLACK_MS) return reject(room, player->name, "clock ahead of the server", broadcast);
+
+    for (int i = 0; i < count; i++) {
+        if (inputs[i].key != TETRIS_INPUT_GARBAGE) continue;
+        struct versus_owed* owed = &player->owed[player->owed_head];
+        if (!player->owed_count || owed->attack.lines != inputs[i].lines || owed->attack.hole != inputs[i].hole) {
+            return reject(room, player->name, "garbage that was not sent", broadcast);
+        }
+        if (inputs[i].time_us > owed->due_ms * 1000) return reject(room, player->name, "garbage taken in late", broadcast);
+        player->owed_head = (player->owed_head + 1) % OWED_ATTACKS;
+        player->owed_count--;
+    }
+    if (!tetris_versus_feed(&player->sim, inputs, count, upto)) return reject(room, player->name, "inputs out of order", broadcast);
+    player->upto_ms = upto;
+    if (player->owed_count && upto > player->owed[player->owed_head].due_ms) {
+        return reject(room, player->name, "garbage not taken in", broadcast);
+    }
+    if (player_behind(match, now_ms) == player) return reject(room, player->name, "clock behind the server", broadcast);
+    return VERSUS_RELAY;
+}
+
+static enum versus_verdict handle_attack(const char* room, struct versus_match* match, struct versus_player* player,
+    const char* text, int64_t now_ms, versus_broadcast_fn broadcast) {
+    int lines, hole;
+    struct tetris_attack made;
+    if (sscanf(text, "%d %d", &lines, &hole) != 2 || !tetris_sim_take_attack(&player->sim, &made) ||
+        made.lines != lines || made.hole != hole) {
+        return reject(room, player->name, "attack without a clear", broadcast);
+    }
+
+    struct versus_player* opponent = opponent_of(match, player);
+    if (opponent->owed_count == OWED_ATTACKS) return reject(room, opponent->name, "garbage not taken in", broadcast);
+    struct versus_owed* owed = &opponent->owed[(opponent->owed_head + opponent->owed_count++) % OWED_ATTACKS];
+    owed->attack = made;
+    owed->due_ms = now_ms - match->start_ms + VERSUS_CLOCK_SLACK_MS;
+    return VERSUS_RELAY;
+}
+
+enum versus_verdict versus_service_message(const char* room, const char* user, const char* text, int64_t now_ms,
+    versus_broadcast_fn broadcast) {
+    if (strncmp(text, "VS ", 3) != 0) return VERSUS_NOT_MINE;
+    text += 3;
+    if (!matches) matches = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+
+    struct versus_match* match = (struct versus_match*)g_hash_table_lookup(matches, room);
+    if (match && ready_expired(room, match, now_ms, broadcast)) {
+        end_match(room);
+        match = NULL;
+    }
+    struct versus_player* behind = match ? player_behind(match, now_ms) : NULL;
+    if (behind) {
+        reject(room, behind->name, "clock behind the server", broadcast);
+        match = NULL;
+    }
+    if (strncmp(text, "READY ", 6) == 0) {
+        const char* commitment = text + 6;
+        if (strlen(commitment) != TETRIS_VERSUS_COMMITMENT - 1 || strspn(commitment, "0123456789abcdef") != TETRIS_VERSUS_COMMITMENT - 1) {
+            return VERSUS_DROP;
+        }
+        if (!match) match = new_match(room);
+        // Someone else in the room cannot stop the match
+        struct versus_player* player = find_player(match, user, TRUE);
+        if (!player) return VERSUS_DROP;
+        // A player who asks for a new match during one gives it up
+        if (match->running) {
+            award(room, match, player, broadcast);
+            match = new_match(room);
+            player = find_player(match, user, TRUE);
+        }
+        // A commitment stands until the match starts
+        if (player->ready) return VERSUS_DROP;
+        if (!match->waiting) {
+            match->waiting = TRUE;
+            match->waiting_since_ms = now_ms;
+        }
+        g_strlcpy(player->commitment, commitment, sizeof(player->commitment));
+        player->ready = TRUE;
+        return VERSUS_RELAY;
+    }
+
+    struct versus_player* player = match ? find_player(match, user, FALSE) : NULL;
+    if (strncmp(text, "NONCE ", 6) == 0) {
+        // Not before both are READY, or the other player could still pick the seed
+        unsigned long long nonce;
+        if (!player || match->running || match->count < 2 || !match->players[0].ready || !match->players[1].ready ||
+            player->revealed || sscanf(text + 6, "%16llx", &nonce) != 1) {
+            return VERSUS_DROP;
+        }
+        char commitment[TETRIS_VERSUS_COMMITMENT];
+        tetris_versus_commitment(nonce, commitment);
+        if (strcmp(commitment, player->commitment) != 0) return reject(room, player->name, "nonce does not match READY", broadcast);
+        player->nonce = nonce;
+        player->revealed = TRUE;
+        if (match->players[0].revealed && match->players[1].revealed) start_match(match, now_ms);
+        return VERSUS_RELAY;
+    }
+    if (strcmp(text, "LEAVE") == 0) {
+        // Leaving a running match gives it up too
+        if (player && match->running) award(room, match, player, broadcast);
+        else if (player) end_match(room);
+        return VERSUS_RELAY;
+    }
+    if (!player || !match->running) return VERSUS_DROP;
+
+    if (strncmp(text, "I ", 2) == 0) return handle_inputs(room, match, player, text + 2, now_ms, broadcast);
+    if (strncmp(text, "A ", 2) == 0) return handle_attack(room, match, player, text + 2, now_ms, broadcast);
+    if (strcmp(text, "OVER") == 0) {
+        if (!player->sim.game.over) return reject(room, player->name, "has not topped out", broadcast);
+        award(room, match, player, broadcast);
+        return VERSUS_RELAY;
+    }
+    return VERSUS_DROP;
+}
+
+void versus_service_leave(const char* room, const char* user) {
+    struct versus_match* match = matches ? (struct versus_match*)g_hash_table_lookup(matches, room) : NULL;
+    if (match && find_player(match, user, FALSE)) end_match(room);
+}
+
+struct expiry {
+    int64_t now_ms;
+    versus_broadcast_fn broadcast;
+};
+
+static gboolean expire_match(gpointer key, gpointer value, gpointer data) {
+    struct expiry* expiry = (struct expiry*)data;
+    struct versus_match* match = (struct versus_match*)value;
+    struct versus_player* behind = player_behind(match, expiry->now_ms);
+    if (behind) {
+        announce_reject((const char*)key, behind->name, "clock behind the server", expiry->broadcast);
+        return TRUE;
+    }
+    return ready_expired((const char*)key, match, expiry->now_ms, expiry->broadcast);
+}
+
+void versus_service_expire(int64_t now_ms, versus_broadcast_fn broadcast) {
+    struct expiry expiry = { now_ms, broadcast };
+    if (matches) g_hash_table_foreach_remove(matches, expire_match, &expiry);
+}
+
+void versus_service_shutdown(void) {
+    if (matches) g_hash_table_destroy(matches);
+    matches = NULL;
+}
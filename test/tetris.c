@@ -0,0 +1,322 @@
+// Tetris rules engine (see tetris.h)
+#include "tetris.h"
+
+#include <string.h>
+
+// Bit c of a box row is box column c; box row 0 is the bottom. The shapes
+// are the SRS spawn shapes turned clockwise about the box center (3x3 for
+// JLSTZ, 4x4 for I); O never moves.
+const uint16_t tetris_shapes[TETRIS_TYPES][4][4] = {
+    { { 0x0, 0x0, 0xF, 0x0 }, { 0x4, 0x4, 0x4, 0x4 }, { 0x0, 0xF, 0x0, 0x0 }, { 0x2, 0x2, 0x2, 0x2 } }, // I
+    { { 0x6, 0x6, 0x0, 0x0 }, { 0x6, 0x6, 0x0, 0x0 }, { 0x6, 0x6, 0x0, 0x0 }, { 0x6, 0x6, 0x0, 0x0 } }, // O
+    { { 0x0, 0x7, 0x2, 0x0 }, { 0x2, 0x6, 0x2, 0x0 }, { 0x2, 0x7, 0x0, 0x0 }, { 0x2, 0x3, 0x2, 0x0 } }, // T
+    { { 0x0, 0x3, 0x6, 0x0 }, { 0x4, 0x6, 0x2, 0x0 }, { 0x3, 0x6, 0x0, 0x0 }, { 0x2, 0x3, 0x1, 0x0 } }, // S
+    { { 0x0, 0x6, 0x3, 0x0 }, { 0x2, 0x6, 0x4, 0x0 }, { 0x6, 0x3, 0x0, 0x0 }, { 0x1, 0x3, 0x2, 0x0 } }, // Z
+    { { 0x0, 0x7, 0x1, 0x0 }, { 0x2, 0x2, 0x6, 0x0 }, { 0x4, 0x7, 0x0, 0x0 }, { 0x3, 0x2, 0x2, 0x0 } }, // J
+    { { 0x0, 0x7, 0x4, 0x0 }, { 0x6, 0x2, 0x2, 0x0 }, { 0x1, 0x7, 0x0, 0x0 }, { 0x2, 0x2, 0x3, 0x0 } }, // L
+};
+
+// SRS kick offsets (dx, dy with y up), tried in order. Row k of a table is
+// the clockwise turn out of state k; the counter-clockwise turn into state
+// k is the same row negated.
+static const int8_t kicks_jlstz[4][5][2] = {
+    { { 0, 0 }, { -1, 0 }, { -1, 1 }, { 0, -2 }, { -1, -2 } }, // 0 -> R
+    { { 0, 0 }, { 1, 0 }, { 1, -1 }, { 0, 2 }, { 1, 2 } },     // R -> 2
+    { { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, -2 }, { 1, -2 } },    // 2 -> L
+    { { 0, 0 }, { -1, 0 }, { -1, -1 }, { 0, 2 }, { -1, 2 } },  // L -> 0
+};
+
+static const int8_t kicks_i[4][5][2] = {
+    { { 0, 0 }, { -2, 0 }, { 1, 0 }, { -2, -1 }, { 1, 2 } },   // 0 -> R
+    { { 0, 0 }, { -1, 0 }, { 2, 0 }, { -1, 2 }, { 2, -1 } },   // R -> 2
+    { { 0, 0 }, { 2, 0 }, { -1, 0 }, { 2, 1 }, { -1, -2 } },   // 2 -> L
+    { { 0, 0 }, { 1, 0 }, { -2, 0 }, { 1, -2 }, { -2, 1 } },   // L -> 0
+};
+
+static const uint32_t line_points[5] = { 0, 100, 300, 500, 800 };
+static const uint32_t tspin_points[4] = { 400, 800, 1200, 1600 };
+
+// A box row shifted to the piece's column, or 0xFFFFFFFF if part of it is
+// left of the left wall. The bits above 15 are past the right wall.
+static inline uint32_t shifted_row(uint16_t mask, int x) {
+    int shift = x + TETRIS_WALL;
+    if (shift >= 0) return (uint32_t)mask << shift;
+    if (mask & ((1u << -shift) - 1)) return 0xFFFFFFFFu;
+    return (uint32_t)mask >> -shift;
+}
+
+void tetris_well_clear(struct tetris_well* well) {
+    for (int y = 0; y < TETRIS_HEIGHT; y++) well->rows[y] = TETRIS_EMPTY_ROW;
+}
+
+bool tetris_fits(const struct tetris_well* well, struct tetris_piece piece) {
+    const uint16_t* shape = tetris_shapes[piece.type][piece.rotation];
+    for (int r = 0; r < 4; r++) {
+        if (!shape[r]) continue;
+        int y = piece.y + r;
+        if (y < 0) return false;
+        uint32_t row = (y < TETRIS_HEIGHT ? well->rows[y] : TETRIS_EMPTY_ROW) | 0xFFFF0000u;
+        if (row & shifted_row(shape[r], piece.x)) return false;
+    }
+    return true;
+}
+
+int tetris_drop_distance(const struct tetris_well* well, struct tetris_piece piece) {
+    // Fall straight past the empty rows under the piece: with its lowest row
+    // above every filled row it cannot collide
+    const uint16_t* shape = tetris_shapes[piece.type][piece.rotation];
+    int bottom = 0;
+    while (!shape[bottom]) bottom++;
+    int top = piece.y + 3 < TETRIS_HEIGHT ? piece.y + 3 : TETRIS_HEIGHT - 1;
+    while (top >= 0 && well->rows[top] == TETRIS_EMPTY_ROW) top--;
+
+    int distance = 0;
+    if (piece.y + bottom > top + 1) {
+        distance = piece.y + bottom - (top + 1);
+        piece.y = (int8_t)(piece.y - distance);
+    }
+    for (;;) {
+        piece.y--;
+        if (!tetris_fits(well, piece)) return distance;
+        distance++;
+    }
+}
+
+int tetris_place(struct tetris_well* well, struct tetris_piece piece) {
+    const uint16_t* shape = tetris_shapes[piece.type][piece.rotation];
+    unsigned full = 0; // bit r: box row r became full
+    for (int r = 0; r < 4; r++) {
+        int y = piece.y + r;
+        if (!shape[r] || y < 0 || y >= TETRIS_HEIGHT) continue;
+        well->rows[y] |= (uint16_t)shifted_row(shape[r], piece.x);
+        if (well->rows[y] == TETRIS_FULL_ROW) full |= 1u << r;
+    }
+    if (!full) return 0;
+
+    // Top row first, so the lower indexes stay valid
+    for (int r = 3; r >= 0; r--) {
+        if (!(full & (1u << r))) continue;
+        int y = piece.y + r;
+        memmove(&well->rows[y], &well->rows[y + 1], (size_t)(TETRIS_HEIGHT - 1 - y) * sizeof(well->rows[0]));
+        well->rows[TETRIS_HEIGHT - 1] = TETRIS_EMPTY_ROW;
+    }
+    return tetris_popcount16((uint16_t)full);
+}
+
+struct tetris_piece tetris_spawn_piece(int type) {
+    // Bottom rows of the shapes sit at rows 20 and 21, columns 3 to 6
+    struct tetris_piece piece = { (int8_t)type, 0, 3, TETRIS_VISIBLE - 1 };
+    if (type == TETRIS_I) piece.y = TETRIS_VISIBLE - 2;
+    else if (type == TETRIS_O) piece.y = TETRIS_VISIBLE;
+    return piece;
+}
+
+bool tetris_rotate_piece(const struct tetris_well* well, struct tetris_piece* piece, int direction) {
+    int from = piece->rotation;
+    int to = (from + (direction > 0 ? 1 : 3)) & 3;
+    if (piece->type == TETRIS_O) {
+        piece->rotation = (int8_t)to;
+        return true;
+    }
+
+    const int8_t (*table)[5][2] = piece->type == TETRIS_I ? kicks_i : kicks_jlstz;
+    const int8_t (*kicks)[2] = table[direction > 0 ? from : to];
+    int sign = direction > 0 ? 1 : -1;
+    for (int k = 0; k < 5; k++) {
+        struct tetris_piece moved = *piece;
+        moved.rotation = (int8_t)to;
+        moved.x = (int8_t)(piece->x + sign * kicks[k][0]);
+        moved.y = (int8_t)(piece->y + sign * kicks[k][1]);
+        if (tetris_fits(well, moved)) {
+            *piece = moved;
+            return true;
+        }
+    }
+    return false;
+}
+
+static int next_from_bag(struct tetris* game) {
+    if (game->bag_left == 0) {
+        for (int i = 0; i < TETRIS_TYPES; i++) game->bag[i] = (uint8_t)i;
+        game->bag_left = TETRIS_TYPES;
+    }
+    int pick = (int)rng_below(&game->random, (uint32_t)game->bag_left);
+    int type = game->bag[pick];
+    game->bag[pick] = game->bag[--game->bag_left];
+    return type;
+}
+
+static void spawn(struct tetris* game, int type) {
+    game->piece = tetris_spawn_piece(type);
+    game->last_rotated = false;
+    if (!tetris_fits(&game->well, game->piece)) game->over = true;
+}
+
+static void spawn_next(struct tetris* game) {
+    int type = game->queue[0];
+    memmove(game->queue, game->queue + 1, TETRIS_PREVIEW - 1);
+    game->queue[TETRIS_PREVIEW - 1] = (uint8_t)next_from_bag(game);
+    game->hold_used = false;
+    game->pieces++;
+    spawn(game, type);
+}
+
+void tetris_init(struct tetris* game, uint64_t seed) {
+    memset(game, 0, sizeof(*game));
+    tetris_well_clear(&game->well);
+    rng_seed(&game->random, seed);
+    game->hold = -1;
+    game->level = 1;
+    for (int i = 0; i < TETRIS_PREVIEW; i++) game->queue[i] = (uint8_t)next_from_bag(game);
+    spawn_next(game);
+}
+
+bool tetris_shift(struct tetris* game, int dx) {
+    if (game->over) return false;
+    struct tetris_piece moved = game->piece;
+    moved.x = (int8_t)(moved.x + dx);
+    if (!tetris_fits(&game->well, moved)) return false;
+    game->piece = moved;
+    game->last_rotated = false;
+    return true;
+}
+
+bool tetris_rotate(struct tetris* game, int direction) {
+    if (game->over || !tetris_rotate_piece(&game->well, &game->piece, direction)) return false;
+    game->last_rotated = true;
+    return true;
+}
+
+bool tetris_soft_drop(struct tetris* game) {
+    if (game->over) return false;
+    struct tetris_piece moved = game->piece;
+    moved.y--;
+    if (!tetris_fits(&game->well, moved)) return false;
+    game->piece = moved;
+    game->last_rotated = false;
+    game->score++;
+    return true;
+}
+
+bool tetris_hold(struct tetris* game) {
+    if (game->over || game->hold_used) return false;
+    int type = game->piece.type;
+    if (game->hold < 0) {
+        game->hold = (int8_t)type;
+        spawn_next(game);
+        game->pieces--; // the same piece, just swapped out
+    }
+    else {
+        int held = game->hold;
+        game->hold = (int8_t)type;
+        spawn(game, held);
+    }
+    game->hold_used = true;
+    return true;
+}
+
+static bool blocked(const struct tetris_well* well, int x, int y) {
+    if (x < 0 || x >= TETRIS_WIDTH || y < 0) return true;
+    return y < TETRIS_HEIGHT && tetris_cell(well, x, y);
+}
+
+// Three-corner rule: a T that got into place by rotating, with at least
+// three of the four cells diagonal to its center filled
+static bool is_tspin(const struct tetris* game) {
+    const struct tetris_piece* p = &game->piece;
+    if (p->type != TETRIS_T || !game->last_rotated) return false;
+    int corners = blocked(&game->well, p->x, p->y) + blocked(&game->well, p->x + 2, p->y) +
+        blocked(&game->well, p->x, p->y + 2) + blocked(&game->well, p->x + 2, p->y + 2);
+    return corners >= 3;
+}
+
+struct tetris_lock tetris_lock_piece(struct tetris* game) {
+    struct tetris_lock result = { 0, false, 0 };
+    if (game->over) return result;
+
+    result.tspin = is_tspin(game);
+    int lowest = game->piece.y;
+    while (!tetris_shapes[game->piece.type][game->piece.rotation][lowest - game->piece.y]) lowest++;
+    result.lines = tetris_place(&game->well, game->piece);
+
+    result.points = (result.tspin ? tspin_points[result.lines] : line_points[result.lines]) * (uint32_t)game->level;
+    game->score += result.points;
+    game->lines += result.lines;
+    game->level = 1 + game->lines / 10;
+
+    // Lock out: nothing of the piece made it into the visible rows
+    if (lowest >= TETRIS_VISIBLE && result.lines == 0) {
+        game->over = true;
+        return result;
+    }
+    spawn_next(game);
+    return result;
+}
+
+struct tetris_lock tetris_hard_drop(struct tetris* game) {
+    if (!game->over) {
+        int distance = tetris_drop_distance(&game->well, game->piece);
+        if (distance > 0) {
+            game->piece.y = (int8_t)(game->piece.y - distance);
+            game->last_rotated = false;
+        }
+        game->score += 2 * (uint32_t)distance;
+    }
+    return tetris_lock_piece(game);
+}
+
+int tetris_attack_lines(struct tetris_lock lock) {
+    static const int attack[5] = { 0, 0, 1, 2, 4 };
+    if (lock.tspin) return 2 * lock.lines;
+    return attack[lock.lines];
+}
+
+bool tetris_add_garbage(struct tetris* game, int lines, int hole) {
+    if (game->over || lines <= 0) return !game->over;
+    if (lines > TETRIS_HEIGHT) lines = TETRIS_HEIGHT;
+    if (hole < 0 || hole >= TETRIS_WIDTH) hole = 0;
+    for (int y = TETRIS_HEIGHT - lines; y < TETRIS_HEIGHT; y++) {
+        if (game->well.rows[y] != TETRIS_EMPTY_ROW) game->over = true;
+    }
+    memmove(&game->well.rows[lines], &game->well.rows[0], (size_t)(TETRIS_HEIGHT - lines) * sizeof(game->well.rows[0]));
+    uint16_t row = (uint16_t)(TETRIS_FULL_ROW & ~(1u << (hole + TETRIS_WALL)));
+    for (int y = 0; y < lines; y++) game->well.rows[y] = row;
+
+    while (!tetris_fits(&game->well, game->piece) && game->piece.y + 4 < TETRIS_HEIGHT) game->piece.y++;
+    if (!tetris_fits(&game->well, game->piece)) game->over = true;
+    return !game->over;
+}
+
+bool tetris_landed(const struct tetris* game) {
+    struct tetris_piece below = game->piece;
+    below.y--;
+    return !tetris_fits(&game->well, below);
+}
+
+int tetris_ghost_y(const struct tetris* game) {
+    return game->piece.y - tetris_drop_distance(&game->well, game->piece);
+}
+
+// The curve truncated to microseconds. Computed once, not with pow() at run
+// time: libms may differ in the last bit, and levels 2 and 3 land exactly on
+// a whole microsecond, so versus peers and the replay verifier could
+// truncate differently.
+static const int64_t gravity_us[20] = {
+    1000000, 793000, 617796, 472729, 355196, 262003, 189677, 134734, 93882, 64151,
+    42976, 28217, 18153, 11439, 7058, 4263, 2520, 1457, 823, 455,
+};
+
+int64_t tetris_gravity_us(int level) {
+    if (level < 1) level = 1;
+    if (level > 20) level = 20;
+    return gravity_us[level - 1];
+}
+
+double tetris_gravity_seconds(int level) {
+    return tetris_gravity_us(level) / 1000000.0;
+}
+
+const char* tetris_type_name(int type) {
+    static const char* names[TETRIS_TYPES] = { "I", "O", "T", "S", "Z", "J", "L" };
+    return type >= 0 && type < TETRIS_TYPES ? names[type] : "?";
+}
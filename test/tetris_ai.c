@@ -0,0 +1,383 @@
+// Tetris placement search (see tetris_ai.h)
+#include "tetris_ai.h"
+#include "ai_pool.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define FIELD ((uint16_t)~TETRIS_EMPTY_ROW)
+// Bit i of row ^ (row >> 1) compares cells i and i + 1; these pairs run
+// from the left wall to the right wall
+#define TRANSITION_PAIRS (((1u << (TETRIS_WIDTH + 1)) - 1) << (TETRIS_WALL - 1))
+
+// BFS state space: x + TETRIS_WALL in 0..15, y + 3 in 0..TETRIS_HEIGHT + 3
+// (a box may hang below row 0 by its empty rows), rotation, and for T
+// whether the last action was a rotation
+#define STATE_X 16
+#define STATE_Y (TETRIS_HEIGHT + 4)
+#define STATES (4 * STATE_Y * STATE_X * 2)
+#define FINAL_SLOTS 512
+#define LOST_VALUE -1e9
+
+const struct tetris_ai_weights tetris_ai_default_weights = {
+    .aggregate_height = -0.51,
+    .max_height = -0.05,
+    .holes = -0.36,
+    .hole_rows = -0.30,
+    .bumpiness = -0.18,
+    .wells = -0.04,
+    .row_transitions = -0.06,
+    .column_transitions = -0.10,
+    .lines = 0.76,
+    .tetris = 1.5,
+    .tspin = 1.2,
+};
+
+struct node {
+    struct tetris_piece piece;
+    uint16_t parent;
+    uint8_t action;
+    uint8_t spin;
+};
+
+// Scratch space of one search thread, too large for its stack
+struct bfs {
+    uint8_t visited[STATES];
+    struct node nodes[STATES];
+    int16_t finals[FINAL_SLOTS];     // hash of placed cells -> index in out
+    uint64_t final_keys[TETRIS_AI_MAX_PLACEMENTS];
+    struct tetris_placement seconds[TETRIS_AI_MAX_PLACEMENTS];  // lookahead placements
+};
+
+struct search {
+    volatile int* cancel;
+    const struct tetris_ai_weights* weights;
+};
+
+// One first-level placement, scored by the best placement of next_type
+struct job {
+    struct tetris_placement* placement;
+    struct tetris_well well;         // before the placement
+    int next_type;                   // -1 for no lookahead
+    struct search* search;
+    long long placements;
+};
+
+// Each worker's scratch is a struct bfs
+static void* bfs_new(void);
+static void bfs_free(void* bfs);
+static void run_pool_job(void* bfs, void* job);
+
+static struct ai_pool pool = AI_POOL_INIT(TETRIS_AI_WORKERS, bfs_new, bfs_free, run_pool_job);
+
+static int bottom_row(struct tetris_piece piece) {
+    const uint16_t* shape = tetris_shapes[piece.type][piece.rotation];
+    int bottom = 0;
+    while (!shape[bottom]) bottom++;
+    return bottom;
+}
+
+static int state_index(struct tetris_piece piece, int spin) {
+    return (((piece.rotation * STATE_Y) + piece.y + 3) * STATE_X + piece.x + TETRIS_WALL) * 2 + spin;
+}
+
+// The cells a final position fills, independent of which rotation and box
+// offset put them there
+static uint64_t placed_key(struct tetris_piece piece, int spin) {
+    const uint16_t* shape = tetris_shapes[piece.type][piece.rotation];
+    int bottom = bottom_row(piece);
+    uint64_t key = 0;
+    for (int r = bottom; r < 4; r++) {
+        uint64_t row = (uint64_t)shape[r] << (piece.x + TETRIS_WALL);
+        key |= row << (16 * (r - bottom));
+    }
+    return key ^ ((uint64_t)(piece.y + bottom) << 58) ^ ((uint64_t)spin << 57);
+}
+
+static int add_final(struct bfs* bfs, const struct node* node, int index, struct tetris_placement* out, int count, int max) {
+    uint64_t key = placed_key(node->piece, node->spin);
+    unsigned slot = (unsigned)((key * 0x9E3779B97F4A7C15ull) >> 55) & (FINAL_SLOTS - 1);
+    while (bfs->finals[slot] >= 0) {
+        if (bfs->final_keys[bfs->finals[slot]] == key) return count;
+        slot = (slot + 1) & (FINAL_SLOTS - 1);
+    }
+    if (count >= max) return count;
+
+    // Walk back to the start for the key sequence; a drop node may stand
+    // for several rows
+    uint8_t reversed[TETRIS_AI_MAX_PATH];
+    int length = 0;
+    for (int i = index; i != 0 && length < TETRIS_AI_MAX_PATH - 1; i = bfs->nodes[i].parent) {
+        const struct node* step = &bfs->nodes[i];
+        int repeat = step->action == TETRIS_ACTION_DOWN ? bfs->nodes[step->parent].piece.y - step->piece.y : 1;
+        for (int k = 0; k < repeat && length < TETRIS_AI_MAX_PATH - 1; k++) reversed[length++] = step->action;
+    }
+    if (length >= TETRIS_AI_MAX_PATH - 2) return count;
+
+    struct tetris_placement* placement = &out[count];
+    memset(placement, 0, sizeof(*placement));
+    placement->piece = node->piece;
+    placement->tspin = node->spin != 0;
+    for (int i = 0; i < length; i++) placement->path[i] = reversed[length - 1 - i];
+    placement->path[length] = TETRIS_ACTION_DROP;
+    placement->path_length = length + 1;
+
+    bfs->finals[slot] = (int16_t)count;
+    bfs->final_keys[count] = key;
+    return count + 1;
+}
+
+static int enumerate(struct bfs* bfs, const struct tetris_well* well, struct tetris_piece start, struct tetris_placement* out, int max) {
+    if (!tetris_fits(well, start)) return 0;
+    memset(bfs->visited, 0, sizeof(bfs->visited));
+    memset(bfs->finals, 0xFF, sizeof(bfs->finals));
+
+    // Rows from free up are empty, and positions in them differ only by
+    // height: a drop there goes straight down to row free, so the search
+    // only walks the rows near the stack
+    int free = TETRIS_HEIGHT;
+    while (free > 0 && well->rows[free - 1] == TETRIS_EMPTY_ROW) free--;
+
+    int head = 0;
+    int tail = 0;
+    int count = 0;
+    bfs->nodes[tail++] = (struct node){ start, 0, 0, 0 };
+    bfs->visited[state_index(start, 0)] = 1;
+    while (head < tail) {
+        int index = head++;
+        struct node node = bfs->nodes[index];
+
+        struct tetris_piece below = node.piece;
+        below.y--;
+        if (!tetris_fits(well, below)) count = add_final(bfs, &node, index, out, count, max);
+
+        for (int action = TETRIS_ACTION_LEFT; action <= TETRIS_ACTION_DOWN; action++) {
+            struct tetris_piece next = node.piece;
+            switch (action) {
+            case TETRIS_ACTION_LEFT: next.x--; break;
+            case TETRIS_ACTION_RIGHT: next.x++; break;
+            case TETRIS_ACTION_CW: if (!tetris_rotate_piece(well, &next, 1)) continue; break;
+            case TETRIS_ACTION_CCW: if (!tetris_rotate_piece(well, &next, -1)) continue; break;
+            default:
+                if (next.y + bottom_row(next) > free) next.y = (int8_t)(free - bottom_row(next));
+                else next.y--;
+                break;
+            }
+            if (action == TETRIS_ACTION_LEFT || action == TETRIS_ACTION_RIGHT || action == TETRIS_ACTION_DOWN) {
+                if (!tetris_fits(well, next)) continue;
+            }
+            if (next.y + 3 >= STATE_Y) continue; // kicked up out of the well
+            int spin = next.type == TETRIS_T && (action == TETRIS_ACTION_CW || action == TETRIS_ACTION_CCW);
+            int state = state_index(next, spin);
+            if (bfs->visited[state]) continue;
+            bfs->visited[state] = 1;
+            bfs->nodes[tail++] = (struct node){ next, (uint16_t)index, (uint8_t)action, (uint8_t)spin };
+        }
+    }
+    return count;
+}
+
+int tetris_ai_placements(const struct tetris_well* well, struct tetris_piece piece, struct tetris_placement* out, int max) {
+    struct bfs* bfs = (struct bfs*)malloc(sizeof(*bfs));
+    if (!bfs) return 0;
+    int count = enumerate(bfs, well, piece, out, max);
+    free(bfs);
+    return count;
+}
+
+// Three-corner rule on the final position (see tetris.c)
+static bool corner_blocked(const struct tetris_well* well, int x, int y) {
+    if (x < 0 || x >= TETRIS_WIDTH || y < 0) return true;
+    return y < TETRIS_HEIGHT && tetris_cell(well, x, y);
+}
+
+static bool is_tspin(const struct tetris_well* well, const struct tetris_placement* placement) {
+    if (!placement->tspin) return false;
+    int x = placement->piece.x;
+    int y = placement->piece.y;
+    return corner_blocked(well, x, y) + corner_blocked(well, x + 2, y) +
+        corner_blocked(well, x, y + 2) + corner_blocked(well, x + 2, y + 2) >= 3;
+}
+
+double tetris_ai_evaluate(const struct tetris_well* well, const struct tetris_ai_weights* weights, int lines, bool tspin) {
+    int top = TETRIS_HEIGHT - 1;
+    while (top >= 0 && well->rows[top] == TETRIS_EMPTY_ROW) top--;
+
+    // Top down: a column's height is the row its first filled cell shows
+    // up in; an empty cell under a covered column is a hole
+    int heights[TETRIS_WIDTH] = { 0 };
+    uint16_t covered = 0;
+    int holes = 0;
+    int hole_rows = 0;
+    for (int y = top; y >= 0; y--) {
+        uint16_t row = well->rows[y] & FIELD;
+        uint16_t fresh = row & ~covered;
+        if (fresh) {
+            for (int c = 0; c < TETRIS_WIDTH; c++) {
+                if ((fresh >> (c + TETRIS_WALL)) & 1) heights[c] = y + 1;
+            }
+        }
+        uint16_t hole = (uint16_t)(~row & covered & FIELD);
+        holes += tetris_popcount16(hole);
+        hole_rows += hole != 0;
+        covered |= row;
+    }
+
+    int row_transitions = 0;
+    int column_transitions = 0;
+    uint16_t below = TETRIS_FULL_ROW; // the floor
+    for (int y = 0; y <= top + 1 && y < TETRIS_HEIGHT; y++) {
+        uint16_t row = well->rows[y];
+        row_transitions += tetris_popcount16((uint16_t)((row ^ (row >> 1)) & TRANSITION_PAIRS));
+        column_transitions += tetris_popcount16((uint16_t)((row ^ below) & FIELD));
+        below = row;
+    }
+
+    int aggregate = 0;
+    int max_height = 0;
+    int bumpiness = 0;
+    int wells = 0;
+    for (int c = 0; c < TETRIS_WIDTH; c++) {
+        aggregate += heights[c];
+        if (heights[c] > max_height) max_height = heights[c];
+        if (c > 0) bumpiness += heights[c] > heights[c - 1] ? heights[c] - heights[c - 1] : heights[c - 1] - heights[c];
+        int left = c > 0 ? heights[c - 1] : TETRIS_HEIGHT;
+        int right = c < TETRIS_WIDTH - 1 ? heights[c + 1] : TETRIS_HEIGHT;
+        int depth = (left < right ? left : right) - heights[c];
+        if (depth > 0) wells += depth * (depth + 1) / 2;
+    }
+
+    return weights->aggregate_height * aggregate + weights->max_height * max_height + weights->holes * holes +
+        weights->hole_rows * hole_rows + weights->bumpiness * bumpiness + weights->wells * wells +
+        weights->row_transitions * row_transitions + weights->column_transitions * column_transitions +
+        weights->lines * lines + (lines == 4 ? weights->tetris : 0) + (tspin ? weights->tspin * lines : 0);
+}
+
+// Place on a copy of the well; returns false if the piece locked out
+static bool place(struct tetris_well* well, struct tetris_placement* placement) {
+    placement->tspin = is_tspin(well, placement);
+    const uint16_t* shape = tetris_shapes[placement->piece.type][placement->piece.rotation];
+    int bottom = 0;
+    while (!shape[bottom]) bottom++;
+    placement->lines = tetris_place(well, placement->piece);
+    return placement->piece.y + bottom < TETRIS_VISIBLE || placement->lines > 0;
+}
+
+static double line_reward(const struct tetris_ai_weights* weights, const struct tetris_placement* placement) {
+    return weights->lines * placement->lines + (placement->lines == 4 ? weights->tetris : 0) +
+        (placement->tspin ? weights->tspin * placement->lines : 0);
+}
+
+static void run_job(struct bfs* bfs, struct job* job) {
+    const struct tetris_ai_weights* weights = job->search->weights;
+    struct tetris_placement* placement = job->placement;
+    struct tetris_well well = job->well;
+    job->placements = 1;
+    if (!place(&well, placement)) {
+        placement->value = LOST_VALUE;
+        return;
+    }
+    if (job->next_type < 0) {
+        placement->value = tetris_ai_evaluate(&well, weights, placement->lines, placement->tspin);
+        return;
+    }
+
+    struct tetris_placement* seconds = bfs->seconds;
+    int count = enumerate(bfs, &well, tetris_spawn_piece(job->next_type), seconds, TETRIS_AI_MAX_PLACEMENTS);
+    double best = LOST_VALUE;
+    for (int i = 0; i < count; i++) {
+        struct tetris_well after = well;
+        if (!place(&after, &seconds[i])) continue;
+        double value = tetris_ai_evaluate(&after, weights, seconds[i].lines, seconds[i].tspin);
+        if (value > best) best = value;
+    }
+    job->placements += count;
+    placement->value = best + line_reward(weights, placement);
+}
+
+static void* bfs_new(void) {
+    return malloc(sizeof(struct bfs));
+}
+
+static void bfs_free(void* bfs) {
+    free(bfs);
+}
+
+static void run_pool_job(void* bfs, void* arg) {
+    struct job* job = (struct job*)arg;
+    volatile int* cancel = job->search->cancel;
+    if (!ai_pool_stopping(&pool) && !(cancel && *cancel)) run_job((struct bfs*)bfs, job);
+    else job->placement->value = LOST_VALUE;
+}
+
+bool tetris_ai_search(const struct tetris* game, const struct tetris_ai_weights* weights, bool lookahead,
+    volatile int* cancel, struct tetris_ai_result* result) {
+    memset(result, 0, sizeof(*result));
+    if (game->over) return false;
+    long long start = ai_monotonic_us();
+
+    struct search search;
+    memset(&search, 0, sizeof(search));
+    search.cancel = cancel;
+    search.weights = weights ? weights : &tetris_ai_default_weights;
+
+    // The piece each option plays and the piece that comes after it
+    struct tetris_placement* placements = (struct tetris_placement*)malloc(2 * TETRIS_AI_MAX_PLACEMENTS * sizeof(*placements));
+    struct job* jobs = (struct job*)calloc(2 * TETRIS_AI_MAX_PLACEMENTS, sizeof(*jobs));
+    struct bfs* bfs = (struct bfs*)malloc(sizeof(*bfs));
+    if (!placements || !jobs || !bfs) {
+        free(placements);
+        free(jobs);
+        free(bfs);
+        return false;
+    }
+
+    int count = enumerate(bfs, &game->well, game->piece, placements, TETRIS_AI_MAX_PLACEMENTS);
+    int current_count = count;
+    int held_type = game->hold >= 0 ? game->hold : game->queue[0];
+    if (!game->hold_used && held_type != game->piece.type) {
+        count += enumerate(bfs, &game->well, tetris_spawn_piece(held_type), placements + count, TETRIS_AI_MAX_PLACEMENTS);
+    }
+
+    for (int i = 0; i < count; i++) {
+        bool hold = i >= current_count;
+        struct tetris_placement* placement = &placements[i];
+        placement->use_hold = hold;
+        if (hold) {
+            memmove(placement->path + 1, placement->path, (size_t)placement->path_length);
+            placement->path[0] = TETRIS_ACTION_HOLD;
+            placement->path_length++;
+        }
+        jobs[i].placement = placement;
+        jobs[i].well = game->well;
+        jobs[i].search = &search;
+        jobs[i].next_type = !lookahead ? -1 : (hold && game->hold < 0) ? game->queue[1] : game->queue[0];
+    }
+
+    if (lookahead) {
+        if (ai_pool_run(&pool, jobs, sizeof(jobs[0]), count) != 0) count = 0;
+    }
+    else {
+        for (int i = 0; i < count; i++) run_job(bfs, &jobs[i]);
+    }
+
+    for (int i = 0; i < count; i++) {
+        result->placements += jobs[i].placements;
+        if (!result->found || placements[i].value > result->best.value) {
+            result->best = placements[i];
+            result->found = true;
+        }
+    }
+    if (cancel && *cancel) result->found = false;
+
+    result->elapsed_us = ai_monotonic_us() - start;
+    if (result->elapsed_us > 0) result->placements_per_second = result->placements * 1e6 / result->elapsed_us;
+    free(placements);
+    free(jobs);
+    free(bfs);
+    return result->found;
+}
+
+void tetris_ai_shutdown(void) {
+    ai_pool_shutdown(&pool);
+}
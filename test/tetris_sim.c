@@ -0,0 +1,228 @@
+// Fixed-step Tetris simulation (see tetris_sim.h)
+#include "tetris_sim.h"
+
+#include <string.h>
+
+static int64_t gravity_us(const struct tetris_sim* sim) {
+    return tetris_gravity_us(sim->game.level);
+}
+
+static int64_t soft_drop_us(const struct tetris_sim* sim) {
+    int64_t interval = gravity_us(sim) / TETRIS_SIM_SOFT_DROP_FACTOR;
+    return interval < TETRIS_SIM_STEP_US ? TETRIS_SIM_STEP_US : interval;
+}
+
+void tetris_sim_init(struct tetris_sim* sim, uint64_t seed) {
+    memset(sim, 0, sizeof(*sim));
+    tetris_init(&sim->game, seed);
+    sim->gravity = true;
+    sim->das_us = TETRIS_SIM_DAS_MS * 1000;
+    sim->arr_us = TETRIS_SIM_ARR_MS * 1000;
+    // Its own stream, so garbage does not change the piece order
+    rng_seed(&sim->garbage_random, seed ^ 0xD1B54A32D192ED03ull);
+}
+
+void tetris_sim_set_gravity(struct tetris_sim* sim, bool gravity) {
+    if (gravity && !sim->gravity) {
+        sim->last_fall = sim->now_us;
+        sim->locking = false;
+    }
+    sim->gravity = gravity;
+}
+
+bool tetris_sim_input(struct tetris_sim* sim, struct tetris_input* input) {
+    if (sim->queue_count == TETRIS_SIM_QUEUE) return false;
+    if (input->key >= TETRIS_KEYS && input->key != TETRIS_INPUT_GARBAGE) return false;
+    if (input->time_us <= sim->now_us) {
+        input->time_us = sim->now_us + 1;
+        sim->late_inputs++;
+    }
+    if (input->time_us < sim->last_input_us) input->time_us = sim->last_input_us;
+    sim->last_input_us = input->time_us;
+    sim->queue[(sim->queue_head + sim->queue_count++) % TETRIS_SIM_QUEUE] = *input;
+    return true;
+}
+
+// A new piece: the fall timer starts over and the lock delay is off
+static void new_piece(struct tetris_sim* sim, int64_t now) {
+    sim->last_fall = now;
+    sim->locking = false;
+    sim->lock_resets = 0;
+}
+
+bool tetris_sim_take_attack(struct tetris_sim* sim, struct tetris_attack* attack) {
+    if (!sim->attack_count) return false;
+    *attack = sim->attacks[sim->attack_head];
+    sim->attack_head = (sim->attack_head + 1) % TETRIS_SIM_ATTACKS;
+    sim->attack_count--;
+    return true;
+}
+
+static void queue_garbage(struct tetris_sim* sim, int lines, int hole) {
+    if (lines <= 0) return;
+    if (sim->pending_count == TETRIS_SIM_PENDING) {
+        sim->pending_lines[TETRIS_SIM_PENDING - 1] = (uint8_t)(sim->pending_lines[TETRIS_SIM_PENDING - 1] + lines);
+    }
+    else {
+        sim->pending_lines[sim->pending_count] = (uint8_t)lines;
+        sim->pending_holes[sim->pending_count++] = (uint8_t)hole;
+    }
+    sim->pending_total += lines;
+}
+
+// Cancel up to lines of the oldest pending garbage; returns what is left
+static int cancel_garbage(struct tetris_sim* sim, int lines) {
+    while (lines > 0 && sim->pending_count) {
+        int cancelled = lines < sim->pending_lines[0] ? lines : sim->pending_lines[0];
+        lines -= cancelled;
+        sim->pending_total -= cancelled;
+        sim->pending_lines[0] = (uint8_t)(sim->pending_lines[0] - cancelled);
+        if (sim->pending_lines[0] == 0) {
+            memmove(sim->pending_lines, sim->pending_lines + 1, (size_t)--sim->pending_count);
+            memmove(sim->pending_holes, sim->pending_holes + 1, (size_t)sim->pending_count);
+        }
+    }
+    return lines;
+}
+
+static uint32_t next_hole(struct tetris_sim* sim) {
+    return rng_below(&sim->garbage_random, TETRIS_WIDTH);
+}
+
+// After a lock: clears fight the pending garbage and attack with the rest,
+// a lock that clears nothing lets the garbage in under the next piece
+static void locked(struct tetris_sim* sim, struct tetris_lock lock, int64_t now) {
+    sim->locks++;
+    int attack = cancel_garbage(sim, tetris_attack_lines(lock));
+    if (attack > 0 && sim->attack_count < TETRIS_SIM_ATTACKS) {
+        struct tetris_attack* out = &sim->attacks[(sim->attack_head + sim->attack_count++) % TETRIS_SIM_ATTACKS];
+        out->time_us = now;
+        out->lines = (uint8_t)attack;
+        out->hole = (uint8_t)next_hole(sim);
+        sim->lines_sent += (uint32_t)attack;
+    }
+    if (lock.lines == 0) {
+        for (int i = 0; i < sim->pending_count && !sim->game.over; i++) {
+            tetris_add_garbage(&sim->game, sim->pending_lines[i], sim->pending_holes[i]);
+            sim->lines_received += sim->pending_lines[i];
+        }
+        sim->pending_count = 0;
+        sim->pending_total = 0;
+    }
+    new_piece(sim, now);
+}
+
+// A move or rotation of a landed piece restarts the lock delay, a limited
+// number of times per piece so it cannot stall forever
+static void moved(struct tetris_sim* sim, int64_t now) {
+    if (sim->locking && sim->lock_resets < TETRIS_LOCK_RESETS) {
+        sim->lock_since = now;
+        sim->lock_resets++;
+    }
+}
+
+static void shift(struct tetris_sim* sim, int64_t now, bool to_wall) {
+    bool any = false;
+    while (tetris_shift(&sim->game, sim->shift_direction)) {
+        any = true;
+        if (!to_wall) break;
+    }
+    if (any) moved(sim, now);
+}
+
+static void soft_drop(struct tetris_sim* sim, int64_t now) {
+    if (tetris_soft_drop(&sim->game)) sim->last_fall = now;
+}
+
+static void apply_input(struct tetris_sim* sim, const struct tetris_input* input, int64_t now) {
+    int key = input->key;
+    if (key == TETRIS_INPUT_GARBAGE) {
+        queue_garbage(sim, input->lines, input->hole);
+        return;
+    }
+    if (!input->pressed) {
+        sim->held[key] = false;
+        // Releasing one direction hands auto-shift to the other if it is held
+        if ((key == TETRIS_KEY_LEFT && sim->shift_direction < 0) || (key == TETRIS_KEY_RIGHT && sim->shift_direction > 0)) {
+            int other = key == TETRIS_KEY_LEFT ? TETRIS_KEY_RIGHT : TETRIS_KEY_LEFT;
+            sim->shift_direction = sim->held[other] ? -sim->shift_direction : 0;
+            sim->shift_at = now + sim->das_us;
+        }
+        return;
+    }
+    if (sim->held[key]) return;
+    sim->held[key] = true;
+
+    switch (key) {
+    case TETRIS_KEY_LEFT:
+    case TETRIS_KEY_RIGHT:
+        // The last direction pressed wins
+        sim->shift_direction = key == TETRIS_KEY_LEFT ? -1 : 1;
+        sim->shift_at = now + sim->das_us;
+        shift(sim, now, false);
+        break;
+    case TETRIS_KEY_CW:
+    case TETRIS_KEY_CCW:
+        if (tetris_rotate(&sim->game, key == TETRIS_KEY_CW ? 1 : -1)) moved(sim, now);
+        break;
+    case TETRIS_KEY_SOFT_DROP:
+        soft_drop(sim, now);
+        sim->soft_drop_at = now + soft_drop_us(sim);
+        break;
+    case TETRIS_KEY_HARD_DROP:
+        locked(sim, tetris_hard_drop(&sim->game), now);
+        break;
+    case TETRIS_KEY_HOLD:
+        if (tetris_hold(&sim->game)) {
+            sim->holds++;
+            new_piece(sim, now);
+        }
+        break;
+    }
+}
+
+static void step(struct tetris_sim* sim, int64_t now) {
+    while (sim->queue_count && sim->queue[sim->queue_head].time_us <= now) {
+        struct tetris_input input = sim->queue[sim->queue_head];
+        sim->queue_head = (sim->queue_head + 1) % TETRIS_SIM_QUEUE;
+        sim->queue_count--;
+        apply_input(sim, &input, now);
+        if (sim->game.over) return;
+    }
+
+    if (sim->shift_direction && now >= sim->shift_at) {
+        shift(sim, now, sim->arr_us == 0);
+        sim->shift_at += sim->arr_us ? sim->arr_us : TETRIS_SIM_STEP_US;
+    }
+    if (sim->held[TETRIS_KEY_SOFT_DROP] && now >= sim->soft_drop_at) {
+        soft_drop(sim, now);
+        sim->soft_drop_at += soft_drop_us(sim);
+    }
+    if (!sim->gravity) return;
+
+    int64_t fall = gravity_us(sim);
+    while (now - sim->last_fall >= fall && !tetris_landed(&sim->game)) {
+        sim->game.piece.y--;
+        sim->game.last_rotated = false;
+        sim->last_fall += fall;
+    }
+
+    if (!tetris_landed(&sim->game)) {
+        sim->locking = false;
+    }
+    else if (!sim->locking) {
+        sim->locking = true;
+        sim->lock_since = now;
+        sim->last_fall = now;
+    }
+    else if (now - sim->lock_since >= (int64_t)TETRIS_LOCK_DELAY_MS * 1000) {
+        locked(sim, tetris_lock_piece(&sim->game), now);
+    }
+}
+
+void tetris_sim_advance(struct tetris_sim* sim, int64_t until_us) {
+    while (!sim->game.over && sim->now_us + TETRIS_SIM_STEP_US <= until_us) {
+        sim->now_us += TETRIS_SIM_STEP_US;
+        step(sim, sim->now_us);
+    }
+}
@@ -0,0 +1,139 @@
+// Head-to-head Tetris wire format (see tetris_versus.h)
+#include "tetris_versus.h"
+
+#include <glib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_DELTA_MS 3600000         // an hour without input means the stream is broken
+
+static int64_t time_ms(const struct tetris_input* input) {
+    return (input->time_us + 999) / 1000;
+}
+
+int tetris_versus_encode(struct tetris_versus_stream* stream, const struct tetris_input* inputs, int count,
+    int64_t upto_ms, char* out, size_t size) {
+    int length = snprintf(out, size, "VS I %lld ", (long long)upto_ms);
+    if (length < 0 || (size_t)length >= size) return -1;
+
+    int64_t last = stream->last_ms;
+    for (int i = 0; i < count; i++) {
+        const struct tetris_input* input = &inputs[i];
+        int64_t ms = time_ms(input);
+        int written;
+        if (input->key == TETRIS_INPUT_GARBAGE) {
+            written = snprintf(out + length, size - (size_t)length, "z%lld/%d/%d", (long long)(ms - last), input->lines, input->hole);
+        }
+        else {
+            char letter = (char)((input->pressed ? 'a' : 'A') + input->key);
+            written = snprintf(out + length, size - (size_t)length, "%c%lld", letter, (long long)(ms - last));
+        }
+        if (written < 0 || (size_t)(length + written) >= size) return -1;
+        length += written;
+        last = ms;
+    }
+    stream->last_ms = last;
+    return length;
+}
+
+// Digits at *p; false if there are none or the number is too large
+static bool read_number(const char** p, int64_t limit, int64_t* value) {
+    const char* s = *p;
+    int64_t n = 0;
+    if (*s < '0' || *s > '9') return false;
+    while (*s >= '0' && *s <= '9') {
+        n = n * 10 + (*s++ - '0');
+        if (n > limit) return false;
+    }
+    *p = s;
+    *value = n;
+    return true;
+}
+
+int tetris_versus_decode(struct tetris_versus_stream* stream, const char* text, int64_t* upto_ms,
+    struct tetris_input* out, int max) {
+    const char* p = text;
+    int64_t upto;
+    if (!read_number(&p, INT64_MAX / 1000 / 10, &upto)) return -1;
+    while (*p == ' ') p++;
+
+    int64_t last = stream->last_ms;
+    int count = 0;
+    while (*p) {
+        char letter = *p++;
+        struct tetris_input input = { 0, 0, false, 0, 0 };
+        if (letter == 'z') {
+            input.key = TETRIS_INPUT_GARBAGE;
+        }
+        else if (letter >= 'a' && letter < 'a' + TETRIS_KEYS) {
+            input.key = (uint8_t)(letter - 'a');
+            input.pressed = true;
+        }
+        else if (letter >= 'A' && letter < 'A' + TETRIS_KEYS) {
+            input.key = (uint8_t)(letter - 'A');
+        }
+        else {
+            return -1;
+        }
+
+        int64_t delta;
+        if (!read_number(&p, MAX_DELTA_MS, &delta)) return -1;
+        if (input.key == TETRIS_INPUT_GARBAGE) {
+            int64_t lines, hole;
+            if (*p++ != '/' || !read_number(&p, TETRIS_HEIGHT, &lines) || *p++ != '/' ||
+                !read_number(&p, TETRIS_WIDTH - 1, &hole) || lines == 0) return -1;
+            input.lines = (uint8_t)lines;
+            input.hole = (uint8_t)hole;
+        }
+        if (count == max) return -1;
+        last += delta;
+        input.time_us = last * 1000;
+        out[count++] = input;
+    }
+
+    stream->last_ms = last;
+    *upto_ms = upto;
+    return count;
+}
+
+bool tetris_versus_feed(struct tetris_sim* sim, const struct tetris_input* inputs, int count, int64_t upto_ms) {
+    int64_t upto = upto_ms * 1000;
+    for (int i = 0; i < count; i++) {
+        // Run up to the input's step first so the queue stays short
+        int64_t before = inputs[i].time_us - TETRIS_SIM_STEP_US;
+        tetris_sim_advance(sim, before < upto ? before : upto);
+        if (inputs[i].time_us <= sim->now_us) return false;
+        struct tetris_input input = inputs[i];
+        if (!tetris_sim_input(sim, &input)) return false;
+    }
+    tetris_sim_advance(sim, upto);
+    return true;
+}
+
+void tetris_versus_commitment(uint64_t nonce, char out[TETRIS_VERSUS_COMMITMENT]) {
+    char text[17];
+    snprintf(text, sizeof(text), "%016llx", (unsigned long long)nonce);
+    char* digest = g_compute_checksum_for_string(G_CHECKSUM_SHA256, text, -1);
+    g_strlcpy(out, digest ? digest : "", TETRIS_VERSUS_COMMITMENT);
+    g_free(digest);
+}
+
+bool tetris_versus_split(const char* message, char* room, size_t room_size, char* user, size_t user_size, const char** text) {
+    if (message[0] != '[') return false;
+    const char* room_end = strchr(message, ']');
+    if (!room_end || room_end[1] != ' ') return false;
+    const char* user_start = room_end + 2;
+    const char* user_end = strstr(user_start, ": ");
+    if (!user_end) return false;
+
+    size_t length = (size_t)(room_end - message - 1);
+    if (length >= room_size) length = room_size - 1;
+    memcpy(room, message + 1, length);
+    room[length] = '\0';
+    length = (size_t)(user_end - user_start);
+    if (length >= user_size) length = user_size - 1;
+    memcpy(user, user_start, length);
+    user[length] = '\0';
+    *text = user_end + 2;
+    return true;
+}
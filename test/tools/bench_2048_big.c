@@ -0,0 +1,86 @@
+// Times g2048b_move against the scalar reference on 8x8 boards, and checks
+// that both give the same board and score for every move.
+//
+//     gcc -O2 -Iinclude -o bench_2048_big tools/bench_2048_big.c g2048_big.c -lpthread
+//     ./bench_2048_big
+//
+// The kernel is picked at run time (g2048b_simd_name), so no -m flags are
+// needed.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "g2048_big.h"
+
+#define BOARDS 4096
+#define ROUNDS 200
+#define SIZE 8
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (uint32_t)(rng_state >> 32);
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Mid-game boards: about a third empty, small exponents so merges are common
+static void random_board(struct g2048b_board* board) {
+    g2048b_init(board, SIZE);
+    for (int r = 0; r < SIZE; r++) {
+        for (int c = 0; c < SIZE; c++) {
+            uint32_t x = next_random();
+            board->cells[r][c] = (x % 3 == 0) ? 0 : (uint8_t)(1 + (x >> 8) % 6);
+        }
+    }
+}
+
+static double time_moves(const struct g2048b_board* boards, int (*move)(struct g2048b_board*, enum g2048_move, uint64_t*), uint64_t* checksum) {
+    static struct g2048b_board work[BOARDS];
+    double start = now_seconds();
+    for (int round = 0; round < ROUNDS; round++) {
+        memcpy(work, boards, sizeof(work));
+        for (int i = 0; i < BOARDS; i++) {
+            *checksum += move(&work[i], (enum g2048_move)((i + round) & 3), checksum);
+        }
+    }
+    return (now_seconds() - start) * 1e9 / ((double)ROUNDS * BOARDS);
+}
+
+int main(void) {
+    static struct g2048b_board boards[BOARDS];
+    for (int i = 0; i < BOARDS; i++) random_board(&boards[i]);
+
+    long mismatches = 0;
+    for (int i = 0; i < BOARDS; i++) {
+        for (int m = 0; m < 4; m++) {
+            struct g2048b_board a = boards[i];
+            struct g2048b_board b = boards[i];
+            uint64_t score_a = 0;
+            uint64_t score_b = 0;
+            int changed_a = g2048b_move(&a, (enum g2048_move)m, &score_a);
+            int changed_b = g2048b_move_scalar(&b, (enum g2048_move)m, &score_b);
+            if (changed_a != changed_b || score_a != score_b || memcmp(&a, &b, sizeof(a)) != 0) mismatches++;
+        }
+    }
+
+    uint64_t checksum_simd = 0;
+    uint64_t checksum_scalar = 0;
+    double simd_ns = time_moves(boards, g2048b_move, &checksum_simd);
+    double scalar_ns = time_moves(boards, g2048b_move_scalar, &checksum_scalar);
+
+    printf("%dx%d moves, %s kernel\n", SIZE, SIZE, g2048b_simd_name());
+    printf("    g2048b_move         %6.1f ns/move\n", simd_ns);
+    printf("    scalar reference    %6.1f ns/move\n", scalar_ns);
+    printf("    speedup             %6.2fx\n", scalar_ns / simd_ns);
+    printf("    mismatches %ld, checksums %s\n", mismatches, checksum_simd == checksum_scalar ? "match" : "DIFFER");
+    return mismatches != 0 || checksum_simd != checksum_scalar;
+}
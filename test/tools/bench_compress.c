@@ -0,0 +1,122 @@
+// Measures what compression buys on the payloads the client and server
+// exchange: a leaderboard page, a full and a small live RANKS push, and an
+// outbox upload batch, built in the exact formats rank_service.c and score.c
+// produce. For each zlib level it prints the compressed size and the time
+// to compress and to inflate, then checks a wsz round trip.
+//
+//     gcc -O2 -Iinclude -o bench_compress tools/bench_compress.c wsz.c -lz
+//     ./bench_compress
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <zlib.h>
+
+#include "wsz.h"
+
+#define ROUNDS 2000
+
+static const char* const names[] = {
+    "minjun", "seoyeon", "doyun", "jiwoo", "hajun", "seoah", "eunwoo", "hayoon",
+    "siwoo", "jian", "guest_4821", "tetris_master", "sun", "kim_jh", "player77", "lee",
+};
+
+static unsigned int rng_state = 12345;
+
+static unsigned int next_random(void) {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return (rng_state >> 8) & 0xFFFFFF;
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t leaderboard_page(char* out, size_t size, int rows) {
+    size_t n = (size_t)snprintf(out, size, "{\"total\":1048576,\"rows\":[");
+    int score = 250000;
+    for (int i = 0; i < rows; i++) {
+        score -= next_random() % 40;
+        n += (size_t)snprintf(out + n, size - n, "%s{\"rank\":%d,\"username\":\"%s%u\",\"score\":%d}",
+            i ? "," : "", 20001 + i, names[next_random() % 16], next_random() % 1000, score);
+    }
+    n += (size_t)snprintf(out + n, size - n, "]}");
+    return n;
+}
+
+static size_t ranks_push(char* out, size_t size, int rows) {
+    size_t n = (size_t)snprintf(out, size, "RANKS {\"game\":\"tetris\",\"window\":\"all\",\"total\":1048576,\"count\":100,\"rows\":[");
+    int score = 250000;
+    for (int i = 0; i < rows; i++) {
+        score -= next_random() % 40;
+        n += (size_t)snprintf(out + n, size - n, "%s[%d,\"%s%u\",%d]",
+            i ? "," : "", 1 + i, names[next_random() % 16], next_random() % 1000, score);
+    }
+    n += (size_t)snprintf(out + n, size - n, "]}");
+    return n;
+}
+
+static size_t outbox_batch(char* out, size_t size, int records) {
+    static const char* const games[] = { "2048", "tetris", "breakout", "minesweeper", "tictactoe" };
+    size_t n = (size_t)snprintf(out, size, "[");
+    for (int i = 0; i < records; i++) {
+        n += (size_t)snprintf(out + n, size - n,
+            "%s{\"id\":\"%08x-%04x-4%03x-a%03x-%06x%06x\",\"username\":\"%s\",\"game\":\"%s\",\"score\":%u,\"time\":%u}",
+            i ? "," : "", next_random(), next_random() & 0xFFFF, next_random() & 0xFFF, next_random() & 0xFFF,
+            next_random(), next_random(), names[3], games[next_random() % 5], next_random() % 100000, 1760000000u + i * 37);
+    }
+    n += (size_t)snprintf(out + n, size - n, "]");
+    return n;
+}
+
+static void measure(const char* what, const char* payload, size_t length) {
+    static unsigned char packed[1 << 20];
+    static unsigned char unpacked[1 << 20];
+
+    printf("%-22s %7zu bytes\n", what, length);
+    static const int levels[] = { 1, 6, 9 };
+    for (int l = 0; l < 3; l++) {
+        int level = levels[l];
+        uLongf packed_length = 0;
+        double start = now_seconds();
+        for (int r = 0; r < ROUNDS; r++) {
+            packed_length = sizeof(packed);
+            compress2(packed, &packed_length, (const Bytef*)payload, (uLong)length, level);
+        }
+        double pack_us = (now_seconds() - start) * 1e6 / ROUNDS;
+
+        start = now_seconds();
+        for (int r = 0; r < ROUNDS; r++) {
+            uLongf unpacked_length = sizeof(unpacked);
+            uncompress(unpacked, &unpacked_length, packed, packed_length);
+        }
+        double unpack_us = (now_seconds() - start) * 1e6 / ROUNDS;
+
+        printf("    level %d %7lu bytes (%4.1f%%)  deflate %7.1f us  inflate %6.1f us\n",
+            level, (unsigned long)packed_length, 100.0 * packed_length / length, pack_us, unpack_us);
+    }
+
+    size_t framed_length;
+    int binary;
+    unsigned char* framed = wsz_encode(payload, length, 16, &framed_length, &binary);
+    if (binary) {
+        size_t text_length = 0;
+        char* text = wsz_decode(framed + 16, framed_length, &text_length);
+        if (!text || text_length != length || memcmp(text, payload, length) != 0) printf("    wsz round trip FAILED\n");
+        free(text);
+    }
+    printf("    wsz frame %zu bytes, %s\n", framed_length, binary ? "compressed" : "sent as text");
+    free(framed);
+}
+
+int main(void) {
+    static char payload[1 << 20];
+
+    measure("leaderboard page", payload, leaderboard_page(payload, sizeof(payload), 100));
+    measure("RANKS full range", payload, ranks_push(payload, sizeof(payload), 100));
+    measure("RANKS delta (3 rows)", payload, ranks_push(payload, sizeof(payload), 3));
+    measure("outbox batch", payload, outbox_batch(payload, sizeof(payload), 100));
+    return 0;
+}
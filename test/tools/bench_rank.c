@@ -0,0 +1,196 @@
+// Benchmarks the leaderboard order-statistic tree (server/rank_tree.c).
+//
+// Fills a tree with N random scores (10M by default), then times score
+// updates, rank-of-score lookups and 50-row range reads at random ranks, and
+// cross-checks a sample of ranks against a sorted copy of the scores.
+//
+// The daily and weekly boards (server/rank_window.c) are timed the way the
+// service uses them under load, a week read after every score, over more
+// than a week of hours; each hour's boards are checked against boards merged
+// from scratch. One score in 20 arrives late, up to two days after it was
+// played, and no bucket may hold a player twice.
+//
+//     gcc -O2 -Iinclude -o bench_rank tools/bench_rank.c server/rank_tree.c server/rank_window.c
+//     ./bench_rank [entries]
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "rank_tree.h"
+#include "rank_window.h"
+
+#define QUERIES 1000000
+#define RANGE_ROWS 50
+#define WINDOW_PLAYERS 100000
+#define WINDOW_HOURS (RANK_WINDOW_BUCKETS + 24)
+#define WINDOW_SCORES_PER_HOUR 5000
+#define WINDOW_LATE_HOURS 48
+
+static uint64_t rng_state = 0x2545F4914F6CDD1Dull;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (uint32_t)(rng_state >> 16);
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int descending(const void* a, const void* b) {
+    int32_t x = *(const int32_t*)a;
+    int32_t y = *(const int32_t*)b;
+    return (x < y) - (x > y);
+}
+
+static void report(const char* what, long ops, double seconds) {
+    printf("%-16s %10ld ops %8.3f s %8.0f ns/op\n", what, ops, seconds, seconds * 1e9 / ops);
+}
+
+static int same_board(struct rank_windows* live, struct rank_windows* fresh, enum rank_window window, int64_t hour) {
+    int live_count, fresh_count;
+    const struct rank_entry* a = rank_windows_top(live, window, hour, &live_count);
+    const struct rank_entry* b = rank_windows_top(fresh, window, hour, &fresh_count);
+    return live_count == fresh_count && (!live_count || memcmp(a, b, sizeof(*a) * live_count) == 0);
+}
+
+// Buckets holding a player more than once
+static int duplicate_buckets(const struct rank_windows* windows) {
+    static uint32_t seen[WINDOW_PLAYERS];
+    static uint32_t stamp;
+    int duplicates = 0;
+    for (int b = 0; b < RANK_WINDOW_BUCKETS; b++) {
+        stamp++;
+        for (int i = 0; i < windows->buckets[b].count; i++) {
+            uint32_t player = windows->buckets[b].heap[i].player;
+            if (seen[player] == stamp) {
+                duplicates++;
+                break;
+            }
+            seen[player] = stamp;
+        }
+    }
+    return duplicates;
+}
+
+// Scores arrive hour by hour and every one is followed by a week read. The
+// fresh copy gets the same scores but is only read once an hour, so each of
+// its reads is a full merge.
+static int bench_windows(void) {
+    static struct rank_windows live, fresh;
+    static uint32_t players[WINDOW_SCORES_PER_HOUR];
+    static int32_t scores[WINDOW_SCORES_PER_HOUR];
+    static int64_t played[WINDOW_SCORES_PER_HOUR];
+    rank_windows_init(&live);
+    rank_windows_init(&fresh);
+
+    int errors = 0;
+    long ops = 0;
+    double seconds = 0;
+    volatile int sink = 0;
+    for (int64_t hour = 1000; hour < 1000 + WINDOW_HOURS; hour++) {
+        for (int i = 0; i < WINDOW_SCORES_PER_HOUR; i++) {
+            players[i] = next_random() % WINDOW_PLAYERS;
+            scores[i] = (int32_t)(next_random() % 1000000);
+            played[i] = next_random() % 20 ? hour : hour - (int64_t)(next_random() % WINDOW_LATE_HOURS);
+        }
+        double start = now_seconds();
+        for (int i = 0; i < WINDOW_SCORES_PER_HOUR; i++) {
+            int count;
+            rank_windows_submit(&live, played[i], players[i], scores[i]);
+            sink += rank_windows_top(&live, RANK_WINDOW_WEEK, hour, &count) != NULL;
+        }
+        seconds += now_seconds() - start;
+        ops += WINDOW_SCORES_PER_HOUR;
+        for (int i = 0; i < WINDOW_SCORES_PER_HOUR; i++) rank_windows_submit(&fresh, played[i], players[i], scores[i]);
+
+        if (!same_board(&live, &fresh, RANK_WINDOW_WEEK, hour)) errors++;
+        if (!same_board(&live, &fresh, RANK_WINDOW_DAY, hour)) errors++;
+    }
+    report("week write+read", ops, seconds);
+    errors += duplicate_buckets(&live);
+
+    // For scale: one full week merge
+    int count;
+    fresh.merged[RANK_WINDOW_WEEK].hour = -1;
+    double start = now_seconds();
+    rank_windows_top(&fresh, RANK_WINDOW_WEEK, 1000 + WINDOW_HOURS - 1, &count);
+    report("week full merge", 1, now_seconds() - start);
+
+    printf("%d hours of windowed boards, %d mismatches\n", WINDOW_HOURS, errors);
+    rank_windows_free(&live);
+    rank_windows_free(&fresh);
+    return errors;
+}
+
+int main(int argc, char* argv[]) {
+    uint32_t entries = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 10) : 10000000u;
+    struct rank_tree tree;
+    uint32_t* handles = (uint32_t*)malloc(sizeof(uint32_t) * entries);
+    if (!handles || rank_tree_init(&tree, entries) != 0) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    double start = now_seconds();
+    for (uint32_t i = 0; i < entries; i++) {
+        handles[i] = rank_tree_insert(&tree, (int32_t)(next_random() % 1000000), i);
+    }
+    report("insert", entries, now_seconds() - start);
+
+    // A player beating their best: remove the old entry, insert the new one
+    start = now_seconds();
+    for (long i = 0; i < QUERIES; i++) {
+        uint32_t player = next_random() % entries;
+        int32_t score = rank_tree_node(&tree, handles[player])->score + 1;
+        rank_tree_remove(&tree, handles[player]);
+        handles[player] = rank_tree_insert(&tree, score, player);
+    }
+    report("update", QUERIES, now_seconds() - start);
+
+    volatile uint32_t sink = 0;
+    start = now_seconds();
+    for (long i = 0; i < QUERIES; i++) {
+        sink += rank_tree_rank_of_score(&tree, (int32_t)(next_random() % 1000000));
+    }
+    report("rank of score", QUERIES, now_seconds() - start);
+
+    start = now_seconds();
+    for (long i = 0; i < QUERIES; i++) {
+        sink += rank_tree_rank_of(&tree, handles[next_random() % entries]);
+    }
+    report("rank of player", QUERIES, now_seconds() - start);
+
+    struct rank_entry rows[RANGE_ROWS];
+    start = now_seconds();
+    for (long i = 0; i < QUERIES; i++) {
+        sink += rank_tree_range(&tree, 1 + next_random() % entries, RANGE_ROWS, rows);
+    }
+    report("range of 50", QUERIES, now_seconds() - start);
+
+    // Cross-check against a sorted copy
+    int32_t* sorted = (int32_t*)malloc(sizeof(int32_t) * entries);
+    if (!sorted) return 1;
+    for (uint32_t i = 0; i < entries; i++) sorted[i] = rank_tree_node(&tree, handles[i])->score;
+    qsort(sorted, entries, sizeof(int32_t), descending);
+
+    int errors = 0;
+    for (int i = 0; i < 1000; i++) {
+        uint32_t rank = 1 + next_random() % entries;
+        if (rank_tree_range(&tree, rank, 1, rows) != 1 || rows[0].rank != rank || rows[0].score != sorted[rank - 1]) errors++;
+        uint32_t by_score = rank_tree_rank_of_score(&tree, sorted[rank - 1]);
+        if (by_score > rank || (by_score > 1 && sorted[by_score - 2] <= sorted[rank - 1])) errors++;
+    }
+    printf("%u entries, %d mismatches\n", rank_tree_size(&tree), errors);
+    errors += bench_windows();
+
+    free(sorted);
+    free(handles);
+    rank_tree_free(&tree);
+    return errors != 0;
+}
@@ -0,0 +1,177 @@
+// Records games the way the game screens do (replay.h), saves and loads
+// each replay, plays it again with replay_run and checks the score and end
+// match. Tetris games are played by the CPU (tetris_ai.h) at a human pace
+// with gravity on, up to 10 minutes each; 2048 games by a greedy player
+// with a few undos and redos. Reports replay sizes and how many times
+// faster than real time a replay re-simulates, and checks that a
+// truncated replay is refused.
+//
+//     gcc -O2 -Iinclude -o bench_replay tools/bench_replay.c replay.c g2048_play.c g2048.c g2048_big.c history.c tetris_sim.c tetris_ai.c ai_pool.c tetris.c -lm -lpthread
+//     ./bench_replay [games]
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "g2048_play.h"
+#include "replay.h"
+#include "tetris_ai.h"
+#include "tetris_sim.h"
+
+#define FRAME_MS 16
+#define SLACK_MS 8
+#define TAP_MS 60                    // a key is held this long
+#define ACTION_MS 140                // between key presses
+#define MAX_GAME_MS (10 * 60 * 1000)
+#define MOVE_MS 250                  // 2048 moves
+#define RUNS 20                      // re-simulations per replay for the timing
+#define REPLAY_PATH "bench_replay.tmp"
+
+static struct rng bench_random;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void record(struct tetris_sim* sim, struct replay* replay, int64_t time_us, int key, bool pressed) {
+    struct tetris_input input = { time_us, (uint8_t)key, pressed, 0, 0 };
+    if (tetris_sim_input(sim, &input)) replay_add(replay, (input.time_us + 999) / 1000, key * 2 + pressed);
+}
+
+// Frames as the screen runs them: inputs stamped between frames, the
+// simulation kept SLACK_MS behind
+static void play_tetris(uint64_t seed, struct replay* replay, struct tetris_sim* sim) {
+    static const int keys[] = {
+        [TETRIS_ACTION_LEFT] = TETRIS_KEY_LEFT, [TETRIS_ACTION_RIGHT] = TETRIS_KEY_RIGHT,
+        [TETRIS_ACTION_CW] = TETRIS_KEY_CW, [TETRIS_ACTION_CCW] = TETRIS_KEY_CCW,
+        [TETRIS_ACTION_DOWN] = TETRIS_KEY_SOFT_DROP, [TETRIS_ACTION_DROP] = TETRIS_KEY_HARD_DROP,
+        [TETRIS_ACTION_HOLD] = TETRIS_KEY_HOLD,
+    };
+    tetris_sim_init(sim, seed);
+    replay_start(replay, REPLAY_TETRIS, 0, seed);
+
+    struct tetris_placement plan = { 0 };
+    int step = -1;
+    uint32_t locks = (uint32_t)-1;
+    int64_t next_at = 0;
+    for (int64_t now = 0; now < MAX_GAME_MS && !sim->game.over; now += FRAME_MS) {
+        if (sim->locks != locks || step == -1) {
+            struct tetris_ai_result result;
+            locks = sim->locks;
+            step = tetris_ai_search(&sim->game, NULL, false, NULL, &result) ? 0 : -2;
+            plan = result.best;
+            if (next_at < now) next_at = now + ACTION_MS;
+        }
+        if (step >= 0 && step < plan.path_length && now >= next_at) {
+            int key = keys[plan.path[step++]];
+            int64_t at = now * 1000 - (int64_t)rng_below(&bench_random, FRAME_MS * 1000);
+            record(sim, replay, at, key, true);
+            record(sim, replay, at + TAP_MS * 1000, key, false);
+            next_at += ACTION_MS + rng_below(&bench_random, ACTION_MS);
+            if (key == TETRIS_KEY_HOLD) step = -1;
+        }
+        tetris_sim_advance(sim, (now - SLACK_MS) * 1000);
+    }
+    replay_end(replay, (sim->now_us + 999) / 1000);
+}
+
+// Corner strategy: the first of down, left, right, up that moves; every
+// 40th move is undone and the undo redone half the time
+static void play_2048(int size, uint64_t seed, struct replay* replay, struct g2048_play* play) {
+    static const enum g2048_move order[] = { G2048_DOWN, G2048_LEFT, G2048_RIGHT, G2048_UP };
+    g2048_play_new(play, size, seed);
+    replay_start(replay, REPLAY_2048, size, seed);
+    int64_t now = 0;
+    while (!play->over) {
+        now += MOVE_MS / 2 + rng_below(&bench_random, MOVE_MS);
+        for (int i = 0; i < 4; i++) {
+            if (g2048_play_move(play, order[i])) {
+                replay_add(replay, now, order[i]);
+                break;
+            }
+        }
+        if (play->moves % 40 == 0 && !play->over && g2048_play_undo(play)) {
+            replay_add(replay, now += MOVE_MS, REPLAY_UNDO);
+            if (rng_below(&bench_random, 2) && g2048_play_redo(play)) replay_add(replay, now += MOVE_MS, REPLAY_REDO);
+        }
+    }
+    replay_end(replay, now);
+}
+
+struct totals {
+    int games;
+    int matched;
+    int64_t game_ms;
+    size_t bytes;
+    long inputs;
+    double run_seconds;
+};
+
+// Save, load, run again and compare; then time RUNS more runs
+static void check(const struct replay* replay, uint64_t score, bool over, struct totals* totals) {
+    size_t size;
+    uint8_t* data = NULL;
+    struct replay_result result;
+    totals->games++;
+    if (!replay_complete(replay) || replay_save(replay, REPLAY_PATH) != 0 || !(data = replay_load(REPLAY_PATH, &size))) {
+        printf("    could not record, save or load a replay\n");
+        free(data);
+        return;
+    }
+    if (replay_run(data, size, 0, &result) && result.score == score && result.over == over) totals->matched++;
+    else printf("    replay does not match: score %llu, played %llu\n", (unsigned long long)score, (unsigned long long)result.score);
+
+    double start = now_seconds();
+    for (int i = 0; i < RUNS; i++) replay_run(data, size, 0, &result);
+    totals->run_seconds += (now_seconds() - start) / RUNS;
+    totals->game_ms += result.duration_ms;
+    totals->bytes += size;
+    totals->inputs += result.inputs;
+    free(data);
+}
+
+static void report(const char* name, const struct totals* totals) {
+    double minutes = totals->game_ms / 60000.0;
+    printf("%s: %d games, %.1f min of play, %d/%d replays match\n", name, totals->games, minutes, totals->matched, totals->games);
+    printf("    %zu bytes for %ld inputs: %.2f bytes per input, %.1f KB per 10 minutes\n", totals->bytes, totals->inputs,
+        (double)totals->bytes / totals->inputs, totals->bytes / minutes * 10 / 1024);
+    printf("    re-simulation %.0fx real time (%.2f ms per game)\n", totals->game_ms / 1000.0 / totals->run_seconds,
+        totals->run_seconds * 1000 / totals->games);
+}
+
+int main(int argc, char** argv) {
+    int games = argc > 1 ? atoi(argv[1]) : 5;
+    struct replay replay = { 0 };
+    struct totals tetris_totals = { 0 }, g2048_totals = { 0 };
+    struct tetris_sim* sim = (struct tetris_sim*)malloc(sizeof(*sim));
+    struct g2048_play play;
+    if (!sim || g2048_play_init(&play) != 0) return 1;
+    rng_seed(&bench_random, 42);
+
+    for (int g = 0; g < games; g++) {
+        play_tetris(1000 + (uint64_t)g, &replay, sim);
+        check(&replay, sim->game.score, sim->game.over, &tetris_totals);
+    }
+    report("tetris", &tetris_totals);
+
+    // Cut short, the replay must not run
+    struct replay_result result;
+    int truncated_ok = replay_run(replay.data, replay.size - 1, 0, &result);
+    printf("    truncated replay: %s\n", truncated_ok ? "accepted" : "rejected");
+
+    for (int g = 0; g < games * 4; g++) {
+        int size = g % 4 == 3 ? 6 : G2048_SIZE;
+        play_2048(size, 2000 + (uint64_t)g, &replay, &play);
+        check(&replay, play.score, play.over, &g2048_totals);
+    }
+    report("2048", &g2048_totals);
+
+    remove(REPLAY_PATH);
+    replay_free(&replay);
+    g2048_play_free(&play);
+    free(sim);
+    tetris_ai_shutdown();
+    return tetris_totals.matched != tetris_totals.games || g2048_totals.matched != g2048_totals.games || truncated_ok;
+}
@@ -0,0 +1,164 @@
+// Times Tetris placements (drop a piece, lock it, clear rows) on the bitboard
+// well, and replays the same placements on a plain one-byte-per-cell grid
+// to check that both wells stay identical.
+//
+//     gcc -O2 -Iinclude -o bench_tetris tools/bench_tetris.c tetris.c -lm
+//     ./bench_tetris [placements]
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "tetris.h"
+
+#define CHECKED 1000000
+
+static uint64_t rng_state = 0x2545F4914F6CDD1Dull;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (uint32_t)(rng_state >> 16);
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Reference well: grid[y][x] is 1 for a filled cell
+struct grid {
+    unsigned char cells[TETRIS_HEIGHT][TETRIS_WIDTH];
+};
+
+static int grid_filled(const struct grid* grid, int x, int y) {
+    if (x < 0 || x >= TETRIS_WIDTH || y < 0) return 1;
+    return y < TETRIS_HEIGHT && grid->cells[y][x];
+}
+
+static int grid_fits(const struct grid* grid, struct tetris_piece piece) {
+    for (int r = 0; r < 4; r++) {
+        for (int c = 0; c < 4; c++) {
+            if (((tetris_shapes[piece.type][piece.rotation][r] >> c) & 1) && grid_filled(grid, piece.x + c, piece.y + r)) return 0;
+        }
+    }
+    return 1;
+}
+
+static int grid_place(struct grid* grid, struct tetris_piece piece) {
+    while (grid_fits(grid, (struct tetris_piece){ piece.type, piece.rotation, piece.x, (int8_t)(piece.y - 1) })) piece.y--;
+    for (int r = 0; r < 4; r++) {
+        for (int c = 0; c < 4; c++) {
+            int y = piece.y + r;
+            if (((tetris_shapes[piece.type][piece.rotation][r] >> c) & 1) && y < TETRIS_HEIGHT) grid->cells[y][piece.x + c] = 1;
+        }
+    }
+
+    int lines = 0;
+    for (int y = 0; y < TETRIS_HEIGHT; ) {
+        int count = 0;
+        for (int x = 0; x < TETRIS_WIDTH; x++) count += grid->cells[y][x];
+        if (count < TETRIS_WIDTH) {
+            y++;
+            continue;
+        }
+        memmove(grid->cells[y], grid->cells[y + 1], (size_t)(TETRIS_HEIGHT - 1 - y) * TETRIS_WIDTH);
+        memset(grid->cells[TETRIS_HEIGHT - 1], 0, TETRIS_WIDTH);
+        lines++;
+    }
+    return lines;
+}
+
+static int same_well(const struct tetris_well* well, const struct grid* grid) {
+    for (int y = 0; y < TETRIS_HEIGHT; y++) {
+        for (int x = 0; x < TETRIS_WIDTH; x++) {
+            if (tetris_cell(well, x, y) != (grid->cells[y][x] != 0)) return 0;
+        }
+    }
+    return 1;
+}
+
+// A random piece and rotation, in the column where it lands lowest so rows
+// fill up and clear; type -1 when the well is too full to take it
+static struct tetris_piece random_piece(const struct tetris_well* well) {
+    struct tetris_piece piece = { (int8_t)(next_random() % TETRIS_TYPES), (int8_t)(next_random() & 3), 0, TETRIS_VISIBLE };
+    int best_y = TETRIS_HEIGHT;
+    for (int x = -2; x < TETRIS_WIDTH; x++) {
+        struct tetris_piece at = piece;
+        at.x = (int8_t)x;
+        if (!tetris_fits(well, at)) continue;
+        int y = at.y - tetris_drop_distance(well, at);
+        if (y < best_y || (y == best_y && (next_random() & 1))) {
+            best_y = y;
+            piece.x = (int8_t)x;
+        }
+    }
+    if (best_y == TETRIS_HEIGHT) piece.type = -1;
+    return piece;
+}
+
+int main(int argc, char** argv) {
+    long placements = argc > 1 ? atol(argv[1]) : 20000000;
+
+    // Check against the grid while keeping the stack low enough to go on
+    struct tetris_well well;
+    struct grid grid;
+    tetris_well_clear(&well);
+    memset(&grid, 0, sizeof(grid));
+    long mismatches = 0;
+    long lines_checked = 0;
+    for (long i = 0; i < CHECKED; i++) {
+        struct tetris_piece piece = random_piece(&well);
+        if (piece.type < 0) {
+            tetris_well_clear(&well);
+            memset(&grid, 0, sizeof(grid));
+            continue;
+        }
+        struct tetris_piece dropped = piece;
+        dropped.y = (int8_t)(dropped.y - tetris_drop_distance(&well, piece));
+        int lines = tetris_place(&well, dropped);
+        lines_checked += lines;
+        if (lines != grid_place(&grid, piece) || !same_well(&well, &grid)) {
+            mismatches++;
+            tetris_well_clear(&well);
+            memset(&grid, 0, sizeof(grid));
+        }
+    }
+
+    // Pregenerate the pieces so the timing covers only the engine
+    enum { POOL = 4096 };
+    static struct tetris_piece pool[POOL];
+    for (int i = 0; i < POOL; i++) {
+        pool[i].type = (int8_t)(next_random() % TETRIS_TYPES);
+        pool[i].rotation = (int8_t)(next_random() & 3);
+        pool[i].x = (int8_t)((int)(next_random() % (TETRIS_WIDTH - 1)) - 1);
+        pool[i].y = TETRIS_VISIBLE;
+    }
+
+    tetris_well_clear(&well);
+    long lines = 0;
+    long resets = 0;
+    double start = now_seconds();
+    for (long i = 0; i < placements; i++) {
+        struct tetris_piece piece = pool[i & (POOL - 1)];
+        if (!tetris_fits(&well, piece)) {
+            // Left of the wall or blocked; blocked at spawn height ends the game
+            piece.x = 3;
+            if (!tetris_fits(&well, piece)) {
+                tetris_well_clear(&well);
+                resets++;
+                continue;
+            }
+        }
+        piece.y = (int8_t)(piece.y - tetris_drop_distance(&well, piece));
+        lines += tetris_place(&well, piece);
+    }
+    double seconds = now_seconds() - start;
+
+    printf("%ld placements checked against the grid, %ld lines, %ld mismatches\n", (long)CHECKED, lines_checked, mismatches);
+    printf("%ld placements in %.2f s: %.1f M placements/s, %.1f ns each (%ld lines, %ld resets)\n",
+        placements, seconds, placements / seconds / 1e6, seconds * 1e9 / placements, lines, resets);
+    return mismatches != 0;
+}
@@ -0,0 +1,98 @@
+// Plays Tetris with the placement search (tetris_ai.h) and reports how fast
+// it scores placements and how well it plays. Every chosen key sequence is
+// replayed through the engine's own actions and must end on the position
+// the search picked.
+//
+//     gcc -O2 -Iinclude -o bench_tetris_ai tools/bench_tetris_ai.c tetris_ai.c ai_pool.c tetris.c -lm -lpthread
+//     ./bench_tetris_ai [pieces]
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "tetris_ai.h"
+
+static double now_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Apply the path up to the hard drop; returns 0 if an action failed or the
+// piece did not end where the search said
+static int follow(struct tetris* game, const struct tetris_placement* placement) {
+    for (int i = 0; i < placement->path_length; i++) {
+        int ok = 1;
+        switch (placement->path[i]) {
+        case TETRIS_ACTION_LEFT: ok = tetris_shift(game, -1); break;
+        case TETRIS_ACTION_RIGHT: ok = tetris_shift(game, 1); break;
+        case TETRIS_ACTION_CW: ok = tetris_rotate(game, 1); break;
+        case TETRIS_ACTION_CCW: ok = tetris_rotate(game, -1); break;
+        case TETRIS_ACTION_DOWN: ok = tetris_soft_drop(game); break;
+        case TETRIS_ACTION_HOLD: ok = tetris_hold(game); break;
+        case TETRIS_ACTION_DROP:
+            if (game->piece.x != placement->piece.x || game->piece.y != placement->piece.y ||
+                game->piece.rotation != placement->piece.rotation) return 0;
+            tetris_hard_drop(game);
+            break;
+        }
+        if (!ok) return 0;
+    }
+    return 1;
+}
+
+static void play(int pieces, int lookahead) {
+    struct tetris game;
+    tetris_init(&game, 12345);
+    long long placements = 0;
+    long bad_paths = 0;
+    int tspins = 0;
+    int tetrises = 0;
+    double start = now_seconds();
+    while (game.pieces <= pieces && !game.over) {
+        struct tetris_ai_result result;
+        if (!tetris_ai_search(&game, NULL, lookahead, NULL, &result)) break;
+        placements += result.placements;
+        int lines_before = game.lines;
+        if (!follow(&game, &result.best)) {
+            bad_paths++;
+            break;
+        }
+        tspins += result.best.tspin && game.lines > lines_before;
+        tetrises += game.lines - lines_before == 4;
+    }
+    double seconds = now_seconds() - start;
+
+    printf("%s: %d pieces, %d lines, %d tetrises, %d T-spins, score %u%s\n", lookahead ? "lookahead" : "one piece",
+        game.pieces, game.lines, tetrises, tspins, game.score, game.over ? " (topped out)" : "");
+    printf("    %lld placements in %.2f s: %.2f M placements/s, %.1f us per move, %ld bad paths\n",
+        placements, seconds, placements / seconds / 1e6, seconds * 1e6 / game.pieces, bad_paths);
+}
+
+int main(int argc, char** argv) {
+    int pieces = argc > 1 ? atoi(argv[1]) : 2000;
+
+    // Raw enumeration on a ragged mid-game stack with an overhang to tuck under
+    static const int heights[TETRIS_WIDTH] = { 4, 6, 5, 2, 3, 7, 5, 4, 0, 3 };
+    struct tetris_well well;
+    tetris_well_clear(&well);
+    for (int x = 0; x < TETRIS_WIDTH; x++) {
+        for (int y = 0; y < heights[x]; y++) well.rows[y] |= (uint16_t)(1u << (x + TETRIS_WALL));
+    }
+    well.rows[1] &= (uint16_t)~(1u << (TETRIS_WALL + 7));
+    well.rows[2] &= (uint16_t)~(1u << (TETRIS_WALL + 7));
+    static struct tetris_placement out[TETRIS_AI_MAX_PLACEMENTS];
+    long long found = 0;
+    int rounds = 20000;
+    double start = now_seconds();
+    for (int i = 0; i < rounds; i++) {
+        found += tetris_ai_placements(&well, tetris_spawn_piece(i % TETRIS_TYPES), out, TETRIS_AI_MAX_PLACEMENTS);
+    }
+    double seconds = now_seconds() - start;
+    printf("enumeration: %.1f placements per piece, %.1f us per piece, %.2f M placements/s\n",
+        (double)found / rounds, seconds * 1e6 / rounds, found / seconds / 1e6);
+
+    play(pieces, 0);
+    play(pieces, 1);
+    tetris_ai_shutdown();
+    return 0;
+}
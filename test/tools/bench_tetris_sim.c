@@ -0,0 +1,135 @@
+// Checks that the Tetris simulation (tetris_sim.h) does not depend on how
+// often it is advanced: the same timestamped inputs are played once with a
+// frame every step and once with ragged frames of up to 100 ms, and both
+// games must end identical. Also checks DAS/ARR timing and reports how fast
+// the simulation runs.
+//
+//     gcc -O2 -Iinclude -o bench_tetris_sim tools/bench_tetris_sim.c tetris_sim.c tetris.c -lm
+//     ./bench_tetris_sim [games]
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "tetris_sim.h"
+
+#define INPUTS 4000
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (uint32_t)(rng_state >> 16);
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Presses and releases with human-like gaps; keys are mostly taps, the
+// horizontal keys and soft drop are sometimes held long enough to repeat
+static int make_inputs(struct tetris_input* inputs) {
+    int64_t time = 0;
+    int count = 0;
+    while (count + 2 <= INPUTS) {
+        int key = (int)(next_random() % TETRIS_KEYS);
+        if (key == TETRIS_KEY_HARD_DROP && (next_random() & 3)) key = TETRIS_KEY_LEFT + (int)(next_random() & 1);
+        time += 20000 + next_random() % 200000 + next_random() % 1000;
+        int64_t hold = 30000 + next_random() % 60000;
+        if (key <= TETRIS_KEY_RIGHT || key == TETRIS_KEY_SOFT_DROP) hold += (next_random() & 1) ? next_random() % 400000 : 0;
+        inputs[count++] = (struct tetris_input){ .time_us = time, .key = (uint8_t)key, .pressed = true };
+        inputs[count++] = (struct tetris_input){ .time_us = time + hold, .key = (uint8_t)key, .pressed = false };
+        time += hold;
+    }
+    return count;
+}
+
+// Feed inputs as a frame loop would: everything up to the frame's time is
+// queued, then the simulation advances to it
+static void play(struct tetris_sim* sim, uint64_t seed, struct tetris_input* inputs, int count, int max_frame_us) {
+    tetris_sim_init(sim, seed);
+    int next = 0;
+    int64_t frame = 0;
+    while (!sim->game.over && next < count) {
+        frame += max_frame_us <= TETRIS_SIM_STEP_US ? TETRIS_SIM_STEP_US : 1 + (int64_t)(next_random() % (uint32_t)max_frame_us);
+        while (next < count && inputs[next].time_us <= frame) {
+            struct tetris_input input = inputs[next++];
+            tetris_sim_input(sim, &input);
+        }
+        tetris_sim_advance(sim, frame);
+    }
+    tetris_sim_advance(sim, frame + 1000000);
+}
+
+static int same_game(const struct tetris_sim* a, const struct tetris_sim* b) {
+    return !memcmp(&a->game.well, &b->game.well, sizeof(a->game.well)) && a->game.score == b->game.score &&
+        a->game.lines == b->game.lines && a->game.pieces == b->game.pieces && a->locks == b->locks &&
+        a->game.piece.x == b->game.piece.x && a->game.piece.y == b->game.piece.y;
+}
+
+// Hold right for a while in an empty well with gravity off; the piece must
+// shift once on the press, once after DAS, then once per ARR until the
+// wall
+static int check_auto_shift(void) {
+    int failures = 0;
+    for (int held_ms = 0; held_ms <= 400; held_ms += 7) {
+        struct tetris_sim sim;
+        tetris_sim_init(&sim, 1);
+        tetris_sim_set_gravity(&sim, false);
+        int start_x = sim.game.piece.x;
+        int64_t start = sim.now_us + 500;
+        struct tetris_input press = { .time_us = start, .key = TETRIS_KEY_RIGHT, .pressed = true };
+        struct tetris_input release = { .time_us = start + held_ms * 1000, .key = TETRIS_KEY_RIGHT, .pressed = false };
+        tetris_sim_input(&sim, &press);
+        tetris_sim_input(&sim, &release);
+        tetris_sim_advance(&sim, start + 500000);
+
+        // The release is applied before the auto-shift of its step
+        int expected = 1;
+        if (held_ms > TETRIS_SIM_DAS_MS) expected += 1 + (held_ms - TETRIS_SIM_DAS_MS - 1) / TETRIS_SIM_ARR_MS;
+        struct tetris_piece probe = tetris_spawn_piece(sim.game.piece.type);
+        int wall = 0;
+        for (probe.x++; tetris_fits(&sim.game.well, probe); probe.x++) wall++;
+        if (expected > wall) expected = wall;
+        if (sim.game.piece.x - start_x != expected) {
+            printf("    held %d ms: moved %d, expected %d\n", held_ms, sim.game.piece.x - start_x, expected);
+            failures++;
+        }
+    }
+    return failures;
+}
+
+int main(int argc, char** argv) {
+    int games = argc > 1 ? atoi(argv[1]) : 200;
+
+    int auto_shift_failures = check_auto_shift();
+    printf("auto-shift: DAS %d ms, ARR %d ms, %d mismatches\n", TETRIS_SIM_DAS_MS, TETRIS_SIM_ARR_MS, auto_shift_failures);
+
+    static struct tetris_input inputs[INPUTS];
+    struct tetris_sim steady;
+    struct tetris_sim ragged;
+    int mismatches = 0;
+    long long pieces = 0;
+    long long simulated_us = 0;
+    double seconds = 0;
+    for (int i = 0; i < games; i++) {
+        int count = make_inputs(inputs);
+        uint64_t seed = 1000 + (uint64_t)i;
+        double start = now_seconds();
+        play(&steady, seed, inputs, count, TETRIS_SIM_STEP_US);
+        seconds += now_seconds() - start;
+        pieces += steady.game.pieces;
+        simulated_us += steady.now_us;
+
+        play(&ragged, seed, inputs, count, 100000);
+        if (!same_game(&steady, &ragged)) mismatches++;
+    }
+    printf("%d games, %lld pieces, %d differ between steady and ragged frames\n", games, pieces, mismatches);
+    printf("%.1f s of play simulated in %.3f s: %.0fx real time, %.1f ns per step\n", simulated_us / 1e6, seconds,
+        simulated_us / 1e6 / seconds, seconds * 1e9 / (simulated_us / TETRIS_SIM_STEP_US));
+    return mismatches || auto_shift_failures;
+}
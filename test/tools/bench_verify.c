@@ -0,0 +1,256 @@
+// Sizes the replay verification pool (replay_verify.h). Records Tetris
+// games played by the CPU and 2048 games played greedily, as bench_replay
+// does, then pushes ROUNDS copies of every score through the pool at 1, 2, 4
+// and 8 workers. Reports checks per second, minutes of play verified per
+// second and the time one check takes, and checks that forged scores,
+// replays of another game, truncated replays and scores without a replay
+// are all rejected.
+//
+//     gcc -O2 -Iinclude -o bench_verify tools/bench_verify.c server/replay_verify.c replay.c g2048_play.c g2048.c g2048_big.c history.c tetris_sim.c tetris_ai.c ai_pool.c tetris.c -lm -lpthread
+//     ./bench_verify [games]
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "g2048_play.h"
+#include "replay_verify.h"
+#include "tetris_ai.h"
+#include "tetris_sim.h"
+
+#define FRAME_MS 16
+#define SLACK_MS 8
+#define TAP_MS 60
+#define ACTION_MS 140
+#define MAX_GAME_MS (10 * 60 * 1000)
+#define MOVE_MS 250
+#define ROUNDS 4                     // copies of each score per pool size
+
+struct sample {
+    char game[32];
+    int score;
+    uint8_t* replay;
+    size_t size;
+    int64_t duration_ms;
+};
+
+static struct rng bench_random;
+static pthread_mutex_t wake_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wake_cond = PTHREAD_COND_INITIALIZER;
+static int wakes = 0;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void wake(void* arg) {
+    (void)arg;
+    pthread_mutex_lock(&wake_lock);
+    wakes++;
+    pthread_cond_signal(&wake_cond);
+    pthread_mutex_unlock(&wake_lock);
+}
+
+static void wait_wake(void) {
+    pthread_mutex_lock(&wake_lock);
+    while (!wakes) pthread_cond_wait(&wake_cond, &wake_lock);
+    wakes = 0;
+    pthread_mutex_unlock(&wake_lock);
+}
+
+static void record(struct tetris_sim* sim, struct replay* replay, int64_t time_us, int key, bool pressed) {
+    struct tetris_input input = { time_us, (uint8_t)key, pressed, 0, 0 };
+    if (tetris_sim_input(sim, &input)) replay_add(replay, (input.time_us + 999) / 1000, key * 2 + pressed);
+}
+
+static void play_tetris(uint64_t seed, struct replay* replay, struct tetris_sim* sim) {
+    static const int keys[] = {
+        [TETRIS_ACTION_LEFT] = TETRIS_KEY_LEFT, [TETRIS_ACTION_RIGHT] = TETRIS_KEY_RIGHT,
+        [TETRIS_ACTION_CW] = TETRIS_KEY_CW, [TETRIS_ACTION_CCW] = TETRIS_KEY_CCW,
+        [TETRIS_ACTION_DOWN] = TETRIS_KEY_SOFT_DROP, [TETRIS_ACTION_DROP] = TETRIS_KEY_HARD_DROP,
+        [TETRIS_ACTION_HOLD] = TETRIS_KEY_HOLD,
+    };
+    tetris_sim_init(sim, seed);
+    replay_start(replay, REPLAY_TETRIS, 0, seed);
+
+    struct tetris_placement plan = { 0 };
+    int step = -1;
+    uint32_t locks = (uint32_t)-1;
+    int64_t next_at = 0;
+    int64_t now = 0;
+    for (; now < MAX_GAME_MS && !sim->game.over; now += FRAME_MS) {
+        if (sim->locks != locks || step == -1) {
+            struct tetris_ai_result result;
+            locks = sim->locks;
+            step = tetris_ai_search(&sim->game, NULL, false, NULL, &result) ? 0 : -2;
+            plan = result.best;
+            if (next_at < now) next_at = now + ACTION_MS;
+        }
+        if (step >= 0 && step < plan.path_length && now >= next_at) {
+            int key = keys[plan.path[step++]];
+            int64_t at = now * 1000 - (int64_t)rng_below(&bench_random, FRAME_MS * 1000);
+            record(sim, replay, at, key, true);
+            record(sim, replay, at + TAP_MS * 1000, key, false);
+            next_at += ACTION_MS + rng_below(&bench_random, ACTION_MS);
+            if (key == TETRIS_KEY_HOLD) step = -1;
+        }
+        tetris_sim_advance(sim, (now - SLACK_MS) * 1000);
+    }
+    // Games the CPU survives are topped out so their replays end over
+    while (!sim->game.over) {
+        record(sim, replay, now * 1000, TETRIS_KEY_HARD_DROP, true);
+        record(sim, replay, (now + TAP_MS) * 1000, TETRIS_KEY_HARD_DROP, false);
+        now += ACTION_MS;
+        tetris_sim_advance(sim, (now - SLACK_MS) * 1000);
+    }
+    replay_end(replay, (sim->now_us + 999) / 1000);
+}
+
+static void play_2048(int size, uint64_t seed, struct replay* replay, struct g2048_play* play) {
+    static const enum g2048_move order[] = { G2048_DOWN, G2048_LEFT, G2048_RIGHT, G2048_UP };
+    g2048_play_new(play, size, seed);
+    replay_start(replay, REPLAY_2048, size, seed);
+    int64_t now = 0;
+    while (!play->over) {
+        now += MOVE_MS / 2 + rng_below(&bench_random, MOVE_MS);
+        for (int i = 0; i < 4; i++) {
+            if (g2048_play_move(play, order[i])) {
+                replay_add(replay, now, order[i]);
+                break;
+            }
+        }
+    }
+    replay_end(replay, now);
+}
+
+static void keep(struct sample* sample, const char* game, uint64_t score, const struct replay* replay) {
+    snprintf(sample->game, sizeof(sample->game), "%s", game);
+    sample->score = score > INT_MAX ? INT_MAX : (int)score;
+    sample->size = replay->size;
+    sample->replay = (uint8_t*)malloc(replay->size);
+    memcpy(sample->replay, replay->data, replay->size);
+    sample->duration_ms = replay->last_ms;
+}
+
+static struct replay_check* make_check(const char* game, int score, const uint8_t* replay, size_t size) {
+    struct replay_check* check = (struct replay_check*)calloc(1, sizeof(*check));
+    snprintf(check->game, sizeof(check->game), "%s", game);
+    snprintf(check->username, sizeof(check->username), "bench");
+    check->score = score;
+    if (replay && size) {
+        check->replay = (uint8_t*)malloc(size);
+        memcpy(check->replay, replay, size);
+        check->size = size;
+    }
+    return check;
+}
+
+// Collects what has finished; returns how many passed
+static int collect(int* finished, long long* check_us) {
+    int passed = 0;
+    struct replay_check* check = replay_verify_collect();
+    while (check) {
+        struct replay_check* next = check->next;
+        if (check->verdict == REPLAY_VERIFY_OK) passed++;
+        else printf("    %s score %d rejected: %s\n", check->game, check->score, replay_verdict_string(check->verdict));
+        *check_us += check->elapsed_us;
+        (*finished)++;
+        replay_check_free(check);
+        check = next;
+    }
+    return passed;
+}
+
+// Every sample ROUNDS times through a pool of the given size
+static bool run_pool(int workers, const struct sample* samples, int count, int64_t game_ms) {
+    if (replay_verify_start(workers, wake, NULL) != 0) return false;
+    int total = count * ROUNDS, submitted = 0, finished = 0, passed = 0;
+    long long check_us = 0;
+    double start = now_seconds();
+    while (finished < total) {
+        while (submitted < total) {
+            const struct sample* sample = &samples[submitted % count];
+            struct replay_check* check = make_check(sample->game, sample->score, sample->replay, sample->size);
+            if (!replay_verify_submit(check)) {
+                replay_check_free(check);
+                break;
+            }
+            submitted++;
+        }
+        wait_wake();
+        passed += collect(&finished, &check_us);
+    }
+    double seconds = now_seconds() - start;
+    replay_verify_shutdown();
+
+    printf("%d worker%s: %d/%d passed, %.0f checks/s, %.0f min of play verified per second, %.2f ms per check\n",
+        workers, workers == 1 ? "" : "s", passed, total, total / seconds, game_ms * ROUNDS / 60000.0 / seconds,
+        check_us / 1000.0 / total);
+    return passed == total;
+}
+
+int main(int argc, char** argv) {
+    int games = argc > 1 ? atoi(argv[1]) : 4;
+    int count = games * 5;
+    struct sample* samples = (struct sample*)calloc((size_t)count, sizeof(*samples));
+    struct tetris_sim* sim = (struct tetris_sim*)malloc(sizeof(*sim));
+    struct replay replay = { 0 };
+    struct g2048_play play;
+    if (!samples || !sim || g2048_play_init(&play) != 0) return 1;
+    rng_seed(&bench_random, 42);
+
+    int n = 0;
+    int64_t tetris_ms = 0, g2048_ms = 0;
+    for (int g = 0; g < games; g++, n++) {
+        play_tetris(1000 + (uint64_t)g, &replay, sim);
+        keep(&samples[n], "tetris", sim->game.score, &replay);
+        tetris_ms += samples[n].duration_ms;
+    }
+    for (int g = 0; g < games * 4; g++, n++) {
+        int size = g % 4 == 3 ? 6 : G2048_SIZE;
+        play_2048(size, 2000 + (uint64_t)g, &replay, &play);
+        keep(&samples[n], size == G2048_SIZE ? "2048" : "2048-6x6", play.score, &replay);
+        g2048_ms += samples[n].duration_ms;
+    }
+    printf("%d Tetris games (%.1f min), %d 2048 games (%.1f min), %d checks per pool size\n", games,
+        tetris_ms / 60000.0, games * 4, g2048_ms / 60000.0, count * ROUNDS);
+
+    bool ok = true;
+    static const int pool_sizes[] = { 1, 2, 4, 8 };
+    for (size_t i = 0; i < sizeof(pool_sizes) / sizeof(pool_sizes[0]); i++) {
+        ok = run_pool(pool_sizes[i], samples, count, tetris_ms + g2048_ms) && ok;
+    }
+
+    // Each of these must be turned down
+    const struct sample* tetris = &samples[0];
+    const struct sample* small = &samples[games];
+    struct replay_check* forged[] = {
+        make_check("tetris", tetris->score + 100, tetris->replay, tetris->size),
+        make_check("2048", small->score + 4, small->replay, small->size),
+        make_check("2048-8x8", small->score, small->replay, small->size),
+        make_check("tetris", small->score, small->replay, small->size),
+        make_check("tetris", tetris->score, tetris->replay, tetris->size - 1),
+        make_check("tetris", tetris->score, NULL, 0),
+        make_check("snake", small->score, small->replay, small->size),
+    };
+    int rejected = 0, forged_count = (int)(sizeof(forged) / sizeof(forged[0]));
+    for (int i = 0; i < forged_count; i++) {
+        enum replay_verdict verdict = replay_verify_run(forged[i]);
+        printf("    forged %s score %d: %s\n", forged[i]->game, forged[i]->score, replay_verdict_string(verdict));
+        if (verdict != REPLAY_VERIFY_OK) rejected++;
+        replay_check_free(forged[i]);
+    }
+    printf("%d/%d forged scores rejected\n", rejected, forged_count);
+
+    for (int i = 0; i < count; i++) free(samples[i].replay);
+    free(samples);
+    replay_free(&replay);
+    g2048_play_free(&play);
+    free(sim);
+    tetris_ai_shutdown();
+    return !ok || rejected != forged_count;
+}
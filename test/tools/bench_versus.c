@@ -0,0 +1,339 @@
+// Plays Tetris versus matches between two CPU players (tetris_ai.h) through
+// the wire format (tetris_versus.h) and the server referee
+// (server/versus_service.c), with 20 to 80 ms of network delay each way.
+// Each client runs a copy of the opponent's game from the relayed inputs;
+// at the end every copy must equal the game it mirrors. Reports the bytes
+// per input and per second, and the referee's cost per message. In the last
+// matches one player cheats, with a forged attack, by ignoring garbage or
+// by running their game slower than real time, and the referee must reject
+// them each time. Then a READY from someone outside a running match must
+// not stop it, a NONCE must wait for both READYs and match its commitment,
+// and a match whose second player never gets ready must end once the wait
+// runs out.
+//
+//     gcc -O2 -Iinclude -o bench_versus tools/bench_versus.c server/versus_service.c tetris_versus.c tetris_sim.c tetris_ai.c ai_pool.c tetris.c $(pkg-config --cflags --libs glib-2.0) -lm -lpthread
+//     ./bench_versus [matches]
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "tetris_ai.h"
+#include "tetris_versus.h"
+#include "versus_service.h"
+
+#define FRAME_MS 16
+#define SLACK_MS 8
+#define CPU_STEP_MS 30
+#define MAX_GAME_MS (10 * 60 * 1000)
+#define IN_FLIGHT 4096
+#define SLOW_CLOCK_PERCENT 90
+
+enum cheat { CHEAT_NONE, CHEAT_FORGED_ATTACK, CHEAT_IGNORED_GARBAGE, CHEAT_SLOW_CLOCK };
+
+struct player {
+    const char* name;
+    enum cheat cheat;
+    struct tetris_sim sim;
+    struct tetris_sim opponent;          // copy run from the relayed inputs
+    struct tetris_versus_stream sent;
+    struct tetris_versus_stream received;
+    struct tetris_input outbox[TETRIS_SIM_QUEUE];
+    int outbox_count;
+    int64_t last_sent_ms;
+    uint32_t locks;
+    struct tetris_placement plan;
+    int plan_step;
+    int64_t next_action_ms;
+    long inputs;
+    long bytes;
+    long messages;
+};
+
+struct packet {
+    int64_t deliver_ms;
+    int to;
+    char text[TETRIS_VERSUS_MESSAGE + 8];
+};
+
+static struct packet in_flight[IN_FLIGHT];
+static int in_flight_count;
+static uint64_t rng_state = 0x2545F4914F6CDD1Dull;
+static double referee_seconds;
+static long referee_messages;
+static char last_broadcast[160];
+static int64_t last_delivery[2];
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (uint32_t)(rng_state >> 16);
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void on_broadcast(const char* room, const char* message) {
+    (void)room;
+    snprintf(last_broadcast, sizeof(last_broadcast), "%s", message);
+}
+
+// READY with the nonce's commitment, then the nonce itself
+static enum versus_verdict send_ready(const char* room, const char* user, uint64_t nonce, int64_t now_ms) {
+    char text[16 + TETRIS_VERSUS_COMMITMENT];
+    char commitment[TETRIS_VERSUS_COMMITMENT];
+    tetris_versus_commitment(nonce, commitment);
+    snprintf(text, sizeof(text), "VS READY %s", commitment);
+    return versus_service_message(room, user, text, now_ms, on_broadcast);
+}
+
+static enum versus_verdict send_nonce(const char* room, const char* user, uint64_t nonce, int64_t now_ms) {
+    char text[32];
+    snprintf(text, sizeof(text), "VS NONCE %016llx", (unsigned long long)nonce);
+    return versus_service_message(room, user, text, now_ms, on_broadcast);
+}
+
+// Client to server to the other client; dropped messages never arrive
+static int send_text(struct player* players, int from, const char* text, int64_t now_ms) {
+    players[from].bytes += (long)strlen(text);
+    players[from].messages++;
+    double start = now_seconds();
+    enum versus_verdict verdict = versus_service_message("bench", players[from].name, text, now_ms, on_broadcast);
+    referee_seconds += now_seconds() - start;
+    referee_messages++;
+    if (verdict != VERSUS_RELAY || in_flight_count == IN_FLIGHT) return 0;
+
+    // The socket keeps messages in order
+    int64_t deliver = now_ms + 20 + next_random() % 60;
+    if (deliver < last_delivery[1 - from]) deliver = last_delivery[1 - from];
+    last_delivery[1 - from] = deliver;
+    struct packet* packet = &in_flight[in_flight_count++];
+    packet->deliver_ms = deliver;
+    packet->to = 1 - from;
+    snprintf(packet->text, sizeof(packet->text), "%s", text);
+    return 1;
+}
+
+static void queue_input(struct player* player, struct tetris_input input) {
+    if (!tetris_sim_input(&player->sim, &input)) return;
+    player->outbox[player->outbox_count++] = input;
+    player->inputs++;
+}
+
+static void receive(struct player* player, const char* text, int64_t now_ms) {
+    if (strncmp(text, "VS I ", 5) == 0) {
+        static struct tetris_input inputs[256];
+        int64_t upto;
+        int count = tetris_versus_decode(&player->received, text + 5, &upto, inputs, 256);
+        if (count < 0 || !tetris_versus_feed(&player->opponent, inputs, count, upto)) printf("    bad input message: %s\n", text);
+    }
+    else if (strncmp(text, "VS A ", 5) == 0 && player->cheat != CHEAT_IGNORED_GARBAGE) {
+        int lines, hole;
+        if (sscanf(text + 5, "%d %d", &lines, &hole) == 2) {
+            queue_input(player, (struct tetris_input){ now_ms * 1000, TETRIS_INPUT_GARBAGE, false, (uint8_t)lines, (uint8_t)hole });
+        }
+    }
+}
+
+// Send the inputs so far and how far the game has run
+static int flush(struct player* players, int index, int64_t now_ms) {
+    struct player* player = &players[index];
+    char text[TETRIS_VERSUS_MESSAGE];
+    if (tetris_versus_encode(&player->sent, player->outbox, player->outbox_count, player->sim.now_us / 1000, text, sizeof(text)) < 0) {
+        printf("    outbox does not fit a message\n");
+        return 0;
+    }
+    player->outbox_count = 0;
+    player->last_sent_ms = now_ms;
+    return send_text(players, index, text, now_ms);
+}
+
+// One frame of a client: CPU input, simulation, then the messages
+static int client_frame(struct player* players, int index, int64_t now_ms) {
+    struct player* player = &players[index];
+    int64_t game_ms = player->cheat == CHEAT_SLOW_CLOCK ? now_ms * SLOW_CLOCK_PERCENT / 100 : now_ms;
+    if (player->sim.locks != player->locks || player->plan_step < 0) {
+        player->locks = player->sim.locks;
+        struct tetris_ai_result result;
+        player->plan_step = tetris_ai_search(&player->sim.game, NULL, false, NULL, &result) ? 0 : -2;
+        player->plan = result.best;
+        player->next_action_ms = now_ms + CPU_STEP_MS;
+    }
+    if (player->plan_step >= 0 && player->plan_step < player->plan.path_length && now_ms >= player->next_action_ms &&
+        player->outbox_count + 2 <= TETRIS_SIM_QUEUE) {
+        static const int keys[] = {
+            [TETRIS_ACTION_LEFT] = TETRIS_KEY_LEFT, [TETRIS_ACTION_RIGHT] = TETRIS_KEY_RIGHT,
+            [TETRIS_ACTION_CW] = TETRIS_KEY_CW, [TETRIS_ACTION_CCW] = TETRIS_KEY_CCW,
+            [TETRIS_ACTION_DOWN] = TETRIS_KEY_SOFT_DROP, [TETRIS_ACTION_DROP] = TETRIS_KEY_HARD_DROP,
+            [TETRIS_ACTION_HOLD] = TETRIS_KEY_HOLD,
+        };
+        int key = keys[player->plan.path[player->plan_step++]];
+        int64_t at = game_ms * 1000 + next_random() % 1000;
+        queue_input(player, (struct tetris_input){ at, (uint8_t)key, true, 0, 0 });
+        queue_input(player, (struct tetris_input){ at, (uint8_t)key, false, 0, 0 });
+        player->next_action_ms += CPU_STEP_MS;
+        // A hold brings a different piece; plan again once it is in play
+        if (key == TETRIS_KEY_HOLD) player->plan_step = -1;
+    }
+    tetris_sim_advance(&player->sim, (game_ms - SLACK_MS) * 1000);
+
+    // An attack goes out after the inputs that made it
+    int64_t since = now_ms - player->last_sent_ms;
+    if (((player->outbox_count && since >= TETRIS_VERSUS_BATCH_MS) || player->sim.attack_count || since >= TETRIS_VERSUS_HEARTBEAT_MS) &&
+        !flush(players, index, now_ms)) return 0;
+    struct tetris_attack attack;
+    while (tetris_sim_take_attack(&player->sim, &attack)) {
+        char text[32];
+        snprintf(text, sizeof(text), "VS A %d %d", attack.lines, player->cheat == CHEAT_FORGED_ATTACK ? (attack.hole + 1) % TETRIS_WIDTH : attack.hole);
+        if (!send_text(players, index, text, now_ms)) return 0;
+    }
+    return !player->sim.game.over;
+}
+
+static int same_game(const struct tetris_sim* a, const struct tetris_sim* b) {
+    return !memcmp(&a->game.well, &b->game.well, sizeof(a->game.well)) && a->game.score == b->game.score &&
+        a->game.pieces == b->game.pieces && a->locks == b->locks && a->lines_received == b->lines_received &&
+        a->game.piece.x == b->game.piece.x && a->game.piece.y == b->game.piece.y && a->game.over == b->game.over;
+}
+
+// Returns 1 if the match ran to a top-out or the time limit and both
+// copies agree; the first player tries the cheat
+static int play_match(struct player* players, uint64_t seed, enum cheat cheat, int64_t* game_ms) {
+    last_broadcast[0] = '\0';
+    players[0].cheat = cheat;
+    in_flight_count = 0;
+    last_delivery[0] = last_delivery[1] = 0;
+    for (int i = 0; i < 2; i++) {
+        memset(&players[i].sim, 0, offsetof(struct player, inputs) - offsetof(struct player, sim));
+        send_ready("bench", players[i].name, i ? seed : 0, 0);
+        tetris_sim_init(&players[i].sim, seed);
+        tetris_sim_init(&players[i].opponent, seed);
+        players[i].plan_step = -1;
+    }
+    for (int i = 0; i < 2; i++) send_nonce("bench", players[i].name, i ? seed : 0, 0);
+
+    int64_t now = 0;
+    int running = 1;
+    while (running && now < MAX_GAME_MS) {
+        now += FRAME_MS;
+        for (int i = 0; i < 2 && running; i++) running = client_frame(players, i, now);
+
+        int kept = 0;
+        for (int i = 0; i < in_flight_count; i++) {
+            if (in_flight[i].deliver_ms <= now) receive(&players[in_flight[i].to], in_flight[i].text, now);
+            else in_flight[kept++] = in_flight[i];
+        }
+        in_flight_count = kept;
+    }
+    // Both send where they stopped, the loser says so, the last messages arrive
+    for (int i = 0; i < 2; i++) flush(players, i, now);
+    for (int i = 0; i < 2; i++) {
+        if (players[i].sim.game.over) send_text(players, i, "VS OVER", now);
+    }
+    for (int i = 0; i < in_flight_count; i++) receive(&players[in_flight[i].to], in_flight[i].text, now);
+    in_flight_count = 0;
+    // Matches stopped by the time limit end without a result
+    versus_service_leave("bench", players[0].name);
+    *game_ms = now;
+    if (strncmp(last_broadcast, "VS REJECT", 9) == 0) return 0;
+    return same_game(&players[0].sim, &players[1].opponent) && same_game(&players[1].sim, &players[0].opponent);
+}
+
+// Returns 1 if a third user's READY leaves the match running, a player's
+// READY during the match gives it up, an early or wrong NONCE is turned
+// down and a match short of a READY is expired
+static int room_rules(void) {
+    char text[TETRIS_VERSUS_MESSAGE];
+    struct tetris_versus_stream stream = { 0 };
+    last_broadcast[0] = '\0';
+    send_ready("rules", "alice", 0, 0);
+    send_ready("rules", "bob", 1, 0);
+    send_nonce("rules", "alice", 0, 0);
+    send_nonce("rules", "bob", 1, 0);
+    int dropped = send_ready("rules", "carol", 2, 100) == VERSUS_DROP;
+    tetris_versus_encode(&stream, NULL, 0, 100, text, sizeof(text));
+    int still_running = versus_service_message("rules", "alice", text, 200, on_broadcast) == VERSUS_RELAY;
+    int ignored = dropped && still_running && !last_broadcast[0];
+    printf("READY from outside the match: %s\n", ignored ? "ignored" : "stopped the match");
+
+    send_ready("rules", "alice", 3, 300);
+    int forfeit = strcmp(last_broadcast, "VS RESULT bob") == 0;
+    int stopped = versus_service_message("rules", "bob", text, 400, on_broadcast) == VERSUS_DROP;
+    printf("READY during the match: %s\n", forfeit && stopped ? last_broadcast : "no result");
+    versus_service_message("rules", "alice", "VS LEAVE", 500, on_broadcast);
+    last_broadcast[0] = '\0';
+
+    send_ready("reveal", "alice", 5, 0);
+    int early = send_nonce("reveal", "alice", 5, 0) == VERSUS_DROP;
+    send_ready("reveal", "bob", 6, 0);
+    send_nonce("reveal", "bob", 7, 0);
+    int wrong = strcmp(last_broadcast, "VS REJECT bob nonce does not match READY") == 0;
+    printf("NONCE before both READYs: %s; NONCE against another READY: %s\n", early ? "dropped" : "relayed",
+        wrong ? last_broadcast : "accepted");
+    last_broadcast[0] = '\0';
+
+    send_ready("stall", "alice", 0, 0);
+    versus_service_expire(VERSUS_READY_TIMEOUT_MS - 1, on_broadcast);
+    int waited = !last_broadcast[0];
+    versus_service_expire(VERSUS_READY_TIMEOUT_MS, on_broadcast);
+    int expired = strncmp(last_broadcast, "VS REJECT alice ", 16) == 0;
+    printf("READY never answered: %s\n", waited && expired ? last_broadcast : "room held open");
+    return ignored && forfeit && stopped && early && wrong && waited && expired;
+}
+
+int main(int argc, char** argv) {
+    int matches = argc > 1 ? atoi(argv[1]) : 10;
+    struct player players[2] = { { .name = "alice" }, { .name = "bob" } };
+
+    int agreed = 0;
+    long pieces = 0;
+    long lines_sent = 0;
+    int64_t total_ms = 0;
+    for (int m = 0; m < matches; m++) {
+        int64_t game_ms;
+        agreed += play_match(players, 1000 + (uint64_t)m, CHEAT_NONE, &game_ms);
+        total_ms += game_ms;
+        for (int i = 0; i < 2; i++) {
+            pieces += players[i].sim.game.pieces;
+            lines_sent += players[i].sim.lines_sent;
+        }
+        if (last_broadcast[0]) printf("match %d: %s after %.1f s\n", m, last_broadcast, game_ms / 1000.0);
+    }
+
+    long inputs = players[0].inputs + players[1].inputs;
+    long bytes = players[0].bytes + players[1].bytes;
+    long messages = players[0].messages + players[1].messages;
+    printf("%d matches, %.1f min of play, %ld pieces, %ld garbage lines, %d/%d with every copy in agreement\n", matches,
+        total_ms / 60000.0, pieces, lines_sent, agreed, matches);
+    printf("%ld inputs in %ld messages, %ld bytes: %.2f bytes per input, %.0f bytes/s per player\n", inputs, messages, bytes,
+        (double)bytes / inputs, bytes / (total_ms / 1000.0) / 2);
+    printf("referee: %ld messages, %.2f us each\n", referee_messages, referee_seconds * 1e6 / referee_messages);
+
+    static const struct {
+        enum cheat cheat;
+        const char* what;
+        const char* verdict;
+    } cheats[] = {
+        { CHEAT_FORGED_ATTACK, "forged attack", "VS REJECT alice attack without a clear" },
+        { CHEAT_IGNORED_GARBAGE, "ignored garbage", "VS REJECT alice garbage not taken in" },
+        { CHEAT_SLOW_CLOCK, "slow clock", "VS REJECT alice clock behind the server" },
+    };
+    int caught = 1;
+    for (size_t i = 0; i < sizeof(cheats) / sizeof(cheats[0]); i++) {
+        int64_t game_ms;
+        play_match(players, 7, cheats[i].cheat, &game_ms);
+        int rejected = strcmp(last_broadcast, cheats[i].verdict) == 0;
+        printf("%s: %s after %.1f s\n", cheats[i].what, rejected ? last_broadcast : "not caught", game_ms / 1000.0);
+        caught = caught && rejected;
+    }
+    players[0].cheat = CHEAT_NONE;
+    int rules = room_rules();
+
+    versus_service_shutdown();
+    tetris_ai_shutdown();
+    return agreed != matches || !caught || !rules;
+}
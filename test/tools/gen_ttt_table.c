@@ -0,0 +1,73 @@
+// Generates ttt_table.c: the solved 3x3 Tic-Tac-Toe game tree.
+//
+// Every position reachable from the empty board (5,478 of them) is solved by
+// negamax and stored at its base-3 index, so lookups need no search at run
+// time. Regenerate after changing the encoding:
+//
+//     gcc -O2 -o gen_ttt_table tools/gen_ttt_table.c
+//     ./gen_ttt_table > ttt_table.c
+#include <stdio.h>
+#include <stdint.h>
+
+#define TTT_POSITIONS 19683
+
+static uint8_t table[TTT_POSITIONS];
+static int reachable = 0;
+
+static const int lines[8][3] = {
+    { 0, 1, 2 }, { 3, 4, 5 }, { 6, 7, 8 },
+    { 0, 3, 6 }, { 1, 4, 7 }, { 2, 5, 8 },
+    { 0, 4, 8 }, { 2, 4, 6 }
+};
+
+static const int pow3[9] = { 1, 3, 9, 27, 81, 243, 729, 2187, 6561 };
+
+// Value for the side to move: 1 win, 0 draw, -1 loss
+static int solve(int cells[9], int code, int side) {
+    if (table[code]) {
+        return (table[code] & 3) - 2;
+    }
+    reachable++;
+
+    int previous = (side ^ 1) + 1;
+    int lost = 0;
+    for (int i = 0; i < 8 && !lost; i++) {
+        lost = cells[lines[i][0]] == previous && cells[lines[i][1]] == previous
+            && cells[lines[i][2]] == previous;
+    }
+
+    int best_value = -1;
+    int best_cell = -1;
+    if (!lost) {
+        best_value = -2;
+        for (int i = 0; i < 9; i++) {
+            if (cells[i]) continue;
+            cells[i] = side + 1;
+            int value = -solve(cells, code + (side + 1) * pow3[i], side ^ 1);
+            cells[i] = 0;
+            if (value > best_value) {
+                best_value = value;
+                best_cell = i;
+            }
+        }
+        if (best_cell < 0) best_value = 0; // full board
+    }
+
+    table[code] = (uint8_t)(((best_cell + 1) << 2) | (best_value + 2));
+    return best_value;
+}
+
+int main(void) {
+    int cells[9] = { 0 };
+    solve(cells, 0, 0);
+
+    printf("// Generated by tools/gen_ttt_table.c, do not edit.\n");
+    printf("// %d reachable positions, see ttt_table.h for the entry layout.\n", reachable);
+    printf("#include \"ttt_table.h\"\n\n");
+    printf("const uint8_t ttt_table[TTT_POSITIONS] = {\n");
+    for (int i = 0; i < TTT_POSITIONS; i++) {
+        printf("%s0x%02x,%s", (i % 16) ? " " : "    ", table[i], (i % 16 == 15 || i == TTT_POSITIONS - 1) ? "\n" : "");
+    }
+    printf("};\n");
+    return 0;
+}
@@ -0,0 +1,1237 @@
+// Generated by tools/gen_ttt_table.c, do not edit.
+// 5478 reachable positions, see ttt_table.h for the entry layout.
+#include "ttt_table.h"
+
+const uint8_t ttt_table[TTT_POSITIONS] = {
+    0x06, 0x16, 0x00, 0x06, 0x00, 0x12, 0x00, 0x13, 0x00, 0x16, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x17,
+    0x16, 0x00, 0x00, 0x13, 0x00, 0x16, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00,
+    0x16, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 0x00, 0x17, 0x07, 0x09, 0x00,
+    0x27, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x09, 0x00, 0x07, 0x00, 0x15, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x22, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x13, 0x06, 0x26, 0x00, 0x22, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x1a, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x1a, 0x00,
+    0x0b, 0x00, 0x00, 0x19, 0x07, 0x19, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x0f, 0x00,
+    0x05, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x07, 0x19, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x19, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x00, 0x06, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x00, 0x06, 0x00,
+    0x26, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x00,
+    0x06, 0x00, 0x26, 0x00, 0x1f, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x27, 0x22, 0x23, 0x00, 0x00,
+    0x1f, 0x00, 0x1e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x00, 0x1f, 0x0f, 0x16, 0x00, 0x00, 0x00, 0x09, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x13, 0x06, 0x12, 0x00, 0x12, 0x00, 0x17, 0x00, 0x13, 0x00, 0x00, 0x00,
+    0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+    0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x07, 0x15, 0x00, 0x06, 0x0e, 0x00, 0x0e, 0x00, 0x1f, 0x00,
+    0x27, 0x00, 0x26, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x17, 0x26, 0x00, 0x00, 0x0a, 0x00, 0x06, 0x16,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x00, 0x0b, 0x00, 0x00, 0x11, 0x07, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x00, 0x1f,
+    0x0f, 0x26, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1f, 0x06, 0x26, 0x00, 0x22,
+    0x00, 0x23, 0x00, 0x27, 0x00, 0x06, 0x0a, 0x00, 0x06, 0x00, 0x26, 0x00, 0x22, 0x00, 0x26, 0x00,
+    0x27, 0x00, 0x00, 0x27, 0x27, 0x23, 0x00, 0x00, 0x1e, 0x00, 0x1e, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x09, 0x00, 0x00, 0x0f, 0x05, 0x1f, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x27, 0x05, 0x1f, 0x00, 0x07, 0x00, 0x1d, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x0e,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00, 0x27, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x09, 0x00, 0x05, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x1e, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x16,
+    0x1f, 0x1e, 0x00, 0x00, 0x1f, 0x00, 0x27, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+    0x05, 0x00, 0x0b, 0x00, 0x00, 0x11, 0x07, 0x11, 0x00, 0x00, 0x27, 0x00, 0x23, 0x27, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x22, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00,
+    0x00, 0x1e, 0x00, 0x1f, 0x26, 0x27, 0x00, 0x27, 0x00, 0x23, 0x00, 0x1f, 0x00, 0x00, 0x0b, 0x00,
+    0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x06,
+    0x00, 0x26, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x0f, 0x00, 0x00, 0x16, 0x07,
+    0x0d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x16, 0x00, 0x17, 0x07, 0x09, 0x00, 0x16, 0x00,
+    0x23, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x07, 0x00, 0x09, 0x00, 0x00, 0x27, 0x07, 0x01, 0x00, 0x17,
+    0x16, 0x00, 0x16, 0x00, 0x17, 0x00, 0x17, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17,
+    0x00, 0x00, 0x27, 0x00, 0x23, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x00, 0x0a, 0x00,
+    0x00, 0x22, 0x07, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01,
+    0x05, 0x00, 0x0b, 0x00, 0x00, 0x0d, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x23, 0x26, 0x00, 0x22, 0x00, 0x23, 0x00, 0x27, 0x00, 0x06, 0x12, 0x00, 0x06, 0x00,
+    0x26, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x27, 0x00, 0x00, 0x13, 0x22, 0x13, 0x00, 0x00, 0x13, 0x00,
+    0x06, 0x12, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x27, 0x07, 0x01, 0x00, 0x00,
+    0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x19, 0x07, 0x01, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00,
+    0x00, 0x00, 0x1a, 0x00, 0x1a, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x0b, 0x00, 0x07, 0x00, 0x19,
+    0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+    0x00, 0x00, 0x16, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x06, 0x00,
+    0x0a, 0x00, 0x00, 0x16, 0x07, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0x0e, 0x00, 0x0b, 0x00, 0x00, 0x0d, 0x0f, 0x16, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x17, 0x06, 0x16, 0x00, 0x16, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x22, 0x06, 0x26, 0x00, 0x0a, 0x00,
+    0x27, 0x00, 0x00, 0x27, 0x22, 0x23, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x23, 0x00, 0x27,
+    0x06, 0x12, 0x00, 0x06, 0x00, 0x26, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x07, 0x00, 0x09, 0x00, 0x00,
+    0x27, 0x07, 0x01, 0x00, 0x27, 0x0a, 0x00, 0x0e, 0x00, 0x27, 0x00, 0x22, 0x00, 0x26, 0x00, 0x27,
+    0x00, 0x00, 0x27, 0x27, 0x23, 0x00, 0x00, 0x0a, 0x00, 0x06, 0x22, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x09, 0x00, 0x16, 0x00, 0x17, 0x00, 0x0f, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00, 0x17, 0x07, 0x11,
+    0x00, 0x00, 0x13, 0x00, 0x27, 0x13, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x00, 0x27,
+    0x07, 0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x05, 0x00, 0x17, 0x07, 0x01, 0x00, 0x27,
+    0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x17, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17,
+    0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x0b, 0x00, 0x00, 0x0d, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x27, 0x27, 0x00, 0x27, 0x00, 0x23, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x00, 0x09,
+    0x00, 0x00, 0x27, 0x07, 0x01, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x27, 0x00, 0x23, 0x27, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0x00, 0x12, 0x13, 0x00, 0x00, 0x00, 0x00, 0x12, 0x13, 0x00, 0x07, 0x00, 0x11,
+    0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x06,
+    0x00, 0x26, 0x00, 0x00, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x27, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x07, 0x00,
+    0x11, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x23, 0x00,
+    0x27, 0x00, 0x17, 0x00, 0x17, 0x00, 0x16, 0x00, 0x1b, 0x00, 0x00, 0x27, 0x1b, 0x23, 0x00, 0x00,
+    0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x26, 0x00, 0x22, 0x00, 0x13, 0x00, 0x13, 0x00, 0x06, 0x00, 0x12, 0x00,
+    0x00, 0x13, 0x1b, 0x26, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x11, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00,
+    0x0b, 0x00, 0x00, 0x0d, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x1b,
+    0x07, 0x09, 0x00, 0x05, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x09, 0x00, 0x07, 0x00, 0x01, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+    0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x0e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x00, 0x06, 0x00, 0x26, 0x00, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x26, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x27, 0x00,
+    0x13, 0x00, 0x00, 0x13, 0x13, 0x26, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x00, 0x0f, 0x00, 0x00, 0x17, 0x0f, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x17, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x07, 0x00, 0x01, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x13, 0x00, 0x00, 0x13, 0x07, 0x0d, 0x00, 0x00,
+    0x00, 0x13, 0x00, 0x00, 0x00, 0x05, 0x00, 0x13, 0x07, 0x09, 0x00, 0x05, 0x00, 0x13, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x06, 0x26, 0x00, 0x07,
+    0x00, 0x01, 0x00, 0x27, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x26, 0x00, 0x00, 0x0b,
+    0x00, 0x07, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x09, 0x00, 0x05, 0x00, 0x27, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x0b, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x27, 0x00, 0x27, 0x00, 0x00,
+    0x27, 0x27, 0x23, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x00, 0x06,
+    0x00, 0x16, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x27, 0x00, 0x22, 0x00, 0x23, 0x00, 0x27, 0x00, 0x06, 0x00, 0x0a,
+    0x00, 0x00, 0x22, 0x06, 0x26, 0x00, 0x00, 0x27, 0x00, 0x23, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1f, 0x00, 0x00,
+    0x17, 0x06, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x13, 0x27, 0x26, 0x00,
+    0x17, 0x00, 0x17, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x0f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x07, 0x00, 0x09, 0x00, 0x00, 0x17, 0x07, 0x15,
+    0x00, 0x17, 0x16, 0x00, 0x17, 0x00, 0x17, 0x00, 0x27, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x00, 0x17,
+    0x1f, 0x16, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0a, 0x00,
+    0x0b, 0x00, 0x00, 0x01, 0x06, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x1f, 0x26, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00,
+    0x00, 0x1e, 0x00, 0x1f, 0x07, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x06, 0x12, 0x00,
+    0x07, 0x00, 0x0d, 0x00, 0x1f, 0x00, 0x12, 0x00, 0x27, 0x00, 0x00, 0x13, 0x27, 0x12, 0x00, 0x00,
+    0x1f, 0x00, 0x05, 0x13, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x0f, 0x1f, 0x1e,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x27, 0x1f, 0x1f, 0x00, 0x07, 0x00, 0x19,
+    0x00, 0x1f, 0x00, 0x00, 0x1a, 0x00, 0x05, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x1b, 0x00, 0x07,
+    0x00, 0x19, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x07, 0x00, 0x09, 0x00, 0x00, 0x17, 0x07, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x01, 0x0e, 0x00, 0x1f, 0x00, 0x00, 0x17, 0x27, 0x26, 0x00, 0x00, 0x00, 0x1f,
+    0x00, 0x00, 0x00, 0x26, 0x00, 0x1f, 0x06, 0x16, 0x00, 0x16, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0a, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x06, 0x26, 0x00,
+    0x0e, 0x00, 0x27, 0x00, 0x00, 0x0f, 0x27, 0x1e, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x26,
+    0x00, 0x27, 0x1e, 0x1f, 0x00, 0x07, 0x00, 0x11, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x07, 0x00, 0x09,
+    0x00, 0x00, 0x1f, 0x05, 0x1f, 0x00, 0x27, 0x0e, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x27, 0x00, 0x26,
+    0x00, 0x27, 0x00, 0x00, 0x1f, 0x27, 0x26, 0x00, 0x00, 0x1e, 0x00, 0x1e, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x17, 0x16, 0x00, 0x17, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00, 0x17,
+    0x1f, 0x16, 0x00, 0x00, 0x27, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0a, 0x00,
+    0x00, 0x16, 0x1f, 0x1e, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x1f, 0x27, 0x1f,
+    0x00, 0x17, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x1f, 0x26, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x1e, 0x00, 0x1f, 0x0b, 0x27, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0a,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0b,
+    0x00, 0x0b, 0x00, 0x00, 0x01, 0x05, 0x27, 0x00, 0x07, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f,
+    0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x07, 0x1d, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x05, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x12, 0x13, 0x00, 0x07,
+    0x00, 0x11, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1e,
+    0x00, 0x0f, 0x00, 0x26, 0x00, 0x1f, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x27, 0x1f, 0x1e, 0x00,
+    0x00, 0x1f, 0x00, 0x05, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x26, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x27, 0x00, 0x0b, 0x00, 0x00, 0x11, 0x07, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x0d,
+    0x0f, 0x26, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x17, 0x0b, 0x26, 0x00, 0x05,
+    0x00, 0x17, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 0x0b,
+    0x00, 0x00, 0x01, 0x27, 0x26, 0x00, 0x26, 0x00, 0x27, 0x00, 0x00, 0x27, 0x07, 0x0d, 0x00, 0x00,
+    0x00, 0x27, 0x00, 0x00, 0x00, 0x26, 0x00, 0x27, 0x07, 0x09, 0x00, 0x27, 0x00, 0x27, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x05, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x27, 0x05, 0x00, 0x27, 0x00, 0x00, 0x27, 0x07, 0x01, 0x00, 0x27, 0x1b, 0x00, 0x1b,
+    0x00, 0x27, 0x00, 0x27, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x00, 0x1b, 0x27, 0x1b, 0x00, 0x00, 0x27,
+    0x00, 0x27, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x26, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x26,
+    0x00, 0x0b, 0x00, 0x00, 0x15, 0x27, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x26,
+    0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x26, 0x00, 0x27, 0x00, 0x00,
+    0x27, 0x07, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x26,
+    0x00, 0x27, 0x00, 0x00, 0x27, 0x27, 0x26, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x26, 0x00,
+    0x27, 0x27, 0x26, 0x00, 0x26, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x0b, 0x00, 0x00, 0x0d,
+    0x07, 0x0d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x13, 0x27, 0x27, 0x00, 0x27,
+    0x00, 0x17, 0x00, 0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x27, 0x00, 0x27, 0x00, 0x00, 0x27, 0x07, 0x01, 0x00,
+    0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17,
+    0x17, 0x00, 0x00, 0x27, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x27, 0x00, 0x0b,
+    0x00, 0x00, 0x01, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00,
+    0x01, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x0b, 0x27, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x13, 0x13, 0x00, 0x13,
+    0x00, 0x27, 0x00, 0x13, 0x00, 0x13, 0x00, 0x27, 0x00, 0x00, 0x13, 0x13, 0x13, 0x00, 0x00, 0x13,
+    0x00, 0x27, 0x13, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x27, 0x00, 0x00, 0x27, 0x07, 0x01, 0x00,
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x05, 0x00, 0x27, 0x07, 0x01, 0x00, 0x27, 0x00, 0x27, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x00,
+    0x17, 0x00, 0x17, 0x00, 0x0e, 0x00, 0x06, 0x00, 0x12, 0x00, 0x00, 0x13, 0x06, 0x16, 0x00, 0x00,
+    0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x17, 0x00, 0x00, 0x17, 0x06, 0x16,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1b, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17,
+    0x00, 0x17, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x07,
+    0x00, 0x01, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+    0x0b, 0x00, 0x00, 0x01, 0x06, 0x26, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x06, 0x00, 0x12,
+    0x07, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1a,
+    0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x05, 0x00, 0x0b, 0x00, 0x00,
+    0x01, 0x07, 0x19, 0x00, 0x07, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x07, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x06, 0x26, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x05, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x00, 0x07, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0f, 0x00, 0x07, 0x00, 0x0d,
+    0x00, 0x0e, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x27, 0x06, 0x1a, 0x00, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x09, 0x00, 0x00, 0x13, 0x06, 0x16, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x26,
+    0x00, 0x13, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00,
+    0x00, 0x16, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x17, 0x00, 0x17,
+    0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x07, 0x09, 0x00, 0x07, 0x00, 0x01, 0x00, 0x27, 0x00, 0x07,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x26, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x12, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x07, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x26, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x07, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x27, 0x00, 0x0e, 0x0f, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x26, 0x00, 0x27, 0x00, 0x00,
+    0x13, 0x27, 0x26, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09,
+    0x00, 0x00, 0x0f, 0x0e, 0x0f, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x26, 0x00, 0x27, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x05, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x09, 0x00, 0x07, 0x00, 0x01, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x00, 0x05,
+    0x00, 0x17, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0f,
+    0x00, 0x16, 0x00, 0x17, 0x00, 0x0e, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x16, 0x06, 0x16, 0x00,
+    0x00, 0x09, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x0a, 0x00, 0x0b,
+    0x00, 0x00, 0x01, 0x06, 0x26, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x00, 0x0b, 0x00, 0x00, 0x01, 0x06, 0x26, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x26, 0x0b, 0x27, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x00, 0x0e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x00, 0x06, 0x00, 0x26, 0x00,
+    0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x06, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x09, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+    0x00, 0x17, 0x1f, 0x00, 0x06, 0x00, 0x16, 0x00, 0x17, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00, 0x27,
+    0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x16, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x06, 0x00, 0x12, 0x00, 0x0f, 0x00,
+    0x05, 0x00, 0x13, 0x00, 0x00, 0x1f, 0x07, 0x11, 0x00, 0x00, 0x13, 0x00, 0x12, 0x27, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x1a, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x1b, 0x07, 0x09, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x00, 0x0b, 0x00,
+    0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x1b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0b, 0x00, 0x06,
+    0x00, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x16, 0x00, 0x06, 0x00, 0x12, 0x00,
+    0x17, 0x00, 0x27, 0x00, 0x13, 0x00, 0x00, 0x27, 0x17, 0x17, 0x00, 0x00, 0x13, 0x00, 0x12, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x0f, 0x00, 0x00, 0x16, 0x17, 0x17, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x17, 0x07, 0x09, 0x00, 0x16, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00,
+    0x0f, 0x00, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x12,
+    0x07, 0x0d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x13, 0x07, 0x09, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x0f, 0x26, 0x00, 0x1f, 0x00, 0x1e, 0x00, 0x0f, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x07,
+    0x1d, 0x00, 0x00, 0x27, 0x00, 0x06, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0f, 0x0e,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x0b, 0x00, 0x05, 0x00, 0x27, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0b, 0x00, 0x1f, 0x00, 0x26, 0x00, 0x01, 0x00, 0x0b,
+    0x00, 0x27, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1e, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x09, 0x00, 0x06, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+    0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x13, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x27, 0x00, 0x0e, 0x00, 0x0f,
+    0x00, 0x1e, 0x00, 0x1f, 0x00, 0x00, 0x1e, 0x07, 0x1d, 0x00, 0x00, 0x1f, 0x00, 0x26, 0x27, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x09, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x13, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00, 0x16, 0x17, 0x17,
+    0x00, 0x00, 0x13, 0x00, 0x06, 0x12, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x0e,
+    0x07, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x17, 0x07, 0x01, 0x00, 0x06,
+    0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09,
+    0x00, 0x05, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x0f, 0x00, 0x00, 0x0e, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x07, 0x09, 0x00, 0x06, 0x00, 0x12, 0x00, 0x13, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 0x1b,
+    0x00, 0x00, 0x1a, 0x07, 0x01, 0x00, 0x07, 0x09, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x27, 0x00, 0x06, 0x26, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0b, 0x00, 0x06, 0x00, 0x26,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x06,
+    0x00, 0x26, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x00, 0x0f, 0x00, 0x00, 0x0e, 0x17, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x17, 0x00, 0x17, 0x13, 0x12, 0x00, 0x06, 0x00, 0x12, 0x00, 0x13, 0x00, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x05,
+    0x00, 0x17, 0x00, 0x00, 0x16, 0x07, 0x01, 0x00, 0x0f, 0x0e, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x17,
+    0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x15, 0x17, 0x17, 0x00, 0x00, 0x0a, 0x00, 0x06, 0x16, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x00, 0x13, 0x00, 0x00, 0x12, 0x07, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x00, 0x0e, 0x07,
+    0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x26, 0x00, 0x06, 0x00,
+    0x26, 0x00, 0x27, 0x00, 0x0a, 0x0b, 0x00, 0x06, 0x00, 0x26, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x27,
+    0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x06, 0x12, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x09, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x07, 0x01, 0x00, 0x06, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0f, 0x0e, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x0b, 0x00, 0x05, 0x00, 0x27, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09,
+    0x00, 0x05, 0x00, 0x17, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x01, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x16, 0x07,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x13, 0x00, 0x26, 0x27, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x0e, 0x07, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x27, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07,
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x06, 0x00,
+    0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x27, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x27, 0x0b, 0x00, 0x27,
+    0x00, 0x26, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x26, 0x27, 0x00, 0x00,
+    0x00, 0x00, 0x27, 0x27, 0x00, 0x07, 0x00, 0x11, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x00, 0x1b, 0x27, 0x00, 0x27, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x1b,
+    0x00, 0x00, 0x27, 0x1b, 0x27, 0x00, 0x00, 0x1b, 0x00, 0x1b, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x27, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x27, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x27,
+    0x00, 0x17, 0x00, 0x00, 0x27, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x27, 0x00, 0x13,
+    0x00, 0x13, 0x00, 0x13, 0x00, 0x27, 0x00, 0x13, 0x00, 0x00, 0x13, 0x13, 0x27, 0x00, 0x00, 0x13,
+    0x00, 0x13, 0x27, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x05, 0x27, 0x00, 0x00, 0x00, 0x00, 0x27, 0x27, 0x00, 0x07, 0x00,
+    0x01, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x05, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x27, 0x0b, 0x00, 0x27, 0x00, 0x27, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x26, 0x27, 0x00,
+    0x00, 0x00, 0x00, 0x26, 0x27, 0x00, 0x27, 0x00, 0x26, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0x00, 0x0f, 0x00, 0x00, 0x16, 0x0f, 0x16, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x13, 0x07, 0x09, 0x00, 0x16, 0x00, 0x23, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0e, 0x00,
+    0x00, 0x00, 0x16, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x06, 0x00,
+    0x0a, 0x00, 0x00, 0x16, 0x07, 0x15, 0x00, 0x0f, 0x16, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x0f, 0x00,
+    0x05, 0x00, 0x1b, 0x00, 0x00, 0x1b, 0x07, 0x15, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x22, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x05, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x07, 0x01,
+    0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1b, 0x07, 0x01, 0x00, 0x05, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x06, 0x0a, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x22, 0x00, 0x1a, 0x00, 0x1b, 0x00,
+    0x00, 0x1a, 0x1b, 0x1b, 0x00, 0x00, 0x1f, 0x00, 0x1e, 0x13, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x0a, 0x00, 0x00, 0x0e, 0x22, 0x1f, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x23, 0x00, 0x1b,
+    0x1f, 0x1f, 0x00, 0x1f, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x00, 0x1a, 0x00, 0x1a, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x00, 0x09, 0x00, 0x00, 0x1f, 0x05, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x0e, 0x00, 0x0f, 0x00, 0x00, 0x1f,
+    0x07, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x16, 0x00, 0x1f,
+    0x00, 0x1e, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x00, 0x09,
+    0x00, 0x00, 0x1f, 0x07, 0x01, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x00, 0x0e, 0x0f, 0x0f, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1e, 0x0b, 0x00, 0x1f, 0x00, 0x1e, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x07, 0x00, 0x09, 0x00, 0x00, 0x1f, 0x05, 0x1f, 0x00, 0x0f, 0x0e, 0x00, 0x0e,
+    0x00, 0x0f, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x1e,
+    0x00, 0x1e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x17, 0x16, 0x00, 0x16, 0x00, 0x23, 0x00, 0x13, 0x00,
+    0x16, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x17, 0x17, 0x00, 0x00, 0x13, 0x00, 0x13, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x16, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00,
+    0x00, 0x16, 0x00, 0x1f, 0x07, 0x09, 0x00, 0x05, 0x00, 0x23, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00,
+    0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x00, 0x07, 0x00, 0x15, 0x00, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x00, 0x22, 0x07, 0x01,
+    0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1f, 0x07, 0x01, 0x00, 0x05, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1e, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x22, 0x07, 0x01, 0x00, 0x07, 0x01,
+    0x00, 0x05, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x07, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x12, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x12, 0x0b, 0x00, 0x13, 0x00, 0x12, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x1f, 0x1e, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x1f, 0x00, 0x06, 0x00, 0x0a,
+    0x00, 0x00, 0x1e, 0x22, 0x23, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x05, 0x00, 0x23, 0x00,
+    0x00, 0x22, 0x07, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01,
+    0x05, 0x00, 0x0b, 0x00, 0x00, 0x0d, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x17, 0x07, 0x09, 0x00, 0x22, 0x00, 0x23, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x05, 0x00, 0x23, 0x00, 0x00, 0x22, 0x07, 0x01, 0x00, 0x22, 0x00, 0x0f, 0x00,
+    0x00, 0x22, 0x23, 0x23, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x23, 0x00, 0x1b, 0x07, 0x09,
+    0x00, 0x22, 0x00, 0x23, 0x00, 0x13, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x23, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x05, 0x00, 0x23, 0x00, 0x00, 0x22, 0x07,
+    0x01, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x00,
+    0x1b, 0x1b, 0x1b, 0x00, 0x00, 0x23, 0x00, 0x23, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x00, 0x23, 0x00, 0x00, 0x22, 0x07, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00,
+    0x00, 0x09, 0x00, 0x00, 0x00, 0x23, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x22, 0x00, 0x23, 0x00, 0x00, 0x22, 0x23, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x01, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x0d, 0x0f, 0x23, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x23, 0x22, 0x00, 0x22, 0x00, 0x23, 0x00, 0x23, 0x00,
+    0x05, 0x00, 0x0f, 0x00, 0x00, 0x22, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x13, 0x07, 0x09, 0x00, 0x05, 0x00, 0x23, 0x00, 0x13, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x05, 0x00, 0x23,
+    0x00, 0x00, 0x22, 0x07, 0x01, 0x00, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17,
+    0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x05, 0x00, 0x23, 0x00, 0x00, 0x22, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x0d, 0x07, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x05, 0x00, 0x23, 0x00,
+    0x00, 0x00, 0x13, 0x13, 0x00, 0x13, 0x00, 0x23, 0x00, 0x13, 0x00, 0x13, 0x00, 0x23, 0x00, 0x00,
+    0x13, 0x23, 0x13, 0x00, 0x00, 0x13, 0x00, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x23,
+    0x00, 0x00, 0x22, 0x07, 0x01, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x23, 0x00, 0x23, 0x07,
+    0x01, 0x00, 0x05, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x06, 0x00, 0x12, 0x00, 0x0f, 0x00, 0x05, 0x00, 0x1b, 0x00,
+    0x00, 0x13, 0x07, 0x11, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+    0x1b, 0x00, 0x00, 0x16, 0x17, 0x17, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x1b,
+    0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x09, 0x00, 0x07, 0x00, 0x01, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x12, 0x00, 0x00, 0x13, 0x07, 0x01, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x1b, 0x07, 0x01, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1a, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x19, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09,
+    0x00, 0x05, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x0b, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x00, 0x1a, 0x1b,
+    0x23, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x07, 0x0d, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x17, 0x17, 0x00, 0x07, 0x00, 0x11, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x07, 0x09, 0x00, 0x07,
+    0x00, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x17,
+    0x00, 0x05, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 0x13, 0x00, 0x00, 0x13, 0x07,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07,
+    0x01, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x0f,
+    0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x09, 0x00, 0x06, 0x00, 0x12, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x16, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x06, 0x00, 0x0a,
+    0x00, 0x00, 0x16, 0x06, 0x16, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x05, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x12, 0x00, 0x00, 0x13, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x22, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x22, 0x07, 0x01, 0x00, 0x05, 0x00, 0x23, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x07, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0x0a, 0x00, 0x06, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+    0x00, 0x00, 0x1e, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x05, 0x00,
+    0x0b, 0x00, 0x00, 0x11, 0x07, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x1b, 0x07, 0x09, 0x00, 0x05, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1f, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x07, 0x01, 0x00, 0x1e, 0x00,
+    0x0f, 0x00, 0x00, 0x1f, 0x0f, 0x1e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x13,
+    0x1f, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x1f, 0x00, 0x1f, 0x00, 0x00,
+    0x1f, 0x1f, 0x1f, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x1b,
+    0x00, 0x00, 0x1b, 0x1b, 0x1b, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x07, 0x15, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00,
+    0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x1f, 0x07, 0x0d, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00,
+    0x1f, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x0d, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00,
+    0x00, 0x1e, 0x00, 0x1f, 0x07, 0x09, 0x00, 0x05, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x1e,
+    0x00, 0x00, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x05,
+    0x00, 0x0b, 0x00, 0x00, 0x15, 0x07, 0x15, 0x00, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17,
+    0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1e, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x07,
+    0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1f, 0x07, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1f, 0x13, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x13, 0x00, 0x1f,
+    0x00, 0x00, 0x13, 0x1f, 0x13, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x1e,
+    0x00, 0x1f, 0x00, 0x00, 0x1e, 0x1f, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00,
+    0x1f, 0x1f, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+    0x09, 0x00, 0x00, 0x13, 0x06, 0x16, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x1b,
+    0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f,
+    0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x07, 0x00, 0x09, 0x00, 0x00,
+    0x17, 0x05, 0x17, 0x00, 0x05, 0x17, 0x00, 0x07, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x07, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x07, 0x15, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x07, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x0f, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x1b,
+    0x1a, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x00,
+    0x0f, 0x0e, 0x0f, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x1b, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x05, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x1b,
+    0x1b, 0x00, 0x07, 0x00, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x07, 0x00, 0x09, 0x00, 0x00, 0x13, 0x05, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x0d, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x17, 0x00, 0x07, 0x00, 0x01, 0x00,
+    0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x07, 0x01, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x07, 0x00, 0x01, 0x00,
+    0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x13, 0x00, 0x12,
+    0x00, 0x00, 0x13, 0x06, 0x16, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x0a, 0x00, 0x00, 0x16, 0x06, 0x16, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x16, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x17, 0x00, 0x07, 0x00, 0x01, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x13, 0x00, 0x00, 0x00, 0x06, 0x00, 0x12, 0x07, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x05, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x12,
+    0x13, 0x00, 0x13, 0x00, 0x12, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x0f, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x02,
+    0x06, 0x02, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x16, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x17, 0x00,
+    0x05, 0x00, 0x17, 0x00, 0x00, 0x1a, 0x17, 0x17, 0x00, 0x00, 0x13, 0x00, 0x06, 0x16, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x00, 0x1b, 0x00, 0x00, 0x0e, 0x17, 0x17, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00,
+    0x00, 0x17, 0x00, 0x17, 0x07, 0x09, 0x00, 0x06, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00, 0x0b, 0x00,
+    0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00, 0x1b, 0x00, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x0e, 0x07, 0x01,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x13, 0x07, 0x01, 0x00, 0x06, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x05, 0x00, 0x1b, 0x00, 0x00, 0x1a, 0x07, 0x01, 0x00, 0x07, 0x01,
+    0x00, 0x06, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0x07, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0f, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x0b, 0x00, 0x05, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x0b, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x1b,
+    0x00, 0x00, 0x1a, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x0e,
+    0x0f, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x17, 0x17, 0x00, 0x06,
+    0x00, 0x12, 0x00, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x17, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x17, 0x00, 0x17, 0x00, 0x00, 0x16, 0x17, 0x17, 0x00,
+    0x07, 0x09, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x17, 0x00, 0x06, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 0x13,
+    0x00, 0x00, 0x12, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x1f, 0x07, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x0f, 0x0b, 0x00, 0x0e,
+    0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x1e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0b, 0x00, 0x1f, 0x00, 0x1e, 0x00,
+    0x01, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+    0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x06, 0x00, 0x12, 0x00, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x17,
+    0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x16, 0x17, 0x17, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x15, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01,
+    0x00, 0x06, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x00, 0x1e, 0x07, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x0e, 0x07,
+    0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1f, 0x07, 0x01, 0x00, 0x06, 0x00,
+    0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00,
+    0x05, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x0b, 0x00, 0x06, 0x00, 0x1e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x00, 0x0f, 0x00, 0x00, 0x0e, 0x17, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x17,
+    0x00, 0x17, 0x07, 0x09, 0x00, 0x06, 0x00, 0x12, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x06, 0x00, 0x0a,
+    0x00, 0x00, 0x16, 0x07, 0x01, 0x00, 0x0f, 0x17, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x05,
+    0x00, 0x0b, 0x00, 0x00, 0x15, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x06, 0x16, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x12, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x0e, 0x07, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x06, 0x00, 0x1a, 0x00,
+    0x00, 0x00, 0x0a, 0x0b, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x1b, 0x00, 0x00,
+    0x1a, 0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x06, 0x12, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0a,
+    0x00, 0x00, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07,
+    0x01, 0x00, 0x06, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1a, 0x1b, 0x00, 0x00, 0x00,
+    0x00, 0x1b, 0x0b, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x0a, 0x00, 0x00, 0x12, 0x05, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x0e, 0x00, 0x0f, 0x00, 0x00, 0x0e, 0x0f,
+    0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x16, 0x00, 0x06, 0x00,
+    0x16, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x00, 0x0a, 0x00,
+    0x00, 0x02, 0x07, 0x01, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0b, 0x00, 0x06, 0x00, 0x12, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x00, 0x0a, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x0f, 0x0b, 0x00, 0x0e, 0x00,
+    0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+    0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x13, 0x00, 0x17,
+    0x00, 0x17, 0x00, 0x00, 0x16, 0x17, 0x17, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x0e, 0x07, 0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+    0x17, 0x00, 0x17, 0x07, 0x01, 0x00, 0x06, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x17,
+    0x17, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x0e, 0x07, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x01, 0x00, 0x06, 0x00, 0x12, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x02, 0x07, 0x01, 0x00, 0x07, 0x01, 0x00,
+    0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x12, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x0b, 0x00, 0x13, 0x00, 0x12, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0a, 0x00,
+    0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00, 0x1b, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x17, 0x00, 0x05, 0x00, 0x1b, 0x00, 0x17, 0x00, 0x05, 0x00, 0x1b,
+    0x00, 0x00, 0x1a, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x06, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1b, 0x00, 0x00, 0x1a, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x1a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1b, 0x07, 0x01, 0x00, 0x05, 0x00, 0x1b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x07, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x0b, 0x00, 0x05, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x05,
+    0x00, 0x0f, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x17,
+    0x00, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x0d, 0x0f, 0x17, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00,
+    0x17, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f,
+    0x00, 0x00, 0x13, 0x07, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07,
+    0x01, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x07, 0x01, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0b, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x06, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x06, 0x00, 0x12, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x06, 0x00,
+    0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x02, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00,
+    0x17, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00,
+    0x0f, 0x00, 0x17, 0x00, 0x17, 0x00, 0x1e, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x1e, 0x00, 0x00,
+    0x1b, 0x00, 0x05, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x0e, 0x00, 0x22, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x1e, 0x00, 0x0b, 0x00,
+    0x00, 0x11, 0x13, 0x1e, 0x00, 0x00, 0x1a, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00,
+    0x0b, 0x00, 0x00, 0x0d, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1b,
+    0x1b, 0x1b, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+    0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x07, 0x00, 0x01, 0x00, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x12, 0x00, 0x1f, 0x00, 0x17, 0x00, 0x13, 0x00, 0x1f, 0x00,
+    0x17, 0x00, 0x00, 0x13, 0x17, 0x23, 0x00, 0x00, 0x13, 0x00, 0x17, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17,
+    0x00, 0x17, 0x07, 0x09, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x0a, 0x00, 0x06, 0x0e,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x00, 0x07, 0x00, 0x15, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x0b, 0x00, 0x00, 0x0d, 0x0f, 0x12, 0x00, 0x00,
+    0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x13, 0x0b, 0x12, 0x00, 0x05, 0x00, 0x13, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x06, 0x0a, 0x00, 0x22,
+    0x00, 0x1f, 0x00, 0x0e, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x1f, 0x1e, 0x00, 0x00, 0x0a,
+    0x00, 0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x06, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x0a, 0x00, 0x07, 0x00, 0x01, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x1f, 0x00, 0x07, 0x00, 0x01, 0x00, 0x1f, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x05, 0x23, 0x00, 0x00, 0x1f, 0x00, 0x05, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x05,
+    0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x1e, 0x00, 0x0b,
+    0x00, 0x00, 0x1d, 0x1f, 0x1e, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x0e, 0x00,
+    0x17, 0x00, 0x0f, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x17, 0x07, 0x11, 0x00, 0x00, 0x13, 0x00,
+    0x1a, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x0f, 0x07, 0x01, 0x00, 0x00,
+    0x00, 0x17, 0x00, 0x00, 0x00, 0x05, 0x00, 0x17, 0x07, 0x01, 0x00, 0x07, 0x00, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x00, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00, 0x17,
+    0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0b, 0x00,
+    0x00, 0x0d, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1a, 0x1b,
+    0x00, 0x1b, 0x00, 0x1b, 0x00, 0x13, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1b, 0x00, 0x1b, 0x00, 0x00, 0x1b, 0x07,
+    0x01, 0x00, 0x0b, 0x0e, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x23, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+    0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x07, 0x00, 0x01, 0x00, 0x13, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+    0x17, 0x00, 0x00, 0x17, 0x13, 0x12, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x17,
+    0x13, 0x12, 0x00, 0x12, 0x00, 0x17, 0x00, 0x13, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x05, 0x00, 0x17, 0x00, 0x00,
+    0x17, 0x07, 0x01, 0x00, 0x06, 0x0a, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x0e, 0x00, 0x16, 0x00, 0x17,
+    0x00, 0x00, 0x17, 0x17, 0x16, 0x00, 0x00, 0x0a, 0x00, 0x06, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x12, 0x00, 0x0b, 0x00, 0x00, 0x11, 0x13, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x0b, 0x00, 0x00, 0x0d, 0x0f, 0x0e, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x0a, 0x00, 0x22, 0x00, 0x23, 0x00, 0x22, 0x00,
+    0x06, 0x12, 0x00, 0x07, 0x00, 0x01, 0x00, 0x13, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05,
+    0x23, 0x00, 0x00, 0x13, 0x00, 0x06, 0x12, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x07, 0x01, 0x00,
+    0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x06, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0x0a, 0x00, 0x07, 0x00, 0x01, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00, 0x17,
+    0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x07,
+    0x00, 0x0d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x17, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f,
+    0x00, 0x00, 0x0f, 0x07, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+    0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x00, 0x05, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x22, 0x23, 0x00, 0x07, 0x00, 0x15, 0x00, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x23, 0x23, 0x00, 0x00, 0x00, 0x00, 0x22, 0x23,
+    0x00, 0x23, 0x00, 0x23, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00,
+    0x1b, 0x1b, 0x00, 0x23, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x23, 0x00, 0x1b, 0x00, 0x00, 0x23, 0x1b,
+    0x23, 0x00, 0x00, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x05, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x23, 0x00, 0x07, 0x00, 0x11, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00,
+    0x17, 0x17, 0x23, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x23, 0x00, 0x23, 0x00, 0x13, 0x00, 0x13,
+    0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x13, 0x13, 0x23, 0x00, 0x00, 0x13, 0x00, 0x13, 0x23, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+    0x00, 0x23, 0x23, 0x00, 0x00, 0x00, 0x00, 0x05, 0x23, 0x00, 0x07, 0x00, 0x01, 0x00, 0x22, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x05, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x05, 0x23, 0x00,
+    0x07, 0x00, 0x01, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x23, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x22,
+    0x23, 0x00, 0x23, 0x00, 0x23, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x00,
+    0x17, 0x00, 0x17, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x17, 0x00, 0x00, 0x17, 0x06, 0x12, 0x00, 0x00,
+    0x1a, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x00, 0x17, 0x06, 0x1e,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x17, 0x05, 0x1b, 0x00, 0x17, 0x00, 0x17,
+    0x00, 0x1b, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x00, 0x05,
+    0x00, 0x17, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+    0x0b, 0x00, 0x00, 0x01, 0x06, 0x0e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x13,
+    0x0b, 0x1b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1a,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x1b, 0x00, 0x0b, 0x00, 0x00,
+    0x01, 0x1b, 0x1b, 0x00, 0x0b, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x05, 0x00, 0x0b,
+    0x00, 0x00, 0x01, 0x1f, 0x1e, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x05, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x00, 0x07, 0x00, 0x01, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x00, 0x07, 0x00, 0x01,
+    0x00, 0x1f, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x00, 0x00, 0x1f, 0x00, 0x05,
+    0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0a, 0x00, 0x17, 0x00, 0x00, 0x17, 0x06, 0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x17, 0x17, 0x12, 0x00, 0x17, 0x00, 0x17, 0x00, 0x13, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00,
+    0x00, 0x16, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x00, 0x17,
+    0x00, 0x00, 0x17, 0x07, 0x15, 0x00, 0x06, 0x0a, 0x00, 0x16, 0x00, 0x17, 0x00, 0x0e, 0x00, 0x07,
+    0x00, 0x09, 0x00, 0x00, 0x17, 0x06, 0x16, 0x00, 0x00, 0x0a, 0x00, 0x17, 0x16, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x12, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x13, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x06, 0x0e, 0x00,
+    0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x1f, 0x0b, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x1e, 0x00, 0x06, 0x0a, 0x00, 0x07, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x06, 0x12, 0x00, 0x00, 0x1e, 0x00, 0x05, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x06, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x05,
+    0x1f, 0x00, 0x07, 0x00, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x0a, 0x00, 0x06, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x0a, 0x00, 0x07, 0x00, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x05,
+    0x00, 0x17, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f,
+    0x00, 0x0f, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x17, 0x1f, 0x1e, 0x00,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x05, 0x00, 0x0b,
+    0x00, 0x00, 0x01, 0x1f, 0x1e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0x00, 0x0b, 0x00, 0x00, 0x01, 0x0e, 0x0f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1e, 0x00,
+    0x1f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x05, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x07, 0x00, 0x01, 0x00,
+    0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x00, 0x17, 0x06, 0x12, 0x00, 0x00,
+    0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x17, 0x05, 0x1b, 0x00, 0x17, 0x00, 0x17, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x07, 0x00, 0x09, 0x00, 0x00, 0x17, 0x07, 0x01, 0x00, 0x17, 0x1b, 0x00, 0x17,
+    0x00, 0x17, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x16, 0x00, 0x00, 0x1a,
+    0x00, 0x17, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x05,
+    0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x05, 0x00, 0x0b,
+    0x00, 0x00, 0x01, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0b,
+    0x1b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x06, 0x12, 0x00, 0x07, 0x00, 0x01, 0x00, 0x13,
+    0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x12, 0x00, 0x00, 0x13, 0x00, 0x05, 0x1b, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x01, 0x07, 0x01, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1a,
+    0x00, 0x05, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1b, 0x00, 0x07, 0x00, 0x01, 0x00, 0x1a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x07, 0x00, 0x09, 0x00, 0x00,
+    0x17, 0x06, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x0a,
+    0x00, 0x17, 0x00, 0x00, 0x17, 0x06, 0x0e, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00,
+    0x17, 0x06, 0x0a, 0x00, 0x16, 0x00, 0x17, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x0a, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x06, 0x02, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x06, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x06, 0x12, 0x00,
+    0x07, 0x00, 0x01, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x01,
+    0x00, 0x06, 0x0a, 0x00, 0x07, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x06, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x00, 0x0f,
+    0x00, 0x17, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x17, 0x07, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x0f, 0x07, 0x01, 0x00,
+    0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x05, 0x00, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x17, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x00, 0x17, 0x00,
+    0x17, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0b,
+    0x00, 0x00, 0x01, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x0b, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x05, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x05, 0x13, 0x00, 0x07, 0x00, 0x01, 0x00, 0x13, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x07, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x00, 0x05, 0x00, 0x17, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0f, 0x00, 0x17, 0x00, 0x17,
+    0x00, 0x0e, 0x00, 0x0a, 0x00, 0x17, 0x00, 0x00, 0x17, 0x06, 0x16, 0x00, 0x00, 0x09, 0x00, 0x17,
+    0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x06,
+    0x12, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00,
+    0x01, 0x1b, 0x1a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x1b, 0x0b, 0x1b, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x05,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x00, 0x07, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x0a, 0x00, 0x17, 0x00, 0x17, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00,
+    0x13, 0x06, 0x12, 0x00, 0x00, 0x17, 0x00, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x17,
+    0x00, 0x00, 0x17, 0x17, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x17, 0x17,
+    0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x0a, 0x00, 0x07, 0x00, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x13, 0x12, 0x00, 0x00, 0x00, 0x13, 0x00,
+    0x00, 0x00, 0x12, 0x00, 0x13, 0x07, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0b, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0e, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x05, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0a, 0x00,
+    0x07, 0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x0f, 0x00, 0x07, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x02,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x00, 0x05, 0x00, 0x17, 0x00,
+    0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x00, 0x01,
+    0x06, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x07,
+    0x00, 0x15, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1e, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x1b, 0x1f, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x1b,
+    0x00, 0x00, 0x1f, 0x1b, 0x1f, 0x00, 0x00, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+    0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x0b, 0x00, 0x07, 0x00, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x17, 0x1f, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17, 0x00, 0x17,
+    0x00, 0x17, 0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x17, 0x00, 0x17, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x1f, 0x00, 0x1f,
+    0x00, 0x13, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x13, 0x00, 0x00, 0x1f, 0x13, 0x1f, 0x00, 0x00, 0x13,
+    0x00, 0x13, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1e, 0x00, 0x1e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x00,
+    0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x05, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x0b, 0x00, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x05, 0x0f, 0x00,
+    0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00, 0x17,
+    0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x05,
+    0x00, 0x17, 0x00, 0x00, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x17, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x09, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x13, 0x00, 0x1a, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0b,
+    0x00, 0x00, 0x0d, 0x07, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07,
+    0x01, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00, 0x17, 0x00, 0x13, 0x00, 0x17, 0x00, 0x17,
+    0x00, 0x00, 0x17, 0x17, 0x17, 0x00, 0x00, 0x13, 0x00, 0x13, 0x12, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x17, 0x00, 0x00, 0x17, 0x07, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00,
+    0x17, 0x07, 0x01, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x0e, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x05, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x0d, 0x07, 0x0d, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x13, 0x12, 0x00, 0x12, 0x00, 0x13, 0x00, 0x13, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x0e, 0x00, 0x0e, 0x00,
+    0x0f, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x0a, 0x00,
+    0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x0b, 0x00, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x01, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x05, 0x00,
+    0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+};
@@ -0,0 +1,98 @@
+// zlib framing for large payloads (see wsz.h)
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#include "wsz.h"
+
+// windowBits: negative for raw deflate, +16 for a gzip wrapper
+static unsigned char* deflate_into(const char* data, size_t length, size_t headroom, size_t prefix, int window_bits, size_t* out_length) {
+    z_stream zs;
+    memset(&zs, 0, sizeof(zs));
+    if (deflateInit2(&zs, WSZ_LEVEL, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY) != Z_OK) return NULL;
+
+    size_t bound = deflateBound(&zs, (uLong)length);
+    unsigned char* buffer = (unsigned char*)malloc(headroom + prefix + bound);
+    if (!buffer) {
+        deflateEnd(&zs);
+        return NULL;
+    }
+
+    zs.next_in = (Bytef*)data;
+    zs.avail_in = (uInt)length;
+    zs.next_out = buffer + headroom + prefix;
+    zs.avail_out = (uInt)bound;
+    int result = deflate(&zs, Z_FINISH);
+    *out_length = prefix + zs.total_out;
+    deflateEnd(&zs);
+
+    if (result != Z_STREAM_END) {
+        free(buffer);
+        return NULL;
+    }
+    return buffer;
+}
+
+unsigned char* wsz_encode(const char* message, size_t length, size_t headroom, size_t* out_length, int* binary) {
+    *binary = 0;
+    if (length >= WSZ_THRESHOLD) {
+        unsigned char* buffer = deflate_into(message, length, headroom, 1, -MAX_WBITS, out_length);
+        // Keep the compressed form only if it actually came out smaller
+        if (buffer && *out_length < length) {
+            buffer[headroom] = WSZ_MARKER;
+            *binary = 1;
+            return buffer;
+        }
+        free(buffer);
+    }
+
+    unsigned char* buffer = (unsigned char*)malloc(headroom + length);
+    if (!buffer) return NULL;
+    memcpy(buffer + headroom, message, length);
+    *out_length = length;
+    return buffer;
+}
+
+char* wsz_decode(const unsigned char* data, size_t length, size_t* out_length) {
+    if (length < 1 || data[0] != WSZ_MARKER) return NULL;
+
+    z_stream zs;
+    memset(&zs, 0, sizeof(zs));
+    if (inflateInit2(&zs, -MAX_WBITS) != Z_OK) return NULL;
+
+    size_t capacity = length * 4 + 256;
+    char* text = (char*)malloc(capacity + 1);
+    zs.next_in = (Bytef*)(data + 1);
+    zs.avail_in = (uInt)(length - 1);
+
+    int result = Z_OK;
+    while (text && result == Z_OK) {
+        if (zs.total_out == capacity) {
+            // Grow, but refuse to inflate without bound
+            if (capacity >= WSZ_MAX_DECODED) break;
+            capacity *= 2;
+            char* grown = (char*)realloc(text, capacity + 1);
+            if (!grown) break;
+            text = grown;
+        }
+        zs.next_out = (Bytef*)text + zs.total_out;
+        zs.avail_out = (uInt)(capacity - zs.total_out);
+        result = inflate(&zs, Z_NO_FLUSH);
+        if (result == Z_BUF_ERROR && zs.avail_out != 0) break;
+        if (result == Z_BUF_ERROR) result = Z_OK;
+    }
+
+    size_t total = zs.total_out;
+    inflateEnd(&zs);
+    if (result != Z_STREAM_END) {
+        free(text);
+        return NULL;
+    }
+    text[total] = '\0';
+    if (out_length) *out_length = total;
+    return text;
+}
+
+unsigned char* wsz_gzip(const char* data, size_t length, size_t* out_length) {
+    return deflate_into(data, length, 0, 0, MAX_WBITS + 16, out_length);
+}